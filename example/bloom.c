@@ -58,10 +58,8 @@ void bloom_create(int32_t width, int32_t height, int32_t mip_count) {
 		.write_mask   = skr_write_r | skr_write_g | skr_write_b | skr_write_a,
 		.depth_test   = skr_compare_always,
 	}, &g_bloom.bloom_composite_mat);
-	for (int32_t i = 0; i < mip_count; i++) {
-		skr_compute_create(&g_bloom.bloom_downsample_shader, &g_bloom.bloom_downsample_comp[i]);
-		skr_compute_create(&g_bloom.bloom_upsample_shader, &g_bloom.bloom_upsample_comp[i]);
-	}
+	skr_compute_create(&g_bloom.bloom_downsample_shader, &g_bloom.bloom_downsample_comp);
+	skr_compute_create(&g_bloom.bloom_upsample_shader,   &g_bloom.bloom_upsample_comp);
 
 	// Create fullscreen quad mesh
 	typedef struct {
@@ -120,49 +118,51 @@ void bloom_apply(skr_tex_t* scene_color, skr_tex_t* target, float bloom_strength
 	composite_params_t composite_params = { .bloom_strength = bloom_strength };
 	skr_buffer_set(&g_bloom.composite_params_buffer, &composite_params, sizeof(composite_params_t));
 
-	// Downsample passes
+	// Each chain is one batch: a single command buffer acquire and pipeline
+	// bind, with only the per-mip bindings re-pushed between dispatches.
+	skr_compute_t* down = &g_bloom.bloom_downsample_comp;
+	skr_compute_t* up   = &g_bloom.bloom_upsample_comp;
+	skr_bind_t down_params = skr_compute_get_bind(down, "BloomParams");
+	skr_bind_t down_source = skr_compute_get_bind(down, "source_tex");
+	skr_bind_t down_dest   = skr_compute_get_bind(down, "dest_tex");
+	skr_bind_t up_params   = skr_compute_get_bind(up,   "BloomParams");
+	skr_bind_t up_source   = skr_compute_get_bind(up,   "source_tex");
+	skr_bind_t up_blend    = skr_compute_get_bind(up,   "blend_tex");
+	skr_bind_t up_dest     = skr_compute_get_bind(up,   "dest_tex");
+
+	skr_compute_override_t down_overrides[7][3];
+	skr_compute_override_t up_overrides  [7][4];
+	skr_compute_dispatch_t down_dispatches[7];
+	skr_compute_dispatch_t up_dispatches  [7];
+
 	int32_t mip_width  = g_bloom.width  / 2;
 	int32_t mip_height = g_bloom.height / 2;
-
 	for (int32_t i = 0; i < g_bloom.bloom_mips; i++) {
-		skr_tex_t* source = (i == 0) ? scene_color : &g_bloom.bloom_chain[i - 1];
-		skr_tex_t* dest   = &g_bloom.bloom_chain[i];
-
-		skr_compute_set_buffer(&g_bloom.bloom_downsample_comp[i], "BloomParams", &g_bloom.bloom_params_buffers[i]);
-		skr_compute_set_tex   (&g_bloom.bloom_downsample_comp[i], "source_tex",  source);
-		skr_compute_set_tex   (&g_bloom.bloom_downsample_comp[i], "dest_tex",    dest);
-
 		uint32_t dispatch_x = (mip_width  + 7) / 8;
 		uint32_t dispatch_y = (mip_height + 7) / 8;
-		skr_compute_execute(&g_bloom.bloom_downsample_comp[i], dispatch_x, dispatch_y, 1);
+
+		// Downsample passes
+		skr_tex_t* source = (i == 0) ? scene_color : &g_bloom.bloom_chain[i - 1];
+		down_overrides[i][0] = (skr_compute_override_t){ .bind = down_params, .buffer = &g_bloom.bloom_params_buffers[i] };
+		down_overrides[i][1] = (skr_compute_override_t){ .bind = down_source, .tex    = source };
+		down_overrides[i][2] = (skr_compute_override_t){ .bind = down_dest,   .tex    = &g_bloom.bloom_chain[i] };
+		down_dispatches[i]   = (skr_compute_dispatch_t){ .x = dispatch_x, .y = dispatch_y, .z = 1, .overrides = down_overrides[i], .override_count = 3 };
+
+		// Upsample passes (smallest mip -> full res, blending up), so these
+		// are stored in reverse
+		int32_t    u     = g_bloom.bloom_mips - 1 - i;
+		skr_tex_t* blend = (i == g_bloom.bloom_mips - 1) ? &g_bloom.bloom_chain[i] : &g_bloom.bloom_upsample[i + 1];
+		up_overrides[u][0] = (skr_compute_override_t){ .bind = up_params, .buffer = &g_bloom.bloom_params_buffers[i] };
+		up_overrides[u][1] = (skr_compute_override_t){ .bind = up_source, .tex    = &g_bloom.bloom_chain[i] };
+		up_overrides[u][2] = (skr_compute_override_t){ .bind = up_blend,  .tex    = blend };
+		up_overrides[u][3] = (skr_compute_override_t){ .bind = up_dest,   .tex    = &g_bloom.bloom_upsample[i] };
+		up_dispatches[u]   = (skr_compute_dispatch_t){ .x = dispatch_x, .y = dispatch_y, .z = 1, .overrides = up_overrides[u], .override_count = 4 };
 
 		mip_width  /= 2;
 		mip_height /= 2;
 	}
-
-	// Upsample passes (smallest mip -> full res, blending up)
-	for (int32_t i = g_bloom.bloom_mips - 1; i >= 0; i--) {
-		// Calculate the actual size of mip level i
-		mip_width  = g_bloom.width / 2;
-		mip_height = g_bloom.height / 2;
-		for (int32_t j = 0; j < i; j++) {
-			mip_width  /= 2;
-			mip_height /= 2;
-		}
-
-		skr_tex_t* source = &g_bloom.bloom_chain[i];
-		skr_tex_t* blend  = (i == g_bloom.bloom_mips - 1) ? &g_bloom.bloom_chain[i] : &g_bloom.bloom_upsample[i + 1];
-		skr_tex_t* dest   = &g_bloom.bloom_upsample[i];
-
-		skr_compute_set_buffer(&g_bloom.bloom_upsample_comp[i], "BloomParams", &g_bloom.bloom_params_buffers[i]);
-		skr_compute_set_tex   (&g_bloom.bloom_upsample_comp[i], "source_tex",  source);
-		skr_compute_set_tex   (&g_bloom.bloom_upsample_comp[i], "blend_tex",   blend);
-		skr_compute_set_tex   (&g_bloom.bloom_upsample_comp[i], "dest_tex",    dest);
-
-		uint32_t dispatch_x = (mip_width  + 7) / 8;
-		uint32_t dispatch_y = (mip_height + 7) / 8;
-		skr_compute_execute(&g_bloom.bloom_upsample_comp[i], dispatch_x, dispatch_y, 1);
-	}
+	skr_compute_dispatch_batch(down, down_dispatches, (uint32_t)g_bloom.bloom_mips);
+	skr_compute_dispatch_batch(up,   up_dispatches,   (uint32_t)g_bloom.bloom_mips);
 
 	// Composite pass: render fullscreen quad with bloom to target
 	skr_material_set_params(&g_bloom.bloom_composite_mat, &g_bloom.composite_params_buffer, sizeof(g_bloom.composite_params_buffer));
@@ -212,10 +212,10 @@ void bloom_destroy(void) {
 	for (int32_t i = 0; i < g_bloom.bloom_mips; i++) {
 		skr_tex_destroy    (&g_bloom.bloom_chain          [i]);
 		skr_tex_destroy    (&g_bloom.bloom_upsample       [i]);
-		skr_compute_destroy(&g_bloom.bloom_downsample_comp[i]);
-		skr_compute_destroy(&g_bloom.bloom_upsample_comp  [i]);
 		skr_buffer_destroy (&g_bloom.bloom_params_buffers [i]);
 	}
+	skr_compute_destroy (&g_bloom.bloom_downsample_comp);
+	skr_compute_destroy (&g_bloom.bloom_upsample_comp);
 	skr_material_destroy(&g_bloom.bloom_composite_mat);
 	skr_mesh_destroy    (&g_bloom.fullscreen_quad);
 	skr_buffer_destroy  (&g_bloom.composite_params_buffer);
@@ -10,8 +10,8 @@
 typedef struct bloom_t {
 	skr_tex_t       bloom_chain[7];
 	skr_tex_t       bloom_upsample[7];
-	skr_compute_t   bloom_downsample_comp[7];
-	skr_compute_t   bloom_upsample_comp[7];
+	skr_compute_t   bloom_downsample_comp;  // Shared by every mip, see bloom_apply
+	skr_compute_t   bloom_upsample_comp;
 	skr_material_t  bloom_composite_mat;
 	skr_mesh_t      fullscreen_quad;
 	skr_buffer_t    bloom_params_buffers[7];
@@ -111,6 +111,7 @@ int main(int argc, char* argv[]) {
 		.enable_validation        = enable_validation,
 		.required_extensions      = extensions,
 		.required_extension_count = extension_count,
+		.enable_async_compute     = true,
 	};
 
 	if (!skr_init(settings)) {
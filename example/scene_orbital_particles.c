@@ -37,6 +37,7 @@ typedef struct {
 	skr_compute_t     compute_pong;
 	skr_buffer_t      particle_buffer_a;
 	skr_buffer_t      particle_buffer_b;
+	skr_future_t      buffer_drawn[2];  // Frame that last drew each buffer, compute waits on it before overwriting
 
 	float   time;
 	int32_t compute_iteration;
@@ -223,9 +224,14 @@ static void _scene_orbital_particles_update(scene_t* base, float delta_time) {
 	skr_compute_set_param(current, "delta_time", sksc_shader_var_float, 1, &delta_time);
 	skr_compute_set_param(current, "strength",   sksc_shader_var_float, 1, &(float){4.0f});
 
-	// Execute compute shader to update particles on GPU
+	// Execute compute shader to update particles on GPU, on the async compute
+	// queue if there is one so it overlaps with rendering. The buffer being
+	// written was drawn by an earlier frame that may still be in flight.
 	// Dispatch 500k particles / 256 threads per group = 1954 groups (rounded up)
+	int32_t write_idx = (scene->compute_iteration % 2 == 0) ? 1 : 0;
+	skr_compute_async_begin();
 	skr_compute_execute(current, (PARTICLE_COUNT + 255) / 256, 1, 1);
+	skr_compute_async_end(&scene->buffer_drawn[write_idx], 1);
 	scene->compute_iteration++;
 }
 
@@ -237,8 +243,10 @@ static void _scene_orbital_particles_render(scene_t* base, int32_t width, int32_
 
 	// Use particle buffer directly - no CPU roundtrip needed!
 	// The shader reads directly from the GPU buffer at slot 3
-	skr_buffer_t* current_buffer = (scene->compute_iteration % 2 == 0) ? &scene->particle_buffer_a : &scene->particle_buffer_b;
+	int32_t       current_idx    = (scene->compute_iteration % 2 == 0) ? 0 : 1;
+	skr_buffer_t* current_buffer = current_idx == 0 ? &scene->particle_buffer_a : &scene->particle_buffer_b;
 	skr_material_set_buffer(&scene->material, "particles", current_buffer);
+	scene->buffer_drawn[current_idx] = skr_future_get();
 
 	// Draw with no instance data - shader reads from buffer binding
 	skr_render_list_add(ref_render_list, &scene->pyramid_mesh, &scene->material, NULL, 0, PARTICLE_COUNT);
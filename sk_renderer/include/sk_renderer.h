@@ -122,9 +122,18 @@ typedef enum skr_use_ {
 	skr_use_dynamic       = 1 << 2,
 	skr_use_compute_read  = 1 << 3,
 	skr_use_compute_write = 1 << 4,
-	skr_use_compute_readwrite = skr_use_compute_read | skr_use_compute_write
+	skr_use_compute_readwrite = skr_use_compute_read | skr_use_compute_write,
+	skr_use_readback      = 1 << 5,  // Host-cached and mapped, for GPU results the CPU reads with skr_buffer_get
+	skr_use_stream        = 1 << 6,  // Dynamic, but in host-cached memory for CPU writes that aren't purely sequential
 } skr_use_;
 
+// A single region for skr_buffer_set_ranges, offset and size are in bytes.
+typedef struct skr_buffer_range_t {
+	const void* data;
+	uint32_t    offset;
+	uint32_t    size;
+} skr_buffer_range_t;
+
 typedef enum skr_tex_fmt_ {
 	skr_tex_fmt_none = 0,
 	skr_tex_fmt_rgba32_srgb = 1,
@@ -305,6 +314,8 @@ typedef enum skr_capability_ {
 	skr_capability_external_ahb,          // Android Hardware Buffer
 	skr_capability_external_dma,          // DMA-BUF via VK_EXT_external_memory_dma_buf
 	skr_capability_vk_video,              // Vulkan video decode (VK_KHR_video_decode_queue)
+	skr_capability_async_compute,         // Dedicated compute queue for skr_compute_async_begin/end
+	skr_capability_bindless,              // Descriptor indexing tables for `//--bindless` shaders
 	skr_capability_count_                 // Must be last - array size
 } skr_capability_;
 
@@ -475,8 +486,43 @@ typedef struct skr_settings_t {
 
 	// Bind slot configuration (NULL = use defaults: material=0, system=1, instance=2)
 	const skr_bind_settings_t* bind_settings;
+
+	// Frames of low usage before per-command bump allocators release their
+	// pages back to the shared pool (0 = default of 120).
+	uint32_t     bump_shrink_frames;
+
+	// Grab a dedicated compute queue family (if the GPU has one) so work
+	// between skr_compute_async_begin/end overlaps with rendering. Buffers and
+	// compute textures then use concurrent sharing across both families.
+	bool         enable_async_compute;
+
+	// Frames the CPU may record ahead of the GPU, 1-3 (0 = default of 3).
+	// Fewer frames mean less latency and less throughput, see also
+	// skr_renderer_set_frames_in_flight.
+	uint32_t     frames_in_flight;
+
+	// skr_renderer_frame_wait waits for the previous frame to finish on the
+	// GPU, rather than the one frames_in_flight ago.
+	bool         low_latency;
+
+	// Enable the global bindless texture/storage buffer tables for shaders
+	// compiled with `//--bindless = true`, when the device supports
+	// descriptor indexing. See skr_capability_bindless.
+	bool         enable_bindless;
 } skr_settings_t;
 
+// Timestamps of a finished frame for latency tracking and pose prediction,
+// in nanoseconds of the monotonic CPU clock (QueryPerformanceCounter on
+// Windows, CLOCK_MONOTONIC elsewhere).
+typedef struct skr_frame_timing_t {
+	uint64_t frame;                 // Frame number, counting from 0
+	uint64_t cpu_begin_ns;          // skr_renderer_frame_begin
+	uint64_t cpu_submit_ns;         // skr_renderer_frame_end submitted the frame
+	uint64_t gpu_complete_ns;       // When the CPU saw the GPU finish, exact if it had to wait for it
+	float    gpu_ms;                // GPU execution time from timestamp queries, 0 if not available yet
+	uint64_t predicted_latency_ns;  // Smoothed begin to GPU complete time, add to cpu_begin_ns for a prediction
+} skr_frame_timing_t;
+
 typedef struct skr_shader_t skr_shader_t;
 
 typedef struct skr_material_info_t {
@@ -490,8 +536,26 @@ typedef struct skr_material_info_t {
 	skr_stencil_state_t  stencil_front;
 	skr_stencil_state_t  stencil_back;
 	int32_t              queue_offset;  // Render queue offset for sorting (lower draws first)
+	bool                 immutable_samplers; // Bake texture samplers into the layout, textures must not change sampler after skr_material_set_tex
 } skr_material_info_t;
 
+// Name lookup done once up front with skr_shader_get_param_id, then usable
+// with every material and compute made from that shader.
+typedef struct skr_param_id_t {
+	int32_t  bind_idx;  // Texture/buffer bind, -1 if the name isn't a resource
+	uint32_t offset;    // Byte offset into the param buffer
+	uint16_t size;      // Param size in bytes, 0 if the name isn't a param
+	uint16_t type;      // sksc_shader_var_
+} skr_param_id_t;
+
+// One entry of skr_material_set_params_batch
+typedef struct skr_param_write_t {
+	skr_param_id_t id;
+	const void*    data;
+	uint32_t       size;  // Bytes at data, at most id.size
+	uint16_t       type;  // sksc_shader_var_ of data, checked against id.type like the typed setters. none or uint8 skips the check
+} skr_param_write_t;
+
 // While this project is primarily Vulkan, the option to add backends in the
 // future would be nice. WebGPU or D3D12 could be targets. However, we don't
 // want to introduce pointer indirection to core graphics assets! We risk a bit
@@ -507,11 +571,54 @@ SKR_API VkQueue           skr_get_vk_graphics_queue            (void);
 SKR_API uint32_t          skr_get_vk_graphics_queue_family     (void);
 SKR_API uint32_t          skr_get_vk_transfer_queue_family     (void);
 SKR_API uint32_t          skr_get_vk_video_decode_queue_family (void);  // UINT32_MAX if unavailable
+SKR_API uint32_t          skr_get_vk_compute_queue_family      (void);  // UINT32_MAX without async compute
 SKR_API void              skr_get_vk_device_uuid               (uint8_t out_uuid[VK_UUID_SIZE]);
 SKR_API void              skr_vk_queue_lock                    (uint32_t queue_family);
 SKR_API void              skr_vk_queue_unlock                  (uint32_t queue_family);
 #endif
 
+// One entry of skr_compute_dispatch_batch. Overrides stay on the compute for
+// the following dispatches, as if set with skr_compute_set_tex/buffer.
+typedef struct skr_compute_override_t {
+	skr_bind_t    bind;    // From skr_compute_get_bind
+	skr_buffer_t* buffer;
+	skr_tex_t*    tex;
+} skr_compute_override_t;
+
+typedef struct skr_compute_dispatch_t {
+	uint32_t                      x, y, z;         // Group counts
+	const void*                   params;          // Optional, full $Global contents like skr_compute_set_params, NULL keeps the previous
+	const skr_compute_override_t* overrides;       // Optional binding changes
+	uint32_t                      override_count;
+} skr_compute_dispatch_t;
+
+// Render graph resource handle, 0 = none. Only valid until skr_graph_clear.
+typedef uint32_t skr_graph_res_t;
+
+typedef enum skr_graph_use_ {
+	skr_graph_use_read,      // Sampled texture, or buffer read by a shader
+	skr_graph_use_storage,   // Compute RWTexture/RWBuffer, read and written
+	skr_graph_use_indirect,  // Indirect argument buffer
+} skr_graph_use_;
+
+typedef void (*skr_graph_execute_t)(skr_graph_t* graph, void* user_data);
+
+// A pass with a color or depth attachment runs its execute callback inside a
+// render pass on them, a pass without is a compute or copy pass.
+typedef struct skr_graph_pass_info_t {
+	const char*          name;           // Debug label, must outlive skr_graph_execute
+	skr_graph_execute_t  execute;
+	void*                user_data;
+	skr_graph_res_t      color;
+	skr_graph_res_t      depth;
+	skr_graph_res_t      resolve;
+	skr_clear_           clear;          // Attachments that aren't cleared keep their earlier contents
+	skr_vec4_t           clear_color;
+	float                clear_depth;
+	uint32_t             clear_stencil;
+	bool                 keep;           // Never culled, for passes with effects outside the graph
+} skr_graph_pass_info_t;
+
 ///////////////////////////////////////////////////////////////////////////////
 
 SKR_API bool              skr_init                         (skr_settings_t settings);
@@ -524,10 +631,18 @@ SKR_API bool              skr_is_capable                   (skr_capability_ capa
 SKR_API skr_future_t      skr_future_get                   (void);
 SKR_API bool              skr_future_check                 (const skr_future_t* future);
 SKR_API void              skr_future_wait                  (const skr_future_t* future);
+SKR_API bool              skr_future_wait_any              (const skr_future_t* futures, uint32_t count, uint64_t timeout_ns);
+SKR_API bool              skr_future_wait_all              (const skr_future_t* futures, uint32_t count, uint64_t timeout_ns);
 
 SKR_API void              skr_cmd_begin                    (void);
-SKR_API skr_future_t      skr_cmd_end                      (void);
-SKR_API skr_future_t      skr_cmd_flush                    (void);
+SKR_API skr_future_t      skr_cmd_end                      (void);  // Queued for the next frame end, flush, or wait on its future
+SKR_API skr_future_t      skr_cmd_flush                    (void);  // Submits now, along with work queued from every thread
+
+// Compute work between these runs on the dedicated compute queue (see
+// skr_settings_t.enable_async_compute), or as a plain batch without one.
+// Only compute dispatches and buffer/texture uploads belong inside.
+SKR_API void              skr_compute_async_begin          (void);
+SKR_API skr_future_t      skr_compute_async_end            (const skr_future_t* opt_waits, uint32_t wait_count);
 
 SKR_API void              skr_callback_log                 (void (*callback)(skr_log_ level, const char* text));
 SKR_API void              skr_log                          (skr_log_ level, const char* text, ...);
@@ -537,8 +652,13 @@ SKR_API skr_err_          skr_buffer_create                (const void *opt_data
 SKR_API void              skr_buffer_destroy               (      skr_buffer_t* ref_buffer);
 SKR_API bool              skr_buffer_is_valid              (const skr_buffer_t*     buffer);
 SKR_API void              skr_buffer_set                   (      skr_buffer_t* ref_buffer, const void *data, uint32_t size_bytes);
+SKR_API skr_err_          skr_buffer_set_range             (      skr_buffer_t* ref_buffer, const void *data, uint32_t offset_bytes, uint32_t size_bytes);
+SKR_API skr_err_          skr_buffer_set_ranges            (      skr_buffer_t* ref_buffer, const skr_buffer_range_t* ranges, uint32_t range_count);
 SKR_API void              skr_buffer_get                   (const skr_buffer_t*     buffer, void *ref_buffer, uint32_t buffer_size);
+SKR_API skr_err_          skr_buffer_readback              (const skr_buffer_t*     buffer, uint32_t offset_bytes, uint32_t size_bytes, skr_buffer_readback_t* out_readback);
+SKR_API void              skr_buffer_readback_destroy      (      skr_buffer_readback_t* ref_readback);
 SKR_API uint32_t          skr_buffer_get_size              (const skr_buffer_t*     buffer);
+SKR_API uint32_t          skr_buffer_get_bindless_index    (      skr_buffer_t* ref_buffer);  // Storage buffers only, registers on first call
 SKR_API void              skr_buffer_set_name              (      skr_buffer_t* ref_buffer, const char* name);
 
 SKR_API skr_err_          skr_vert_type_create             (const skr_vert_component_t* items, int32_t item_count, skr_vert_type_t* out_type);
@@ -576,6 +696,7 @@ SKR_API skr_tex_flags_    skr_tex_get_flags                (const skr_tex_t*
 SKR_API int32_t           skr_tex_get_multisample          (const skr_tex_t*     tex);
 SKR_API void              skr_tex_set_sampler              (      skr_tex_t* ref_tex, skr_tex_sampler_t sampler);
 SKR_API skr_tex_sampler_t skr_tex_get_sampler              (const skr_tex_t*     tex);
+SKR_API uint32_t          skr_tex_get_bindless_index       (      skr_tex_t* ref_tex);     // 2D textures only, registers on first call, 0 = white
 SKR_API skr_err_          skr_tex_set_data                 (      skr_tex_t* ref_tex, const skr_tex_data_t* data);
 SKR_API void              skr_tex_generate_mips            (      skr_tex_t* ref_tex, const skr_shader_t* opt_compute_shader);
 SKR_API void              skr_tex_set_name                 (      skr_tex_t* ref_tex, const char* name);
@@ -588,6 +709,21 @@ SKR_API uint32_t          skr_tex_calc_mip_count           (skr_vec3i_t size);
 SKR_API skr_vec3i_t       skr_tex_calc_mip_dimensions      (skr_vec3i_t base_size, uint32_t mip_level);
 SKR_API uint64_t          skr_tex_calc_mip_size            (skr_tex_fmt_ format, skr_vec3i_t base_size, uint32_t mip_level);
 
+// Texture atlas. Textures sharing a format, size and mip count are packed
+// into the layers of one array texture, so materials that bind the atlas
+// instead of their own texture carry identical resources, and the render
+// list can merge their draws into one instanced draw. Shaders sample a
+// Texture2DArray with the layer index. A uint atlas_layer material param is
+// copied into each instance when the shader's instance struct ends with one
+// more uint than the instance data given, and then doesn't split draws.
+SKR_API skr_err_          skr_tex_atlas_create             (skr_tex_fmt_ format, skr_tex_sampler_t sampler, skr_vec3i_t size, int32_t mip_count, uint32_t layer_capacity, skr_tex_atlas_t* out_atlas);
+SKR_API void              skr_tex_atlas_destroy            (      skr_tex_atlas_t* ref_atlas);
+SKR_API bool              skr_tex_atlas_accepts            (const skr_tex_atlas_t*     atlas, const skr_tex_t* tex);  // Format, size and mip count match
+SKR_API skr_err_          skr_tex_atlas_add                (      skr_tex_atlas_t* ref_atlas, const skr_tex_t* src, uint32_t* out_layer);  // GPU copy, src needs skr_tex_flags_readable
+SKR_API skr_err_          skr_tex_atlas_add_data           (      skr_tex_atlas_t* ref_atlas, const skr_tex_data_t* data, uint32_t* out_layer);  // One layer of data, base_layer is ignored
+SKR_API void              skr_tex_atlas_remove             (      skr_tex_atlas_t* ref_atlas, uint32_t layer);
+SKR_API skr_tex_t*        skr_tex_atlas_get_tex            (      skr_tex_atlas_t* ref_atlas);
+
 SKR_API skr_err_          skr_surface_create               (void* vk_surface_khr, skr_surface_t* out_surface);
 SKR_API void              skr_surface_destroy              (      skr_surface_t* ref_surface);
 SKR_API void              skr_surface_resize               (      skr_surface_t* ref_surface);
@@ -596,9 +732,11 @@ SKR_API void              skr_surface_present              (      skr_surface_t*
 SKR_API skr_vec2i_t       skr_surface_get_size             (const skr_surface_t*     surface);
 
 SKR_API skr_err_          skr_shader_create                (const void *shader_data, uint32_t data_size, skr_shader_t* out_shader);
+SKR_API skr_err_          skr_shader_reload                (      skr_shader_t* ref_shader, const void *shader_data, uint32_t data_size);  // In place, code and defaults may change but not resources or params
 SKR_API bool              skr_shader_is_valid              (const skr_shader_t*     shader);
 SKR_API void              skr_shader_destroy               (      skr_shader_t* ref_shader);
 SKR_API skr_bind_t        skr_shader_get_bind              (const skr_shader_t*     shader, const char* bind_name);
+SKR_API skr_param_id_t    skr_shader_get_param_id          (const skr_shader_t*     shader, const char* name);
 SKR_API void              skr_shader_set_name              (      skr_shader_t* ref_shader, const char* name);
 
 SKR_API skr_err_          skr_compute_create               (const skr_shader_t* shader, skr_compute_t* out_compute);
@@ -607,13 +745,18 @@ SKR_API void              skr_compute_destroy              (      skr_compute_t*
 SKR_API skr_bind_t        skr_compute_get_bind             (const skr_compute_t*     compute, const char* bind_name);
 SKR_API void              skr_compute_execute              (      skr_compute_t* ref_compute, uint32_t x, uint32_t y, uint32_t z);
 SKR_API void              skr_compute_execute_indirect     (      skr_compute_t* ref_compute, skr_buffer_t* indirect_args);
+SKR_API void              skr_compute_dispatch_batch       (      skr_compute_t* ref_compute, const skr_compute_dispatch_t* dispatches, uint32_t count);
 SKR_API void              skr_compute_set_tex              (      skr_compute_t* ref_compute, const char* name, skr_tex_t*    texture);
 SKR_API void              skr_compute_set_buffer           (      skr_compute_t* ref_compute, const char* name, skr_buffer_t* buffer);
 SKR_API void              skr_compute_set_params           (      skr_compute_t* ref_compute, const void* data, uint32_t size);
 SKR_API void              skr_compute_set_param            (      skr_compute_t*     compute, const char* name, sksc_shader_var_ type, uint32_t count, const void* data);
 SKR_API void              skr_compute_get_param            (const skr_compute_t*     compute, const char* name, sksc_shader_var_ type, uint32_t count, void* out_data);
+SKR_API void              skr_compute_set_tex_id           (      skr_compute_t* ref_compute, skr_param_id_t id, skr_tex_t*    texture);
+SKR_API void              skr_compute_set_buffer_id        (      skr_compute_t* ref_compute, skr_param_id_t id, skr_buffer_t* buffer);
+SKR_API void              skr_compute_set_param_id         (      skr_compute_t* ref_compute, skr_param_id_t id, const void* data, uint32_t size);
 
 SKR_API skr_err_          skr_material_create              (skr_material_info_t info, skr_material_t* out_material);
+SKR_API skr_err_          skr_material_create_variant      (const skr_material_t*     parent, skr_material_t* out_material);
 SKR_API bool              skr_material_is_valid            (const skr_material_t*     material);
 SKR_API void              skr_material_set_tex             (      skr_material_t* ref_material, const char* name, skr_tex_t*    texture);
 SKR_API void              skr_material_set_buffer          (      skr_material_t* ref_material, const char* name, skr_buffer_t* buffer);
@@ -621,6 +764,16 @@ SKR_API void              skr_material_set_params          (      skr_material_t
 SKR_API void              skr_material_destroy             (      skr_material_t* ref_material);
 SKR_API void              skr_material_set_param           (      skr_material_t* ref_material, const char* name, sksc_shader_var_ type, uint32_t count, const void* data);
 SKR_API void              skr_material_get_param           (const skr_material_t*     material, const char* name, sksc_shader_var_ type, uint32_t count, void* out_data);
+SKR_API void              skr_material_set_tex_id          (      skr_material_t* ref_material, skr_param_id_t id, skr_tex_t*    texture);
+SKR_API void              skr_material_set_buffer_id       (      skr_material_t* ref_material, skr_param_id_t id, skr_buffer_t* buffer);
+SKR_API void              skr_material_set_param_id        (      skr_material_t* ref_material, skr_param_id_t id, const void* data, uint32_t size);
+SKR_API void              skr_material_set_float_id        (      skr_material_t* ref_material, skr_param_id_t id, float        value);
+SKR_API void              skr_material_set_vec2_id         (      skr_material_t* ref_material, skr_param_id_t id, skr_vec2_t   value);
+SKR_API void              skr_material_set_vec3_id         (      skr_material_t* ref_material, skr_param_id_t id, skr_vec3_t   value);
+SKR_API void              skr_material_set_vec4_id         (      skr_material_t* ref_material, skr_param_id_t id, skr_vec4_t   value);
+SKR_API void              skr_material_set_int_id          (      skr_material_t* ref_material, skr_param_id_t id, int32_t      value);
+SKR_API void              skr_material_set_uint_id         (      skr_material_t* ref_material, skr_param_id_t id, uint32_t     value);
+SKR_API void              skr_material_set_params_batch    (      skr_material_t* ref_material, const skr_param_write_t* writes, uint32_t count);
 
 SKR_API skr_err_          skr_render_list_create           (skr_render_list_t* out_list);
 SKR_API void              skr_render_list_destroy          (skr_render_list_t* ref_list);
@@ -628,6 +781,25 @@ SKR_API void              skr_render_list_clear            (skr_render_list_t* r
 SKR_API void              skr_render_list_add              (skr_render_list_t* ref_list, skr_mesh_t* mesh, skr_material_t* material, const void* opt_instance_data, uint32_t single_instance_data_size, uint32_t instance_count);
 SKR_API void              skr_render_list_add_indexed      (skr_render_list_t* ref_list, skr_mesh_t* mesh, skr_material_t* material, int32_t first_index, int32_t index_count, int32_t vertex_offset, const void* opt_instance_data, uint32_t single_instance_data_size, uint32_t instance_count);
 
+// Render graph. Passes declare the resources they touch, then
+// skr_graph_execute orders them, culls passes nothing depends on, places
+// barriers and attachment ops, and aliases transient textures in shared
+// memory. Describe the graph again each frame after skr_graph_clear; the
+// transient memory is rebuilt only when the transient textures or their
+// lifetimes change. Transient contents don't survive between frames.
+SKR_API skr_err_          skr_graph_create                 (skr_graph_t* out_graph);
+SKR_API void              skr_graph_destroy                (skr_graph_t* ref_graph);
+SKR_API void              skr_graph_clear                  (skr_graph_t* ref_graph);
+SKR_API skr_graph_res_t   skr_graph_import_tex             (skr_graph_t* ref_graph, skr_tex_t* tex);
+SKR_API skr_graph_res_t   skr_graph_import_buffer          (skr_graph_t* ref_graph, skr_buffer_t* buffer);
+SKR_API skr_graph_res_t   skr_graph_create_tex             (skr_graph_t* ref_graph, const char* name, skr_tex_fmt_ format, skr_tex_flags_ flags, skr_tex_sampler_t sampler, skr_vec3i_t size, int32_t multisample, int32_t mip_count);
+SKR_API uint32_t          skr_graph_add_pass               (skr_graph_t* ref_graph, skr_graph_pass_info_t info);
+SKR_API void              skr_graph_pass_use               (skr_graph_t* ref_graph, uint32_t pass, skr_graph_res_t res, skr_graph_use_ use);
+SKR_API skr_err_          skr_graph_execute                (skr_graph_t* ref_graph);
+SKR_API skr_tex_t*        skr_graph_get_tex                (const skr_graph_t*     graph, skr_graph_res_t res);  // Transient textures only exist inside skr_graph_execute
+SKR_API skr_buffer_t*     skr_graph_get_buffer             (const skr_graph_t*     graph, skr_graph_res_t res);
+
+SKR_API void              skr_renderer_frame_wait          (void);  // Paces the CPU against the GPU, call right before sampling input. frame_begin calls it if you don't.
 SKR_API void              skr_renderer_frame_begin         (void);
 SKR_API void              skr_renderer_frame_end           (skr_surface_t** opt_surfaces, uint32_t count);  // Submit frame with surface synchronization
 SKR_API void              skr_renderer_begin_pass          (skr_tex_t* color, skr_tex_t* depth, skr_tex_t* opt_resolve, skr_clear_ clear, skr_vec4_t clear_color, float clear_depth, uint32_t clear_stencil);
@@ -642,6 +814,10 @@ SKR_API void              skr_renderer_draw                (skr_render_list_t* l
 SKR_API void              skr_renderer_draw_mesh_immediate (skr_mesh_t* mesh, skr_material_t* material, int32_t first_index, int32_t index_count, int32_t vertex_offset, int32_t instance_count);
 SKR_API float             skr_renderer_get_gpu_time_ms     (void);
 SKR_API float             skr_renderer_get_cpu_time_ms     (void);
+SKR_API bool              skr_renderer_get_frame_timing    (skr_frame_timing_t* out_timing);  // Most recent frame the GPU finished, false if none yet
+SKR_API void              skr_renderer_set_frames_in_flight(uint32_t count);  // 1-3, takes effect at the next frame
+SKR_API uint32_t          skr_renderer_get_frames_in_flight(void);
+SKR_API void              skr_renderer_set_low_latency     (bool enable);
 
 #ifdef __cplusplus
 }
@@ -27,6 +27,12 @@ extern "C" {
 
 ///////////////////////////////////////////////////////////////////////////////
 
+// Register space skshaderc reserves for the bindless resource tables of
+// shaders compiled with `//--bindless = true`.
+#define SKSC_BINDLESS_SPACE 1
+
+///////////////////////////////////////////////////////////////////////////////
+
 typedef enum {
 	skr_vertex_fmt_none,
 	skr_vertex_fmt_f64,
@@ -83,6 +89,7 @@ typedef enum {
 	skr_register_read_buffer,
 	skr_register_readwrite,
 	skr_register_readwrite_tex,
+	skr_register_push_constant, // `[[vk::push_constant]] cbuffer`, the material params when present
 } skr_register_;
 
 typedef enum {
@@ -168,6 +175,7 @@ typedef struct {
 	int32_t                vertex_input_count;
 	sksc_shader_ops_t      ops_vertex;
 	sksc_shader_ops_t      ops_pixel;
+	bool                   bindless; // `//--bindless = true`, SKSC_BINDLESS_SPACE holds the renderer's tables
 } sksc_shader_meta_t;
 
 typedef struct {
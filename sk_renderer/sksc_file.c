@@ -49,7 +49,7 @@ bool sksc_shader_file_verify(const void *data, uint32_t size, uint16_t *out_vers
 sksc_result_ sksc_shader_file_load_memory(const void *data, uint32_t size, sksc_shader_file_t *out_file) {
 	uint16_t file_version = 0;
 	if (!sksc_shader_file_verify(data, size, &file_version, NULL, 0)) return sksc_result_bad_format;
-	if (file_version != 5)                                            return sksc_result_old_version;
+	if (file_version != 6)                                            return sksc_result_old_version;
 
 	const uint8_t *bytes = (uint8_t*)data;
 	uint32_t at = 10;
@@ -80,6 +80,7 @@ sksc_result_ sksc_shader_file_load_memory(const void *data, uint32_t size, sksc_
 	memcpy(&out_file->meta->ops_pixel.total,         &bytes[at], sizeof(out_file->meta->ops_pixel.total));         at += sizeof(out_file->meta->ops_pixel.total);
 	memcpy(&out_file->meta->ops_pixel.tex_read,      &bytes[at], sizeof(out_file->meta->ops_pixel.tex_read));      at += sizeof(out_file->meta->ops_pixel.tex_read);
 	memcpy(&out_file->meta->ops_pixel.dynamic_flow,  &bytes[at], sizeof(out_file->meta->ops_pixel.dynamic_flow));  at += sizeof(out_file->meta->ops_pixel.dynamic_flow);
+	memcpy(&out_file->meta->bindless,                &bytes[at], sizeof(out_file->meta->bindless));                at += sizeof(out_file->meta->bindless);
 
 	for (uint32_t i = 0; i < out_file->meta->buffer_count; i++) {
 		sksc_shader_buffer_t *buffer = &out_file->meta->buffers[i];
@@ -113,7 +114,7 @@ sksc_result_ sksc_shader_file_load_memory(const void *data, uint32_t size, sksc_
 			var->name_hash = skr_hash(var->name);
 		}
 
-		if (strcmp(buffer->name, "$Global") == 0)
+		if (strcmp(buffer->name, "$Global") == 0 || buffer->bind.register_type == skr_register_push_constant)
 			out_file->meta->global_buffer_id = (int32_t)i;
 	}
 
@@ -31,11 +31,14 @@ typedef struct {
 	VkSampleCountFlagBits samples;
 	VkAttachmentStoreOp   depth_store_op;   // How to store depth (STORE or DONT_CARE)
 	VkAttachmentLoadOp    color_load_op;    // How to load color (LOAD, CLEAR, or DONT_CARE)
+	VkAttachmentLoadOp    depth_load_op;    // How to load depth (LOAD, CLEAR, or DONT_CARE)
 } skr_pipeline_renderpass_key_t;
 
-#define SKR_QUEUE_TYPE_COUNT    4   // graphics, present, transfer, video_decode
+#define SKR_QUEUE_TYPE_COUNT    5   // graphics, present, transfer, video_decode, compute
 #define skr_MAX_COMMAND_RING    8   // Number of command buffers per thread
 #define skr_MAX_THREAD_POOLS    16  // Maximum concurrent threads
+#define SKR_MAX_TIMELINES       (skr_MAX_THREAD_POOLS * 2)  // Graphics + async compute timeline per thread
+#define SKR_MAX_CONSUME_WAITS   (SKR_MAX_SURFACES * SKR_MAX_FRAMES_IN_FLIGHT)  // Stray acquire semaphores a thread holds until its next submit
 
 // Bind shifts (hardcoded to match skshaderc)
 #define SKR_BIND_SHIFT_BUFFER  0
@@ -57,74 +60,250 @@ typedef struct skr_destroy_list_t {
 // Most textures use one of a handful of sampler configurations
 typedef struct {
 	skr_tex_sampler_t settings;
-	VkSampler         sampler;
-	uint32_t          ref_count;
+	VkSampler         sampler;    // VK_NULL_HANDLE while the slot is empty
 } _skr_sampler_entry_t;
 
+// Open addressed hash table, grown and probed under the lock. Lookups only
+// happen when a texture is created or changes sampler, so they stay locked
+// rather than reading a published copy of the table. Samplers live until
+// shutdown, since the GPU may still use one nobody references anymore, so
+// entries aren't refcounted either.
+#define SKR_SAMPLER_CACHE_MIN_SLOTS 64
 typedef struct {
-	_skr_sampler_entry_t* entries;
-	uint32_t              count;
+	_skr_sampler_entry_t* entries;   // capacity of them, a power of two
 	uint32_t              capacity;
+	uint32_t              count;
 	mtx_t                 mutex;
 } _skr_sampler_cache_t;
 
 // Bind pool for material resource bindings
-// Manages consecutive runs of slots for safe lifetime management
+// Ranges live in fixed-size chunks that never move, so draw threads can read
+// them without the lock. Ranges are rounded up to a power of two and recycled
+// through a free list per size, ranges never straddle a chunk.
+#define SKR_BIND_POOL_CHUNK_SHIFT 10
+#define SKR_BIND_POOL_CHUNK_SIZE  (1u << SKR_BIND_POOL_CHUNK_SHIFT)
+#define SKR_BIND_POOL_MAX_CHUNKS  1024
+#define SKR_BIND_POOL_CLASSES     (SKR_BIND_POOL_CHUNK_SHIFT + 1)
+
 typedef struct {
-	uint32_t start;
-	uint32_t count;
-} _skr_bind_range_t;
+	uint32_t* starts;
+	uint32_t  count;
+	uint32_t  capacity;
+} _skr_bind_free_list_t;
+
+// Persistent descriptor sets of one material, for devices without push
+// descriptors. Keyed by everything written into them except the per-draw
+// offsets, which go through dynamic offsets instead.
+#define SKR_MATERIAL_SET_CACHE    4
+#define SKR_MAX_DYNAMIC_BINDINGS  3 // Material params, system buffer, instance buffer
+
+// What one write put in a set, compared on a hit so a key collision can't
+// hand back a set that points at other resources
+typedef struct {
+	uint64_t         handle;   // VkBuffer or VkImageView
+	uint64_t         sampler;
+	VkDeviceSize     offset;
+	VkDeviceSize     range;
+	uint32_t         binding;
+	VkDescriptorType type;
+	VkImageLayout    layout;
+} _skr_material_set_write_t;
+
+typedef struct {
+	uint64_t                   key;
+	VkDescriptorSet            set;
+	VkDescriptorSetLayout      layout;
+	uint32_t                   last_use;
+	uint32_t                   write_count;
+	_skr_material_set_write_t* writes;
+} _skr_material_set_entry_t;
 
 typedef struct {
-	skr_material_bind_t* binds;
-	uint32_t             capacity;
-	_skr_bind_range_t*   free_ranges;
-	uint32_t             free_range_count;
-	uint32_t             free_range_capacity;
-	mtx_t                mutex;
+	_skr_material_set_entry_t entries[SKR_MATERIAL_SET_CACHE];
+} _skr_material_sets_t;
+
+// A handle some persistent set was written with, and how many writes use
+// it. Destroyed buffers and views that aren't in here skip the set scan.
+typedef struct {
+	uint64_t handle;  // 0 while the slot is empty
+	uint32_t uses;
+} _skr_material_set_handle_t;
+
+typedef struct {
+	skr_material_bind_t*   chunks[SKR_BIND_POOL_MAX_CHUNKS];
+	uint32_t*              refs  [SKR_BIND_POOL_MAX_CHUNKS]; // Per slot, counted at range starts, material variants share ranges
+	uint32_t               chunk_count;
+	uint32_t               top;       // Slots carved out of the chunks so far
+	_skr_bind_free_list_t  free_lists[SKR_BIND_POOL_CLASSES]; // Freed range starts, by log2 of the range size
+	_skr_material_sets_t** sets;      // Per range start, allocated on first use (fallback path only)
+	uint32_t               set_capacity;
+	uint32_t               set_clock; // LRU clock for set cache entries
+	uint32_t               material_serial; // Seeds skr_material_t::param_generation, unique per material
+	VkDescriptorPool       set_pool;  // Persistent material sets, VK_NULL_HANDLE with push descriptors
+	_skr_material_set_handle_t* set_handles; // Open addressed, set_handle_capacity of them, a power of two
+	uint32_t               set_handle_capacity;
+	uint32_t               set_handle_count;
+	bool                   set_handles_lost; // The table couldn't grow, so every invalidate scans
+	mtx_t                  mutex;
 } _skr_bind_pool_t;
 
+// Bindless resource tables (VK_EXT_descriptor_indexing)
+// One update-after-bind set per frame in flight, all holding the same
+// indices, handed out per resource
+typedef struct {
+	uint32_t* free;
+	uint32_t  free_count;
+	uint32_t  next;
+	uint32_t  capacity;
+} _skr_bindless_slots_t;
+
+// A texture descriptor that changed while frames in flight may be reading
+// it, written into each set once that set's frame slot comes back around
+typedef struct {
+	uint32_t              index;
+	uint32_t              pending; // Bit per set still holding the old descriptor
+	VkDescriptorImageInfo info;
+} _skr_bindless_rewrite_t;
+
+typedef struct {
+	VkDescriptorSetLayout    layout;
+	VkDescriptorSetLayout    empty_layout; // Stand-in for set 0 when a bindless shader has no other bindings
+	VkDescriptorPool         pool;
+	VkDescriptorSet          sets[SKR_MAX_FRAMES_IN_FLIGHT]; // Indexed by flight_idx
+	_skr_bindless_slots_t    textures;
+	_skr_bindless_slots_t    buffers;
+	_skr_bindless_rewrite_t* rewrites;
+	uint32_t                 rewrite_count;
+	uint32_t                 rewrite_capacity;
+	mtx_t                    mutex;
+} _skr_bindless_t;
+
 ///////////////////////////////////////////////////////////////////////////////
-// Bump Allocator - provides (buffer, offset) pairs with overflow support
+// Bump Allocator - provides (buffer, offset) pairs from recycled pages
 ///////////////////////////////////////////////////////////////////////////////
 
+#define SKR_BUMP_PAGE_SIZE           (64 * 1024) // Standard page size, shared through the page pool
+#define SKR_BUMP_PAGE_POOL_MAX       32          // Max idle standard pages kept per buffer type
+#define SKR_BUMP_MERGE_FRAMES        8           // Frames of multi-page use before merging into one page
+#define SKR_BUMP_SHRINK_FRAMES       120         // Default low-usage frames before releasing pages
+
 // Result of a bump allocation
 typedef struct skr_bump_result_t {
 	skr_buffer_t* buffer;
 	uint32_t      offset;
 } skr_bump_result_t;
 
-// Bump allocator with automatic overflow handling
+// Bump allocator that grows in pages. Standard pages come from a pool shared
+// by all allocators, and are kept across frames. Sustained multi-page frames
+// merge into one larger dedicated page, and sustained low usage releases
+// pages back to the pool.
 typedef struct skr_bump_alloc_t {
-	// Main buffer (resized between frames based on high-water mark)
-	skr_buffer_t     main_buffer;
-	uint32_t         main_used;
-	bool             main_valid;
-
-	// Overflow buffers (created mid-frame if main is exhausted)
-	skr_buffer_t*    overflow;
-	uint32_t         overflow_count;
-	uint32_t         overflow_capacity;
-
-	// High-water mark for next-frame sizing
-	uint32_t         high_water_mark;
+	// Pages are heap allocated so result pointers stay valid while the
+	// page array grows.
+	skr_buffer_t**   pages;
+	uint32_t         page_count;
+	uint32_t         page_capacity;
+	uint32_t         page_curr;    // Page being written this frame
+	uint32_t         page_used;    // Bytes used in page_curr
+
+	// Usage tracking for merge/shrink decisions
+	uint32_t         frame_used;   // Bytes allocated this frame, including alignment
+	uint32_t         grow_peak;    // Max frame_used over the current multi-page streak
+	uint32_t         grow_frames;  // Consecutive frames that spilled past one page
+	uint32_t         low_peak;     // Max frame_used over the current low-usage streak
+	uint32_t         low_frames;   // Consecutive frames using under half the retained capacity
 
 	// Configuration
 	skr_buffer_type_ buffer_type;
 	uint32_t         alignment;  // Minimum alignment for allocations (e.g., 256 for UBOs)
 } skr_bump_alloc_t;
 
+// Idle standard-size pages for one buffer type
+typedef struct {
+	skr_buffer_type_ buffer_type;
+	skr_buffer_t*    pages[SKR_BUMP_PAGE_POOL_MAX];
+	uint32_t         count;
+} _skr_bump_page_list_t;
+
+typedef struct {
+	_skr_bump_page_list_t lists[4];
+	mtx_t                 mutex;
+} _skr_bump_page_pool_t;
+
+///////////////////////////////////////////////////////////////////////////////
+// Readback staging pool - host cached buffers reused by skr_buffer_readback
+///////////////////////////////////////////////////////////////////////////////
+
+#define SKR_READBACK_POOL_MAX 16  // Max idle staging buffers kept for reuse
+
+typedef struct {
+	VkBuffer       buffer;
+	VkDeviceMemory memory;
+	void*          mapped;
+	uint32_t       size;
+} _skr_readback_staging_t;
+
+typedef struct {
+	_skr_readback_staging_t entries[SKR_READBACK_POOL_MAX];
+	uint32_t                count;
+	mtx_t                   mutex;
+} _skr_readback_pool_t;
+
+///////////////////////////////////////////////////////////////////////////////
+// Barrier batch - per command buffer, flushed as one barrier call before the
+// next command that depends on it (draw pass, dispatch, copy, submit)
 ///////////////////////////////////////////////////////////////////////////////
 
+#define SKR_BARRIER_MAX_IMAGES  32
+#define SKR_BARRIER_MAX_BUFFERS 16
+#define SKR_BARRIER_HASH_SIZE   64  // Power of 2, > SKR_BARRIER_MAX_IMAGES
+
+typedef struct {
+	VkImage              image;
+	VkImageAspectFlags   aspect_mask;
+	uint32_t             base_mip;
+	uint32_t             mip_count;
+	uint32_t             layer_count;
+	VkImageLayout        old_layout;
+	VkImageLayout        new_layout;
+	VkPipelineStageFlags src_stage;
+	VkPipelineStageFlags dst_stage;
+	VkAccessFlags        src_access;
+	VkAccessFlags        dst_access;
+} _skr_image_barrier_t;
+
 typedef struct {
-	VkCommandBuffer    cmd;
-	VkFence            fence;
-	VkDescriptorPool   descriptor_pool;  // Per-command descriptor pool (for non-push-descriptor fallback)
-	skr_destroy_list_t destroy_list;
-	skr_bump_alloc_t   const_bump;       // Bump allocator for constant buffers (compute $Globals, system, material params)
-	skr_bump_alloc_t   storage_bump;     // Bump allocator for storage buffers (instance data)
-	bool               alive;
-	uint64_t           generation;  // Incremented each time this slot is reused
+	VkBuffer             buffer;
+	VkDeviceSize         offset;
+	VkDeviceSize         size;
+	VkPipelineStageFlags src_stage;
+	VkPipelineStageFlags dst_stage;
+	VkAccessFlags        src_access;
+	VkAccessFlags        dst_access;
+} _skr_buffer_barrier_t;
+
+typedef struct {
+	_skr_image_barrier_t  images    [SKR_BARRIER_MAX_IMAGES];
+	_skr_buffer_barrier_t buffers   [SKR_BARRIER_MAX_BUFFERS];
+	uint8_t               image_hash[SKR_BARRIER_HASH_SIZE];  // images index + 1, 0 = empty
+	uint32_t              image_count;
+	uint32_t              buffer_count;
+	VkPipelineStageFlags  memory_src_stage;  // Global memory barrier, 0 = none
+	VkPipelineStageFlags  memory_dst_stage;
+	VkAccessFlags         memory_src_access;
+	VkAccessFlags         memory_dst_access;
+} _skr_barrier_batch_t;
+
+///////////////////////////////////////////////////////////////////////////////
+
+typedef struct {
+	VkCommandBuffer      cmd;
+	VkDescriptorPool     descriptor_pool;  // Per-command descriptor pool (for non-push-descriptor fallback)
+	skr_destroy_list_t   destroy_list;
+	skr_bump_alloc_t     const_bump;       // Bump allocator for constant buffers (compute $Globals, system, material params)
+	skr_bump_alloc_t     storage_bump;     // Bump allocator for storage buffers (instance data)
+	_skr_barrier_batch_t barriers;         // Pending barriers, flushed before dependent commands
+	uint64_t             timeline_value;   // Thread timeline value signaled when this slot's work completes
 } _skr_cmd_ring_slot_t;
 
 // Command context returned from command begin/acquire
@@ -136,17 +315,62 @@ typedef struct {
 	skr_bump_alloc_t*   storage_bump;     // Bump allocator for storage buffers
 } _skr_cmd_ctx_t;
 
+// Ring of command buffers for one queue, owned by a thread
 typedef struct {
 	VkCommandPool          cmd_pool;
-	_skr_cmd_ring_slot_t*  active_cmd;      // Currently recording command buffer
 	_skr_cmd_ring_slot_t*  last_submitted;  // Most recently submitted command buffer
 	_skr_cmd_ring_slot_t   cmd_ring[skr_MAX_COMMAND_RING];
 	uint32_t               cmd_ring_index;
+	VkSemaphore            timeline;        // Signaled by every submit from this ring, outlives thread shutdown
+	uint64_t               timeline_value;  // Last value handed to a ring slot
+} _skr_cmd_ring_t;
+
+typedef struct {
+	_skr_cmd_ring_t        graphics;
+	_skr_cmd_ring_t        compute;         // Async compute queue, only created with has_async_compute
+	_skr_cmd_ring_slot_t*  active_cmd;      // Currently recording command buffer, from either ring
+	uint64_t               compute_wait;    // Compute timeline value the next graphics submit waits on, 0 = none
+	skr_future_t           async_graphics;  // Graphics submitted by skr_compute_async_begin, the compute submit waits on it
+	int32_t                async_saved_ref_count;
+	bool                   in_async;        // Between skr_compute_async_begin/end
+	VkSemaphore            consume_waits[SKR_MAX_CONSUME_WAITS]; // Binary semaphores the next graphics submit waits on, then destroys
+	uint32_t               consume_count;
 	uint32_t               thread_idx;
 	int32_t                ref_count;
 	bool                   alive;
 } _skr_vk_thread_t;
 
+// Every graphics ring slot can be waiting to submit at most once
+#define SKR_MAX_PENDING_SUBMITS (skr_MAX_THREAD_POOLS * skr_MAX_COMMAND_RING)
+
+// A finished graphics command buffer waiting for the next batched submit
+typedef struct {
+	VkCommandBuffer      cmd;
+	VkSemaphore          wait;          // Async compute timeline, VK_NULL_HANDLE = none
+	uint64_t             wait_value;
+	VkPipelineStageFlags wait_stage;
+	VkSemaphore          signal;        // Timeline of the ring that recorded it
+	uint64_t             signal_value;
+} _skr_pending_submit_t;
+
+// Graphics command buffers from all threads, submitted together by the next
+// frame end, explicit flush, or wait on one of their futures
+typedef struct {
+	mtx_t                         mutex;
+	_skr_pending_submit_t         pending       [SKR_MAX_PENDING_SUBMITS];
+	VkSubmitInfo                  infos         [SKR_MAX_PENDING_SUBMITS + 1];
+	VkTimelineSemaphoreSubmitInfo timeline_infos[SKR_MAX_PENDING_SUBMITS + 1];
+	uint32_t                      count;
+} _skr_submit_queue_t;
+
+// An old swapchain with its views and semaphores, destroyed once the work
+// submitted before its retirement completes and its frames have passed
+typedef struct {
+	skr_destroy_list_t list;
+	skr_future_t       after;  // Latest submission when it was retired
+	uint32_t           frame;  // Frame after which queued presents are done with it
+} _skr_retired_swapchain_t;
+
 typedef struct {
 	VkInstance               instance;
 	VkPhysicalDevice         physical_device;
@@ -154,15 +378,19 @@ typedef struct {
 	VkQueue                  graphics_queue;
 	VkQueue                  present_queue;
 	VkQueue                  transfer_queue;
+	VkQueue                  compute_queue;          // Dedicated async compute queue, VK_NULL_HANDLE without has_async_compute
 	uint32_t                 graphics_queue_family;
 	uint32_t                 present_queue_family;
 	uint32_t                 transfer_queue_family;
 	uint32_t                 video_decode_queue_family;  // UINT32_MAX if not available
-	mtx_t                    queue_mutexes[SKR_QUEUE_TYPE_COUNT]; // Mutexes for unique queues (graphics, present, transfer, video_decode)
+	uint32_t                 compute_queue_family;       // UINT32_MAX if async compute is off or unavailable
+	uint32_t                 async_queue_families[2];    // Graphics + compute, for VK_SHARING_MODE_CONCURRENT resources
+	mtx_t                    queue_mutexes[SKR_QUEUE_TYPE_COUNT]; // Mutexes for unique queues (graphics, present, transfer, video_decode, compute)
 	mtx_t*                   graphics_queue_mutex;     // Pointer to correct mutex (may alias)
 	mtx_t*                   present_queue_mutex;      // Pointer to correct mutex (may alias)
 	mtx_t*                   transfer_queue_mutex;     // Pointer to correct mutex (may alias)
 	mtx_t*                   video_decode_queue_mutex; // Pointer to correct mutex (may alias, NULL if no video decode)
+	mtx_t*                   compute_queue_mutex;      // NULL without has_async_compute
 	VkCommandPool            command_pool;
 	VkCommandBuffer          command_buffers[SKR_MAX_FRAMES_IN_FLIGHT];
 	VkFence                  frame_fences[SKR_MAX_FRAMES_IN_FLIGHT];
@@ -178,6 +406,11 @@ typedef struct {
 	bool                     has_external_memory_dma_buf; // VK_EXT_external_memory_dma_buf
 	bool                     has_drm_format_modifier;     // VK_EXT_image_drm_format_modifier
 	bool                     has_video_decode;            // VK_KHR_video_decode_queue + related extensions
+	bool                     has_synchronization2;        // VK_KHR_synchronization2, used for batched barriers
+	bool                     has_host_image_copy;         // VK_EXT_host_image_copy with the hostImageCopy feature
+	bool                     has_descriptor_indexing;     // VK_EXT_descriptor_indexing with the features bindless needs
+	VkImageLayout            host_image_copy_layout;      // Layout host image copies write to
+	uint32_t                 unified_memory_types;        // DEVICE_LOCAL|HOST_VISIBLE|HOST_COHERENT types on a large heap (UMA/ReBAR)
 	bool                     initialized;
 
 	// Capability system (runtime-queried feature support)
@@ -192,6 +425,8 @@ typedef struct {
 	// Bind slot configuration
 	skr_bind_settings_t      bind_settings;
 	bool                     in_frame;  // True when between frame_begin and frame_end
+	uint32_t                 hazard_epoch;    // Bumped by full compute barriers, invalidates older skr_hazard_t state
+	bool                     hazard_pending;  // A compute write was recorded since the last full barrier
 	thrd_t                   main_thread_id;  // Thread that calls skr_init
 	uint32_t                 frame;
 	uint32_t                 flight_idx;
@@ -201,6 +436,8 @@ typedef struct {
 	float                    timestamp_period;       // ns per tick
 	uint32_t                 min_ubo_offset_align;   // minUniformBufferOffsetAlignment
 	uint32_t                 min_ssbo_offset_align;  // minStorageBufferOffsetAlignment
+	uint32_t                 non_coherent_atom_size; // nonCoherentAtomSize
+	uint32_t                 max_push_constants;     // maxPushConstantsSize
 	int32_t                  max_msaa_samples;       // Maximum supported MSAA sample count
 	uint64_t                 frame_timestamps[SKR_MAX_FRAMES_IN_FLIGHT][2];  // [frame][start/end]
 	bool                     timestamps_valid[SKR_MAX_FRAMES_IN_FLIGHT];
@@ -211,6 +448,14 @@ typedef struct {
 	uint64_t                 cpu_frame_wait_ns   [SKR_MAX_FRAMES_IN_FLIGHT];  // Accumulated wait time to subtract
 	bool                     cpu_timestamps_valid[SKR_MAX_FRAMES_IN_FLIGHT];
 
+	// Frame pacing, arrays are indexed by flight_idx
+	uint32_t                 frames_in_flight;      // 1 to SKR_MAX_FRAMES_IN_FLIGHT, how far the CPU may run ahead
+	bool                     low_latency;           // skr_renderer_frame_wait waits on the previous frame
+	bool                     frame_waited;          // skr_renderer_frame_wait already ran for the upcoming frame
+	skr_future_t             frame_futures       [SKR_MAX_FRAMES_IN_FLIGHT];  // Submission of each frame
+	uint64_t                 gpu_complete_ns     [SKR_MAX_FRAMES_IN_FLIGHT];  // When the frame was seen finished, 0 = not yet
+	uint64_t                 predicted_latency_ns;  // Smoothed frame begin to GPU complete
+
 	// Current render pass (for pipeline lookup)
 	int32_t                  current_renderpass_idx;
 	skr_tex_t*               current_color_texture;  // Track color texture for layout transitions
@@ -228,8 +473,10 @@ typedef struct {
 
 	// Command system
 	bool                     has_dedicated_transfer;
+	bool                     has_async_compute;     // Dedicated compute queue family, opted in with skr_settings_t.enable_async_compute
 	_skr_vk_thread_t         thread_pools[skr_MAX_THREAD_POOLS];
 	mtx_t                    thread_pool_mutex;
+	_skr_submit_queue_t      submit_queue;
 
 	// Default assets
 	skr_tex_t                default_tex_white;
@@ -239,11 +486,26 @@ typedef struct {
 	// Deferred destruction
 	skr_destroy_list_t       destroy_list;
 
+	// Old swapchains from surface recreation, oldest first
+	_skr_retired_swapchain_t* retired;
+	uint32_t                 retired_count;
+	uint32_t                 retired_capacity;
+
 	// Material bind pool
 	_skr_bind_pool_t         bind_pool;
 
 	// Sampler cache
 	_skr_sampler_cache_t     sampler_cache;
+
+	// Bindless resource tables, layout is VK_NULL_HANDLE when unavailable
+	_skr_bindless_t          bindless;
+
+	// Shared pages for command bump allocators
+	_skr_bump_page_pool_t    bump_page_pool;
+	uint32_t                 bump_shrink_frames;
+
+	// Idle staging buffers for buffer readbacks
+	_skr_readback_pool_t     readback_pool;
 } _skr_vk_t;
 
 extern _skr_vk_t _skr_vk;
@@ -266,31 +528,62 @@ uint64_t              _skr_time_get_ns                      (void);
 // Material descriptor caching. Returns -1 on success, or the failing bind index if a resource is missing.
 int32_t               _skr_material_add_writes              (const skr_material_bind_t* binds, uint32_t bind_ct, const int32_t* ignore_slots, int32_t ignore_ct, VkWriteDescriptorSet* ref_writes, uint32_t write_max, VkDescriptorBufferInfo* ref_buffer_infos, uint32_t buffer_max, VkDescriptorImageInfo* ref_image_infos, uint32_t image_max, uint32_t* ref_write_ct, uint32_t* ref_buffer_ct, uint32_t* ref_image_ct);
 const char*           _skr_material_bind_name               (const sksc_shader_meta_t* meta, int32_t bind_idx);
+bool                  _skr_material_bind_is_tex             (const sksc_shader_meta_t* meta, int32_t bind_idx);  // Bind slot takes a texture
+bool                  _skr_material_bind_is_buffer          (const sksc_shader_meta_t* meta, int32_t bind_idx);  // Bind slot takes a buffer
 
 // Bind pool management
 void                  _skr_bind_pool_init                   (void);
 void                  _skr_bind_pool_shutdown               (void);
 int32_t               _skr_bind_pool_alloc                  (uint32_t count);  // Returns start index, -1 on failure
-void                  _skr_bind_pool_free                   (int32_t start, uint32_t count);
-skr_material_bind_t*  _skr_bind_pool_get                    (int32_t start);   // Get pointer to slot (NULL if invalid)
-void                  _skr_bind_pool_lock                   (void);            // Lock pool for safe pointer access
-void                  _skr_bind_pool_unlock                 (void);            // Unlock pool after done with pointer
+void                  _skr_bind_pool_free                   (int32_t start, uint32_t count);  // Releases one reference
+void                  _skr_bind_pool_ref                    (int32_t start);  // Another reference to an allocated range
+bool                  _skr_bind_pool_shared                 (int32_t start);  // More than one material references the range
+skr_material_bind_t*  _skr_bind_pool_get                    (int32_t start);   // Get pointer to slot (NULL if invalid), lock free
+
+// Persistent material descriptor sets (non-push-descriptor fallback)
+bool                  _skr_material_sets_init               (void);
+void                  _skr_material_sets_invalidate         (const uint64_t* handles, uint32_t count); // Views or buffers went away, drop the sets that reference them
+void                  _skr_material_sets_release            (VkDescriptorSet set);
+VkDescriptorType      _skr_material_dynamic_type            (uint32_t binding, VkDescriptorType type);  // Per-draw slots become dynamic without push descriptors
+void                  _skr_bind_material_descriptors        (VkCommandBuffer cmd, VkDescriptorPool pool, VkPipelineBindPoint bind_point, int32_t pipeline_material_idx, int32_t bind_start, VkWriteDescriptorSet* writes, uint32_t write_count);  // bind_start < 0 skips the set cache
 
 // Sampler cache management
 void                  _skr_sampler_cache_init               (void);
 void                  _skr_sampler_cache_shutdown           (void);
-VkSampler             _skr_sampler_cache_acquire            (skr_tex_sampler_t settings);  // Get or create sampler, increment ref
-void                  _skr_sampler_cache_release            (skr_tex_sampler_t settings);  // Decrement ref, destroy if zero
+VkSampler             _skr_sampler_cache_acquire            (skr_tex_sampler_t settings);  // Get or create sampler, it lives until shutdown
+
+// Bindless resource tables
+bool                  _skr_bindless_init                    (void);
+void                  _skr_bindless_shutdown                (void);
+bool                  _skr_bindless_available               (void);
+uint32_t              _skr_bindless_tex_index               (skr_tex_t*    ref_tex);     // Registers on first use, 0 (white) on failure
+uint32_t              _skr_bindless_buffer_index            (skr_buffer_t* ref_buffer);  // Registers on first use, 0 on failure
+void                  _skr_bindless_tex_update              (const skr_tex_t* tex);      // Rewrite a registered texture's descriptor as frames in flight finish
+void                  _skr_bindless_frame_begin             (uint32_t flight_idx);       // Apply rewrites to the set the finished frame slot was using
+void                  _skr_bindless_free                    (bool is_buffer, uint32_t index);
+void                  _skr_bindless_bind                    (VkCommandBuffer cmd, VkPipelineBindPoint bind_point, VkPipelineLayout layout);
+VkPipelineLayout      _skr_bindless_create_layout           (VkDescriptorSetLayout opt_descriptor_layout, VkPushConstantRange push_range);  // push_range.size 0 for none
+
+// Readback staging pool management
+void                  _skr_readback_pool_init               (void);
+void                  _skr_readback_pool_shutdown           (void);
 
 // Bump allocator management
+void                  _skr_bump_pool_init                   (void);
+void                  _skr_bump_pool_shutdown               (void);  // Call after all bump allocators are destroyed
 void                  _skr_bump_alloc_init                  (skr_bump_alloc_t* ref_alloc, skr_buffer_type_ type, uint32_t alignment);
 void                  _skr_bump_alloc_destroy               (skr_bump_alloc_t* ref_alloc);
-void                  _skr_bump_alloc_reset                 (skr_bump_alloc_t* ref_alloc);  // Call at frame start: resize main buffer, clean overflow
+void                  _skr_bump_alloc_reset                 (skr_bump_alloc_t* ref_alloc);  // Call once the GPU is done: rewind, merge or shrink pages
 skr_bump_result_t     _skr_bump_alloc_write                 (skr_bump_alloc_t* ref_alloc, const void* data, uint32_t size);  // Allocate + write, returns buffer+offset
 
 // Render list sorting
 void                  _skr_render_list_sort                 (skr_render_list_t* ref_list);
 
+// Render passes with explicit attachment ops, and without the eager
+// shader-read transition at the end, for the render graph
+void                  _skr_renderer_begin_pass              (skr_tex_t* color, skr_tex_t* depth, skr_tex_t* opt_resolve, skr_clear_ clear, skr_vec4_t clear_color, float clear_depth, uint32_t clear_stencil, VkAttachmentLoadOp color_load_op, VkAttachmentLoadOp depth_load_op, VkAttachmentStoreOp depth_store_op);
+void                  _skr_renderer_end_pass                (bool to_shader_read);
+
 // Debug
 void                  _skr_set_debug_name                   (VkDevice device, VkObjectType type, uint64_t handle, const char* name);
 void                  _skr_append_vertex_format             (char* ref_str, size_t str_size, const skr_vert_component_t* components, uint32_t component_count);
@@ -307,16 +600,38 @@ void                  _skr_tex_transition_notify_layout     (      skr_tex_t* re
 bool                  _skr_tex_needs_transition             (const skr_tex_t*     tex, uint8_t type); // Check if texture needs transition for given type (0=shader_read, 1=storage)
 void                  _skr_tex_transition_enqueue           (      skr_tex_t* ref_tex, uint8_t type); // Deferred texture transition queue (to avoid in-renderpass barriers) type: 0=shader_read, 1=storage
 
+// Two-step texture creation, so the render graph can place images in shared memory
+skr_err_              _skr_tex_create_unbound               (skr_tex_fmt_ format, skr_tex_flags_ flags, skr_tex_sampler_t sampler, skr_vec3i_t size, int32_t multisample, int32_t mip_count, bool has_data, skr_tex_t* out_tex, bool* out_lazy_memory, bool* out_host_upload);
+skr_err_              _skr_tex_bind_memory                  (      skr_tex_t* ref_tex, VkDeviceMemory memory, VkDeviceSize offset);
+uint32_t              _skr_tex_find_memory_type             (VkMemoryRequirements requirements, bool is_transient_attachment);  // UINT32_MAX if none fits
+
+// Barrier batching, cmd must be the thread's active command buffer or the
+// barrier is emitted immediately
+void                  _skr_barrier_image                    (VkCommandBuffer cmd, VkImage image, VkImageAspectFlags aspect_mask, uint32_t base_mip, uint32_t mip_count, uint32_t layer_count, VkImageLayout old_layout, VkImageLayout new_layout, VkPipelineStageFlags src_stage, VkPipelineStageFlags dst_stage, VkAccessFlags src_access, VkAccessFlags dst_access);
+void                  _skr_barrier_buffer                   (VkCommandBuffer cmd, VkBuffer buffer, VkDeviceSize offset, VkDeviceSize size, VkPipelineStageFlags src_stage, VkPipelineStageFlags dst_stage, VkAccessFlags src_access, VkAccessFlags dst_access);
+void                  _skr_barrier_memory                   (VkCommandBuffer cmd, VkPipelineStageFlags src_stage, VkPipelineStageFlags dst_stage, VkAccessFlags src_access, VkAccessFlags dst_access);
+void                  _skr_barrier_flush                    (VkCommandBuffer cmd);  // Call before any command that reads or writes a barriered resource
+
+// Compute hazard tracking
+void                  _skr_hazard_access                    (VkCommandBuffer cmd, skr_hazard_t* ref_hazard, VkPipelineStageFlags stage, VkAccessFlags access, bool write);  // Barriers against pending access, before the command
+void                  _skr_hazard_record                    (skr_hazard_t* ref_hazard, VkPipelineStageFlags stage, VkAccessFlags access, bool write);  // Tracks the command's own access, after it
+void                  _skr_hazard_resolve_all               (VkCommandBuffer cmd);  // One barrier against every pending compute write, for draws
+
 // Command buffer management
 bool                  _skr_cmd_init                         (void);
 void                  _skr_cmd_shutdown                     (void);
 _skr_vk_thread_t*     _skr_cmd_get_thread                   (void);
 _skr_cmd_ctx_t        _skr_cmd_begin                        (void);
 bool                  _skr_cmd_try_get_active               (_skr_cmd_ctx_t* out_ctx);
-VkCommandBuffer       _skr_cmd_end                          (void);  // Ends and returns command buffer (caller must submit)
 skr_future_t          _skr_cmd_end_submit                   (const VkSemaphore* wait_semaphores, uint32_t wait_count, const VkSemaphore* signal_semaphores, uint32_t signal_count);  // Ends and submits, returns future
+void                  _skr_cmd_consume_semaphore            (VkSemaphore semaphore);  // Next graphics submit waits on a stray binary semaphore, then destroys it
 _skr_cmd_ctx_t        _skr_cmd_acquire                      (void);
 void                  _skr_cmd_release                      (VkCommandBuffer buffer);
+void                  _skr_cmd_submit_pending               (void);  // Submits every queued graphics command buffer now
+
+// Swapchain retirement, destroys retired swapchain resources when safe, or
+// waits until they are
+void                  _skr_surface_collect_retired          (bool wait);
 
 // Deferred destruction API
 skr_destroy_list_t    _skr_destroy_list_create              (void);
@@ -349,6 +664,9 @@ void                  _skr_cmd_destroy_ycbcr_conversion     (skr_destroy_list_t*
 
 // Custom deferred destruction (non-Vulkan types)
 void                  _skr_cmd_destroy_bind_pool_slots      (skr_destroy_list_t* opt_ref_list, int32_t start, uint32_t count);
+void                  _skr_cmd_destroy_bindless_slot        (skr_destroy_list_t* opt_ref_list, bool is_buffer, uint32_t index);
+void                  _skr_cmd_destroy_material_set         (skr_destroy_list_t* opt_ref_list, VkDescriptorSet set);
+void                  _skr_cmd_destroy_shader_meta          (skr_destroy_list_t* opt_ref_list, sksc_shader_meta_t* meta);  // Releases one reference
 
 // Descriptor helper (allocates and binds descriptor set, handles push descriptors vs fallback)
 void                  _skr_bind_descriptors                 (VkCommandBuffer cmd, VkDescriptorPool pool, VkPipelineBindPoint bind_point, VkPipelineLayout layout, VkDescriptorSetLayout desc_layout, VkWriteDescriptorSet* writes, uint32_t write_count);
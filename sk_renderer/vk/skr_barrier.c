@@ -0,0 +1,324 @@
+// SPDX-License-Identifier: MIT
+// The authors below grant copyright rights under the MIT license:
+// Copyright (c) 2025 Nick Klingensmith
+// Copyright (c) 2025 Qualcomm Technologies, Inc.
+
+#include "_sk_renderer.h"
+
+#include <string.h>
+
+///////////////////////////////////////////////////////////////////////////////
+// Barrier batching
+//
+// Layout transitions and memory dependencies are collected per command
+// buffer and emitted as a single barrier call right before the next command
+// that needs them. Binding a material with a dozen textures then costs one
+// barrier instead of a dozen, which matters most on tile-based GPUs.
+//
+// Image barriers are found through a small hash on the VkImage, so a texture
+// transitioned twice before a flush (A->B then B->C) collapses to A->C.
+///////////////////////////////////////////////////////////////////////////////
+
+static _skr_barrier_batch_t* _skr_barrier_get_batch(VkCommandBuffer cmd) {
+	_skr_vk_thread_t* thread = _skr_cmd_get_thread();
+	if (!thread || !thread->active_cmd || thread->active_cmd->cmd != cmd) return NULL;
+	return &thread->active_cmd->barriers;
+}
+
+static uint32_t _skr_barrier_hash(VkImage image) {
+	uint64_t h = (uint64_t)image * 0x9E3779B97F4A7C15ull;
+	return (uint32_t)(h >> 32) & (SKR_BARRIER_HASH_SIZE - 1);
+}
+
+static bool _skr_barrier_mips_overlap(const _skr_image_barrier_t* a, uint32_t base_mip, uint32_t mip_count) {
+	return a->base_mip < base_mip + mip_count && base_mip < a->base_mip + a->mip_count;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+static void _skr_barrier_emit_legacy(VkCommandBuffer cmd, const _skr_barrier_batch_t* batch) {
+	VkImageMemoryBarrier  images [SKR_BARRIER_MAX_IMAGES];
+	VkBufferMemoryBarrier buffers[SKR_BARRIER_MAX_BUFFERS];
+	VkPipelineStageFlags  src_stage = batch->memory_src_stage;
+	VkPipelineStageFlags  dst_stage = batch->memory_dst_stage;
+
+	for (uint32_t i = 0; i < batch->image_count; i++) {
+		const _skr_image_barrier_t* b = &batch->images[i];
+		src_stage |= b->src_stage;
+		dst_stage |= b->dst_stage;
+		images[i] = (VkImageMemoryBarrier){
+			.sType               = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER,
+			.srcAccessMask       = b->src_access,
+			.dstAccessMask       = b->dst_access,
+			.oldLayout           = b->old_layout,
+			.newLayout           = b->new_layout,
+			.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED,
+			.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED,
+			.image               = b->image,
+			.subresourceRange    = { b->aspect_mask, b->base_mip, b->mip_count, 0, b->layer_count },
+		};
+	}
+	for (uint32_t i = 0; i < batch->buffer_count; i++) {
+		const _skr_buffer_barrier_t* b = &batch->buffers[i];
+		src_stage |= b->src_stage;
+		dst_stage |= b->dst_stage;
+		buffers[i] = (VkBufferMemoryBarrier){
+			.sType               = VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER,
+			.srcAccessMask       = b->src_access,
+			.dstAccessMask       = b->dst_access,
+			.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED,
+			.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED,
+			.buffer              = b->buffer,
+			.offset              = b->offset,
+			.size                = b->size,
+		};
+	}
+
+	// The legacy call shares one stage mask across every barrier
+	bool has_memory = batch->memory_src_stage != 0;
+	vkCmdPipelineBarrier(cmd, src_stage, dst_stage, 0,
+		has_memory ? 1 : 0, &(VkMemoryBarrier){
+			.sType         = VK_STRUCTURE_TYPE_MEMORY_BARRIER,
+			.srcAccessMask = batch->memory_src_access,
+			.dstAccessMask = batch->memory_dst_access,
+		},
+		batch->buffer_count, buffers,
+		batch->image_count,  images);
+}
+
+static void _skr_barrier_emit_sync2(VkCommandBuffer cmd, const _skr_barrier_batch_t* batch) {
+	VkImageMemoryBarrier2KHR  images [SKR_BARRIER_MAX_IMAGES];
+	VkBufferMemoryBarrier2KHR buffers[SKR_BARRIER_MAX_BUFFERS];
+
+	// Legacy stage and access bits share their values with the *2 flags, so
+	// each barrier keeps its own precise stages.
+	for (uint32_t i = 0; i < batch->image_count; i++) {
+		const _skr_image_barrier_t* b = &batch->images[i];
+		images[i] = (VkImageMemoryBarrier2KHR){
+			.sType               = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER_2_KHR,
+			.srcStageMask        = b->src_stage,
+			.srcAccessMask       = b->src_access,
+			.dstStageMask        = b->dst_stage,
+			.dstAccessMask       = b->dst_access,
+			.oldLayout           = b->old_layout,
+			.newLayout           = b->new_layout,
+			.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED,
+			.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED,
+			.image               = b->image,
+			.subresourceRange    = { b->aspect_mask, b->base_mip, b->mip_count, 0, b->layer_count },
+		};
+	}
+	for (uint32_t i = 0; i < batch->buffer_count; i++) {
+		const _skr_buffer_barrier_t* b = &batch->buffers[i];
+		buffers[i] = (VkBufferMemoryBarrier2KHR){
+			.sType               = VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER_2_KHR,
+			.srcStageMask        = b->src_stage,
+			.srcAccessMask       = b->src_access,
+			.dstStageMask        = b->dst_stage,
+			.dstAccessMask       = b->dst_access,
+			.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED,
+			.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED,
+			.buffer              = b->buffer,
+			.offset              = b->offset,
+			.size                = b->size,
+		};
+	}
+
+	bool has_memory = batch->memory_src_stage != 0;
+	vkCmdPipelineBarrier2KHR(cmd, &(VkDependencyInfoKHR){
+		.sType                    = VK_STRUCTURE_TYPE_DEPENDENCY_INFO_KHR,
+		.memoryBarrierCount       = has_memory ? 1 : 0,
+		.pMemoryBarriers          = &(VkMemoryBarrier2KHR){
+			.sType         = VK_STRUCTURE_TYPE_MEMORY_BARRIER_2_KHR,
+			.srcStageMask  = batch->memory_src_stage,
+			.srcAccessMask = batch->memory_src_access,
+			.dstStageMask  = batch->memory_dst_stage,
+			.dstAccessMask = batch->memory_dst_access,
+		},
+		.bufferMemoryBarrierCount = batch->buffer_count,
+		.pBufferMemoryBarriers    = buffers,
+		.imageMemoryBarrierCount  = batch->image_count,
+		.pImageMemoryBarriers     = images,
+	});
+}
+
+static void _skr_barrier_flush_batch(VkCommandBuffer cmd, _skr_barrier_batch_t* ref_batch) {
+	if (ref_batch->image_count == 0 && ref_batch->buffer_count == 0 && ref_batch->memory_src_stage == 0)
+		return;
+
+	if (_skr_vk.has_synchronization2) _skr_barrier_emit_sync2 (cmd, ref_batch);
+	else                              _skr_barrier_emit_legacy(cmd, ref_batch);
+
+	if (ref_batch->image_count > 0)
+		memset(ref_batch->image_hash, 0, sizeof(ref_batch->image_hash));
+	ref_batch->image_count       = 0;
+	ref_batch->buffer_count      = 0;
+	ref_batch->memory_src_stage  = 0;
+	ref_batch->memory_dst_stage  = 0;
+	ref_batch->memory_src_access = 0;
+	ref_batch->memory_dst_access = 0;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+void _skr_barrier_flush(VkCommandBuffer cmd) {
+	_skr_barrier_batch_t* batch = _skr_barrier_get_batch(cmd);
+	if (batch) _skr_barrier_flush_batch(cmd, batch);
+}
+
+void _skr_barrier_image(VkCommandBuffer cmd, VkImage image, VkImageAspectFlags aspect_mask, uint32_t base_mip, uint32_t mip_count, uint32_t layer_count, VkImageLayout old_layout, VkImageLayout new_layout, VkPipelineStageFlags src_stage, VkPipelineStageFlags dst_stage, VkAccessFlags src_access, VkAccessFlags dst_access) {
+	_skr_image_barrier_t barrier = {
+		.image       = image,
+		.aspect_mask = aspect_mask,
+		.base_mip    = base_mip,
+		.mip_count   = mip_count,
+		.layer_count = layer_count,
+		.old_layout  = old_layout,
+		.new_layout  = new_layout,
+		.src_stage   = src_stage,
+		.dst_stage   = dst_stage,
+		.src_access  = src_access,
+		.dst_access  = dst_access,
+	};
+
+	_skr_barrier_batch_t* batch = _skr_barrier_get_batch(cmd);
+	if (!batch) {
+		_skr_barrier_batch_t single = { .image_count = 1 };
+		single.images[0] = barrier;
+		_skr_barrier_flush_batch(cmd, &single);
+		return;
+	}
+
+	// Look for a pending barrier on the same image. Identical ranges that
+	// chain (A->B, B->C) merge into one, other overlapping ranges can't share
+	// a barrier call since their order would be undefined.
+	uint32_t slot = _skr_barrier_hash(image);
+	while (batch->image_hash[slot] != 0) {
+		_skr_image_barrier_t* pending = &batch->images[batch->image_hash[slot] - 1];
+		if (pending->image == image && _skr_barrier_mips_overlap(pending, base_mip, mip_count)) {
+			if (pending->base_mip    == base_mip  &&
+				pending->mip_count   == mip_count &&
+				pending->layer_count == layer_count &&
+				pending->new_layout  == old_layout) {
+				pending->new_layout = new_layout;
+				pending->dst_stage  = dst_stage;
+				pending->dst_access = dst_access;
+				return;
+			}
+			_skr_barrier_flush_batch(cmd, batch);
+			slot = _skr_barrier_hash(image);
+			break;
+		}
+		slot = (slot + 1) & (SKR_BARRIER_HASH_SIZE - 1);
+	}
+
+	if (batch->image_count == SKR_BARRIER_MAX_IMAGES) {
+		_skr_barrier_flush_batch(cmd, batch);
+		slot = _skr_barrier_hash(image);
+	}
+
+	batch->images[batch->image_count++] = barrier;
+	batch->image_hash[slot]             = (uint8_t)batch->image_count;
+}
+
+void _skr_barrier_buffer(VkCommandBuffer cmd, VkBuffer buffer, VkDeviceSize offset, VkDeviceSize size, VkPipelineStageFlags src_stage, VkPipelineStageFlags dst_stage, VkAccessFlags src_access, VkAccessFlags dst_access) {
+	_skr_buffer_barrier_t barrier = {
+		.buffer     = buffer,
+		.offset     = offset,
+		.size       = size,
+		.src_stage  = src_stage,
+		.dst_stage  = dst_stage,
+		.src_access = src_access,
+		.dst_access = dst_access,
+	};
+
+	_skr_barrier_batch_t* batch = _skr_barrier_get_batch(cmd);
+	if (!batch) {
+		_skr_barrier_batch_t single = { .buffer_count = 1 };
+		single.buffers[0] = barrier;
+		_skr_barrier_flush_batch(cmd, &single);
+		return;
+	}
+
+	if (batch->buffer_count == SKR_BARRIER_MAX_BUFFERS)
+		_skr_barrier_flush_batch(cmd, batch);
+	batch->buffers[batch->buffer_count++] = barrier;
+}
+
+void _skr_barrier_memory(VkCommandBuffer cmd, VkPipelineStageFlags src_stage, VkPipelineStageFlags dst_stage, VkAccessFlags src_access, VkAccessFlags dst_access) {
+	_skr_barrier_batch_t* batch = _skr_barrier_get_batch(cmd);
+	if (!batch) {
+		_skr_barrier_flush_batch(cmd, &(_skr_barrier_batch_t){
+			.memory_src_stage  = src_stage,
+			.memory_dst_stage  = dst_stage,
+			.memory_src_access = src_access,
+			.memory_dst_access = dst_access,
+		});
+		return;
+	}
+
+	// A single global memory barrier covers every dependency merged into it
+	batch->memory_src_stage  |= src_stage;
+	batch->memory_dst_stage  |= dst_stage;
+	batch->memory_src_access |= src_access;
+	batch->memory_dst_access |= dst_access;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Compute hazard tracking
+//
+// Compute dispatches don't end with a barrier. Instead, storage buffers and
+// images remember their last unsynchronized write (and reads since), and the
+// next command touching them adds exactly the barrier it needs. Back-to-back
+// dispatches on disjoint resources then run without draining the GPU.
+//
+// Draws don't track their bindings, so a render pass resolves every pending
+// write at once and bumps the epoch, which retires all older hazard state.
+///////////////////////////////////////////////////////////////////////////////
+
+void _skr_hazard_access(VkCommandBuffer cmd, skr_hazard_t* ref_hazard, VkPipelineStageFlags stage, VkAccessFlags access, bool write) {
+	if (ref_hazard->epoch != _skr_vk.hazard_epoch) {
+		*ref_hazard = (skr_hazard_t){ .epoch = _skr_vk.hazard_epoch };
+		return;
+	}
+
+	if (ref_hazard->write_stage != 0) {
+		// Read/write after write: make the earlier write visible
+		_skr_barrier_memory(cmd, ref_hazard->write_stage, stage, ref_hazard->write_access, access);
+		ref_hazard->write_stage  = 0;
+		ref_hazard->write_access = 0;
+		ref_hazard->read_stage   = 0;
+	} else if (write && ref_hazard->read_stage != 0) {
+		// Write after read: execution dependency only
+		_skr_barrier_memory(cmd, ref_hazard->read_stage, stage, 0, 0);
+		ref_hazard->read_stage = 0;
+	}
+}
+
+void _skr_hazard_record(skr_hazard_t* ref_hazard, VkPipelineStageFlags stage, VkAccessFlags access, bool write) {
+	if (ref_hazard->epoch != _skr_vk.hazard_epoch)
+		*ref_hazard = (skr_hazard_t){ .epoch = _skr_vk.hazard_epoch };
+
+	if (write) {
+		ref_hazard->write_stage  = stage;
+		ref_hazard->write_access = access & (VK_ACCESS_SHADER_WRITE_BIT | VK_ACCESS_TRANSFER_WRITE_BIT);
+		ref_hazard->read_stage   = 0;
+		_skr_vk.hazard_pending   = true;
+	} else {
+		ref_hazard->read_stage |= stage;
+	}
+}
+
+void _skr_hazard_resolve_all(VkCommandBuffer cmd) {
+	if (!_skr_vk.hazard_pending) return;
+
+	_skr_barrier_memory(cmd,
+		VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT,
+		VK_PIPELINE_STAGE_DRAW_INDIRECT_BIT | VK_PIPELINE_STAGE_VERTEX_INPUT_BIT | VK_PIPELINE_STAGE_VERTEX_SHADER_BIT |
+		VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT | VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT | VK_PIPELINE_STAGE_TRANSFER_BIT,
+		VK_ACCESS_SHADER_WRITE_BIT,
+		VK_ACCESS_INDIRECT_COMMAND_READ_BIT | VK_ACCESS_INDEX_READ_BIT | VK_ACCESS_VERTEX_ATTRIBUTE_READ_BIT |
+		VK_ACCESS_UNIFORM_READ_BIT | VK_ACCESS_SHADER_READ_BIT | VK_ACCESS_SHADER_WRITE_BIT | VK_ACCESS_TRANSFER_READ_BIT);
+	_skr_vk.hazard_epoch++;
+	_skr_vk.hazard_pending = false;
+}
@@ -0,0 +1,354 @@
+// SPDX-License-Identifier: MIT
+// The authors below grant copyright rights under the MIT license:
+// Copyright (c) 2025 Nick Klingensmith
+// Copyright (c) 2025 Qualcomm Technologies, Inc.
+
+#include "_sk_renderer.h"
+
+#include <stdio.h>
+#include <string.h>
+
+///////////////////////////////////////////////////////////////////////////////
+// Bindless resource tables
+//
+// With VK_EXT_descriptor_indexing, every texture and storage buffer a
+// bindless shader touches lives in a global update-after-bind descriptor
+// set, bound at set SKSC_BINDLESS_SPACE. Materials only store indices into
+// it in their parameter data, so draws with these shaders skip per-material
+// descriptor writes, and differing materials can share an instanced draw.
+//
+// Indices are handed out lazily the first time a resource is asked for one,
+// and only return to the free list once the GPU is done with the resource.
+// Texture index 0 is always the default white texture.
+//
+// Indices live in param data the renderer doesn't track, so they have to
+// stay put for a resource's whole life. Changing what a slot holds (a new
+// sampler) would race frames in flight that sample it, so there's a copy of
+// the set per frame slot, and each copy is rewritten once its frame is done.
+///////////////////////////////////////////////////////////////////////////////
+
+#define SKR_BINDLESS_MAX_TEXTURES 4096
+#define SKR_BINDLESS_MAX_BUFFERS  1024
+
+#define SKR_BINDLESS_BIND_TEXTURES (SKR_BIND_SHIFT_TEXTURE + 0)  // register(t0, space1)
+#define SKR_BINDLESS_BIND_BUFFERS  (SKR_BIND_SHIFT_TEXTURE + 1)  // register(t1, space1)
+
+static bool _skr_bindless_slots_init(_skr_bindless_slots_t* ref_slots, uint32_t capacity) {
+	*ref_slots = (_skr_bindless_slots_t){
+		.free     = _skr_malloc(capacity * sizeof(uint32_t)),
+		.capacity = capacity,
+	};
+	return ref_slots->free != NULL;
+}
+
+static int32_t _skr_bindless_slots_alloc(_skr_bindless_slots_t* ref_slots) {
+	if (ref_slots->free_count > 0)             return (int32_t)ref_slots->free[--ref_slots->free_count];
+	if (ref_slots->next < ref_slots->capacity) return (int32_t)ref_slots->next++;
+	return -1;
+}
+
+bool _skr_bindless_init(void) {
+	_skr_bindless_t* bl = &_skr_vk.bindless;
+	*bl = (_skr_bindless_t){0};
+	if (!_skr_vk.has_descriptor_indexing) return false;
+	mtx_init(&bl->mutex, mtx_plain);
+
+	VkPhysicalDeviceDescriptorIndexingPropertiesEXT indexing_props = {
+		.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_INDEXING_PROPERTIES_EXT,
+	};
+	vkGetPhysicalDeviceProperties2(_skr_vk.physical_device, &(VkPhysicalDeviceProperties2){
+		.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PROPERTIES_2,
+		.pNext = &indexing_props,
+	});
+	// Per-stage limits cover the material's own set too, so leave it some room
+	const uint32_t headroom = 32;
+	uint32_t tex_limit = indexing_props.maxPerStageDescriptorUpdateAfterBindSampledImages;
+	if (tex_limit > indexing_props.maxPerStageDescriptorUpdateAfterBindSamplers) tex_limit = indexing_props.maxPerStageDescriptorUpdateAfterBindSamplers;
+	uint32_t buf_limit = indexing_props.maxPerStageDescriptorUpdateAfterBindStorageBuffers;
+	uint32_t tex_count = SKR_BINDLESS_MAX_TEXTURES;
+	uint32_t buf_count = SKR_BINDLESS_MAX_BUFFERS;
+	if (tex_count + headroom > tex_limit) tex_count = tex_limit > headroom ? tex_limit - headroom : 0;
+	if (buf_count + headroom > buf_limit) buf_count = buf_limit > headroom ? buf_limit - headroom : 0;
+	if (tex_count == 0 || buf_count == 0) {
+		skr_log(skr_log_info, "Descriptor indexing limits too low for bindless tables");
+		return false;
+	}
+
+	// Slots are written while other slots are in use by frames in flight
+	const VkDescriptorBindingFlagsEXT table_flags =
+		VK_DESCRIPTOR_BINDING_UPDATE_AFTER_BIND_BIT_EXT          |
+		VK_DESCRIPTOR_BINDING_UPDATE_UNUSED_WHILE_PENDING_BIT_EXT |
+		VK_DESCRIPTOR_BINDING_PARTIALLY_BOUND_BIT_EXT;
+	const VkDescriptorBindingFlagsEXT binding_flags[2] = { table_flags, table_flags };
+	const VkShaderStageFlags stages = VK_SHADER_STAGE_VERTEX_BIT | VK_SHADER_STAGE_FRAGMENT_BIT | VK_SHADER_STAGE_COMPUTE_BIT;
+	const VkDescriptorSetLayoutBinding bindings[2] = {
+		{ .binding = SKR_BINDLESS_BIND_TEXTURES, .descriptorType = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER, .descriptorCount = tex_count, .stageFlags = stages },
+		{ .binding = SKR_BINDLESS_BIND_BUFFERS,  .descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER,         .descriptorCount = buf_count, .stageFlags = stages },
+	};
+	VkResult vr = vkCreateDescriptorSetLayout(_skr_vk.device, &(VkDescriptorSetLayoutCreateInfo){
+		.sType        = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO,
+		.pNext        = &(VkDescriptorSetLayoutBindingFlagsCreateInfoEXT){
+			.sType         = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_BINDING_FLAGS_CREATE_INFO_EXT,
+			.bindingCount  = 2,
+			.pBindingFlags = binding_flags,
+		},
+		.flags        = VK_DESCRIPTOR_SET_LAYOUT_CREATE_UPDATE_AFTER_BIND_POOL_BIT_EXT,
+		.bindingCount = 2,
+		.pBindings    = bindings,
+	}, NULL, &bl->layout);
+	SKR_VK_CHECK_RET(vr, "vkCreateDescriptorSetLayout", false);
+
+	// Bindless shaders with no other bindings still need something at set 0
+	vr = vkCreateDescriptorSetLayout(_skr_vk.device, &(VkDescriptorSetLayoutCreateInfo){
+		.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO,
+	}, NULL, &bl->empty_layout);
+	SKR_VK_CHECK_RET(vr, "vkCreateDescriptorSetLayout", false);
+
+	const VkDescriptorPoolSize pool_sizes[2] = {
+		{ .type = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER, .descriptorCount = tex_count * SKR_MAX_FRAMES_IN_FLIGHT },
+		{ .type = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER,         .descriptorCount = buf_count * SKR_MAX_FRAMES_IN_FLIGHT },
+	};
+	vr = vkCreateDescriptorPool(_skr_vk.device, &(VkDescriptorPoolCreateInfo){
+		.sType         = VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO,
+		.flags         = VK_DESCRIPTOR_POOL_CREATE_UPDATE_AFTER_BIND_BIT_EXT,
+		.maxSets       = SKR_MAX_FRAMES_IN_FLIGHT,
+		.poolSizeCount = 2,
+		.pPoolSizes    = pool_sizes,
+	}, NULL, &bl->pool);
+	SKR_VK_CHECK_RET(vr, "vkCreateDescriptorPool", false);
+
+	VkDescriptorSetLayout set_layouts[SKR_MAX_FRAMES_IN_FLIGHT];
+	for (uint32_t i = 0; i < SKR_MAX_FRAMES_IN_FLIGHT; i++) set_layouts[i] = bl->layout;
+	vr = vkAllocateDescriptorSets(_skr_vk.device, &(VkDescriptorSetAllocateInfo){
+		.sType              = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO,
+		.descriptorPool     = bl->pool,
+		.descriptorSetCount = SKR_MAX_FRAMES_IN_FLIGHT,
+		.pSetLayouts        = set_layouts,
+	}, bl->sets);
+	SKR_VK_CHECK_RET(vr, "vkAllocateDescriptorSets", false);
+
+	_skr_set_debug_name(_skr_vk.device, VK_OBJECT_TYPE_DESCRIPTOR_SET_LAYOUT, (uint64_t)bl->layout, "bindless_layout");
+	for (uint32_t i = 0; i < SKR_MAX_FRAMES_IN_FLIGHT; i++) {
+		char name[32];
+		snprintf(name, sizeof(name), "bindless_set_%u", i);
+		_skr_set_debug_name(_skr_vk.device, VK_OBJECT_TYPE_DESCRIPTOR_SET, (uint64_t)bl->sets[i], name);
+	}
+
+	if (!_skr_bindless_slots_init(&bl->textures, tex_count) ||
+	    !_skr_bindless_slots_init(&bl->buffers,  buf_count)) {
+		skr_log(skr_log_critical, "Failed to allocate bindless tables");
+		return false;
+	}
+
+	skr_log(skr_log_info, "Bindless tables enabled: %u textures, %u storage buffers", tex_count, buf_count);
+	return true;
+}
+
+void _skr_bindless_shutdown(void) {
+	_skr_bindless_t* bl = &_skr_vk.bindless;
+	if (!_skr_vk.has_descriptor_indexing) return;
+
+	vkDestroyDescriptorPool     (_skr_vk.device, bl->pool,         NULL);
+	vkDestroyDescriptorSetLayout(_skr_vk.device, bl->layout,       NULL);
+	vkDestroyDescriptorSetLayout(_skr_vk.device, bl->empty_layout, NULL);
+	mtx_destroy(&bl->mutex);
+	_skr_free(bl->textures.free);
+	_skr_free(bl->buffers .free);
+	_skr_free(bl->rewrites);
+	*bl = (_skr_bindless_t){0};
+}
+
+bool _skr_bindless_available(void) {
+	return _skr_vk.bindless.sets[0] != VK_NULL_HANDLE;
+}
+
+static VkDescriptorImageInfo _skr_bindless_tex_info(const skr_tex_t* tex) {
+	return (VkDescriptorImageInfo){
+		.sampler     = tex->sampler,
+		.imageView   = tex->view,
+		.imageLayout = (tex->flags & skr_tex_flags_compute)
+			? VK_IMAGE_LAYOUT_GENERAL
+			: VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL,
+	};
+}
+
+static void _skr_bindless_write_tex(VkDescriptorSet set, uint32_t index, const VkDescriptorImageInfo* info) {
+	vkUpdateDescriptorSets(_skr_vk.device, 1, &(VkWriteDescriptorSet){
+		.sType           = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET,
+		.dstSet          = set,
+		.dstBinding      = SKR_BINDLESS_BIND_TEXTURES,
+		.dstArrayElement = index,
+		.descriptorCount = 1,
+		.descriptorType  = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER,
+		.pImageInfo      = info,
+	}, 0, NULL);
+}
+
+// Caller holds the lock
+static void _skr_bindless_drop_rewrites(uint32_t index) {
+	_skr_bindless_t* bl = &_skr_vk.bindless;
+	for (uint32_t i = 0; i < bl->rewrite_count; ) {
+		if (bl->rewrites[i].index == index) bl->rewrites[i] = bl->rewrites[--bl->rewrite_count];
+		else                                i++;
+	}
+}
+
+uint32_t _skr_bindless_tex_index(skr_tex_t* ref_tex) {
+	if (!ref_tex || !_skr_bindless_available()) return 0;
+	if (ref_tex->bindless_slot != 0) return ref_tex->bindless_slot - 1;
+
+	// The table is an array of Texture2D with regular samplers, and transient
+	// attachments can't be sampled at all
+	if (ref_tex->is_transient_discard || ref_tex->layer_count > 1 || ref_tex->ycbcr_conversion != VK_NULL_HANDLE ||
+	    (ref_tex->flags & (skr_tex_flags_array | skr_tex_flags_3d | skr_tex_flags_cubemap))) {
+		skr_log(skr_log_warning, "Bindless table only holds sampleable 2D textures, using white");
+		return 0;
+	}
+
+	_skr_bindless_t* bl = &_skr_vk.bindless;
+	mtx_lock(&bl->mutex);
+	if (ref_tex->bindless_slot == 0) {
+		int32_t index = _skr_bindless_slots_alloc(&bl->textures);
+		if (index >= 0) {
+			// Fresh or freed slots aren't read by anything pending, so every
+			// set can take the descriptor right away
+			VkDescriptorImageInfo info = _skr_bindless_tex_info(ref_tex);
+			for (uint32_t i = 0; i < SKR_MAX_FRAMES_IN_FLIGHT; i++)
+				_skr_bindless_write_tex(bl->sets[i], (uint32_t)index, &info);
+			ref_tex->bindless_slot = (uint32_t)index + 1;
+		} else {
+			skr_log(skr_log_warning, "Bindless texture table is full (%u), using white", bl->textures.capacity);
+		}
+	}
+	mtx_unlock(&bl->mutex);
+
+	return ref_tex->bindless_slot > 0 ? ref_tex->bindless_slot - 1 : 0;
+}
+
+void _skr_bindless_tex_update(const skr_tex_t* tex) {
+	if (!tex || tex->bindless_slot == 0) return;
+
+	// The index stays the same, since param data may hold it. Frames in
+	// flight may still sample the slot, so each set gets the new descriptor
+	// once its frame slot is done with it, see _skr_bindless_frame_begin.
+	_skr_bindless_t* bl    = &_skr_vk.bindless;
+	uint32_t         index = tex->bindless_slot - 1;
+	mtx_lock(&bl->mutex);
+	_skr_bindless_drop_rewrites(index);
+	if (bl->rewrite_count >= bl->rewrite_capacity) {
+		uint32_t                 capacity = bl->rewrite_capacity ? bl->rewrite_capacity * 2 : 16;
+		_skr_bindless_rewrite_t* rewrites = _skr_realloc(bl->rewrites, capacity * sizeof(_skr_bindless_rewrite_t));
+		if (!rewrites) {
+			mtx_unlock(&bl->mutex);
+			skr_log(skr_log_critical, "Failed to queue bindless texture rewrite");
+			return;
+		}
+		bl->rewrites         = rewrites;
+		bl->rewrite_capacity = capacity;
+	}
+	bl->rewrites[bl->rewrite_count++] = (_skr_bindless_rewrite_t){
+		.index   = index,
+		.pending = (1u << SKR_MAX_FRAMES_IN_FLIGHT) - 1,
+		.info    = _skr_bindless_tex_info(tex),
+	};
+	mtx_unlock(&bl->mutex);
+}
+
+void _skr_bindless_frame_begin(uint32_t flight_idx) {
+	_skr_bindless_t* bl = &_skr_vk.bindless;
+	if (bl->rewrite_count == 0) return;
+
+	mtx_lock(&bl->mutex);
+	for (uint32_t i = 0; i < bl->rewrite_count; ) {
+		_skr_bindless_rewrite_t* rewrite = &bl->rewrites[i];
+		if (rewrite->pending & (1u << flight_idx)) {
+			_skr_bindless_write_tex(bl->sets[flight_idx], rewrite->index, &rewrite->info);
+			rewrite->pending &= ~(1u << flight_idx);
+		}
+		if (rewrite->pending == 0) bl->rewrites[i] = bl->rewrites[--bl->rewrite_count];
+		else                       i++;
+	}
+	mtx_unlock(&bl->mutex);
+}
+
+uint32_t _skr_bindless_buffer_index(skr_buffer_t* ref_buffer) {
+	if (!ref_buffer || !_skr_bindless_available()) return 0;
+	if (ref_buffer->bindless_slot != 0) return ref_buffer->bindless_slot - 1;
+
+	// Dynamic buffers swap VkBuffers on update, which the table wouldn't see
+	if (!(ref_buffer->type & skr_buffer_type_storage) || ref_buffer->_ring_count > 0 || (ref_buffer->use & (skr_use_dynamic | skr_use_stream))) {
+		skr_log(skr_log_warning, "Bindless table only holds static storage buffers");
+		return 0;
+	}
+
+	_skr_bindless_t* bl = &_skr_vk.bindless;
+	mtx_lock(&bl->mutex);
+	if (ref_buffer->bindless_slot == 0) {
+		int32_t index = _skr_bindless_slots_alloc(&bl->buffers);
+		if (index >= 0) {
+			for (uint32_t i = 0; i < SKR_MAX_FRAMES_IN_FLIGHT; i++) {
+				vkUpdateDescriptorSets(_skr_vk.device, 1, &(VkWriteDescriptorSet){
+					.sType           = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET,
+					.dstSet          = bl->sets[i],
+					.dstBinding      = SKR_BINDLESS_BIND_BUFFERS,
+					.dstArrayElement = (uint32_t)index,
+					.descriptorCount = 1,
+					.descriptorType  = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER,
+					.pBufferInfo     = &(VkDescriptorBufferInfo){
+						.buffer = ref_buffer->buffer,
+						.offset = 0,
+						.range  = VK_WHOLE_SIZE,
+					},
+				}, 0, NULL);
+			}
+			ref_buffer->bindless_slot = (uint32_t)index + 1;
+		} else {
+			skr_log(skr_log_warning, "Bindless buffer table is full (%u)", bl->buffers.capacity);
+		}
+	}
+	mtx_unlock(&bl->mutex);
+
+	return ref_buffer->bindless_slot > 0 ? ref_buffer->bindless_slot - 1 : 0;
+}
+
+void _skr_bindless_free(bool is_buffer, uint32_t index) {
+	_skr_bindless_t* bl = &_skr_vk.bindless;
+	if (bl->sets[0] == VK_NULL_HANDLE) return;
+
+	mtx_lock(&bl->mutex);
+	if (!is_buffer) _skr_bindless_drop_rewrites(index);
+	_skr_bindless_slots_t* slots = is_buffer ? &bl->buffers : &bl->textures;
+	if (slots->free_count < slots->capacity)
+		slots->free[slots->free_count++] = index;
+	mtx_unlock(&bl->mutex);
+}
+
+void _skr_bindless_bind(VkCommandBuffer cmd, VkPipelineBindPoint bind_point, VkPipelineLayout layout) {
+	vkCmdBindDescriptorSets(cmd, bind_point, layout, SKSC_BINDLESS_SPACE, 1, &_skr_vk.bindless.sets[_skr_vk.flight_idx], 0, NULL);
+}
+
+VkPipelineLayout _skr_bindless_create_layout(VkDescriptorSetLayout opt_descriptor_layout, VkPushConstantRange push_range) {
+	VkDescriptorSetLayout set_layouts[2] = {
+		opt_descriptor_layout != VK_NULL_HANDLE ? opt_descriptor_layout : _skr_vk.bindless.empty_layout,
+		_skr_vk.bindless.layout,
+	};
+
+	VkPipelineLayout layout;
+	VkResult vr = vkCreatePipelineLayout(_skr_vk.device, &(VkPipelineLayoutCreateInfo){
+		.sType          = VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO,
+		.setLayoutCount         = 2,
+		.pSetLayouts            = set_layouts,
+		.pushConstantRangeCount = push_range.size > 0 ? 1 : 0,
+		.pPushConstantRanges    = push_range.size > 0 ? &push_range : NULL,
+	}, NULL, &layout);
+	SKR_VK_CHECK_RET(vr, "vkCreatePipelineLayout", VK_NULL_HANDLE);
+	return layout;
+}
+
+uint32_t skr_tex_get_bindless_index(skr_tex_t* ref_tex) {
+	return _skr_bindless_tex_index(ref_tex);
+}
+
+uint32_t skr_buffer_get_bindless_index(skr_buffer_t* ref_buffer) {
+	return _skr_bindless_buffer_index(ref_buffer);
+}
@@ -28,6 +28,114 @@ static uint32_t _skr_find_memory_type(VkPhysicalDevice physical_device, uint32_t
 	return 0;
 }
 
+// Picks a memory type for CPU mapped buffers based on how the CPU touches
+// them. Uncached write-combined memory is fine for sequential writes, but
+// very slow to read or scatter into, so readback and stream buffers prefer
+// host cached memory, and accept non-coherent types with explicit
+// flush/invalidate.
+static uint32_t _skr_find_host_memory_type(uint32_t type_filter, skr_use_ use, bool* out_non_coherent) {
+	VkPhysicalDeviceMemoryProperties mem_properties;
+	vkGetPhysicalDeviceMemoryProperties(_skr_vk.physical_device, &mem_properties);
+
+	VkMemoryPropertyFlags candidates[3];
+	uint32_t              candidate_count = 0;
+	if (use & (skr_use_readback | skr_use_stream)) {
+		candidates[candidate_count++] = VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_CACHED_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT;
+		candidates[candidate_count++] = VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_CACHED_BIT;
+	}
+	candidates[candidate_count++] = VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT;
+
+	for (uint32_t c = 0; c < candidate_count; c++) {
+		for (uint32_t i = 0; i < mem_properties.memoryTypeCount; i++) {
+			VkMemoryPropertyFlags flags = mem_properties.memoryTypes[i].propertyFlags;
+			if ((type_filter & (1 << i)) && (flags & candidates[c]) == candidates[c]) {
+				*out_non_coherent = (flags & VK_MEMORY_PROPERTY_HOST_COHERENT_BIT) == 0;
+				return i;
+			}
+		}
+	}
+
+	skr_log(skr_log_critical, "Failed to find suitable host memory type");
+	*out_non_coherent = false;
+	return 0;
+}
+
+// Mapped range for flush/invalidate, aligned to nonCoherentAtomSize and
+// clamped to the end of the mapping.
+static VkMappedMemoryRange _skr_buffer_mapped_range(const skr_buffer_t* buffer, VkDeviceMemory memory, uint32_t offset, uint32_t size) {
+	VkDeviceSize atom  = _skr_vk.non_coherent_atom_size > 0 ? _skr_vk.non_coherent_atom_size : 1;
+	VkDeviceSize start = (offset / atom) * atom;
+	VkDeviceSize end   = (((VkDeviceSize)offset + size + atom - 1) / atom) * atom;
+	return (VkMappedMemoryRange){
+		.sType  = VK_STRUCTURE_TYPE_MAPPED_MEMORY_RANGE,
+		.memory = memory,
+		.offset = start,
+		.size   = end >= buffer->size ? VK_WHOLE_SIZE : end - start,
+	};
+}
+
+// Makes CPU writes visible to the GPU, no-op on coherent memory
+static void _skr_buffer_flush(const skr_buffer_t* buffer, VkDeviceMemory memory, uint32_t offset, uint32_t size) {
+	if (!buffer->_non_coherent || size == 0) return;
+	VkMappedMemoryRange range = _skr_buffer_mapped_range(buffer, memory, offset, size);
+	vkFlushMappedMemoryRanges(_skr_vk.device, 1, &range);
+}
+
+// Makes GPU writes visible to the CPU, no-op on coherent memory
+static void _skr_buffer_invalidate(const skr_buffer_t* buffer, VkDeviceMemory memory, uint32_t offset, uint32_t size) {
+	if (!buffer->_non_coherent || size == 0) return;
+	VkMappedMemoryRange range = _skr_buffer_mapped_range(buffer, memory, offset, size);
+	vkInvalidateMappedMemoryRanges(_skr_vk.device, 1, &range);
+}
+
+// Creates a mapped, host coherent buffer for uploading to device local memory
+static skr_err_ _skr_buffer_create_staging(VkDeviceSize size, VkBuffer* out_buffer, VkDeviceMemory* out_memory, void** out_mapped) {
+	*out_buffer = VK_NULL_HANDLE;
+	*out_memory = VK_NULL_HANDLE;
+	*out_mapped = NULL;
+
+	VkResult vr = vkCreateBuffer(_skr_vk.device, &(VkBufferCreateInfo){
+		.sType       = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO,
+		.size        = size,
+		.usage       = VK_BUFFER_USAGE_TRANSFER_SRC_BIT,
+		.sharingMode = VK_SHARING_MODE_EXCLUSIVE,
+	}, NULL, out_buffer);
+	SKR_VK_CHECK_RET(vr, "vkCreateBuffer", skr_err_device_error);
+
+	VkMemoryRequirements mem_req;
+	vkGetBufferMemoryRequirements(_skr_vk.device, *out_buffer, &mem_req);
+
+	vr = vkAllocateMemory(_skr_vk.device, &(VkMemoryAllocateInfo){
+		.sType           = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO,
+		.allocationSize  = mem_req.size,
+		.memoryTypeIndex = _skr_find_memory_type(_skr_vk.physical_device, mem_req.memoryTypeBits, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT),
+	}, NULL, out_memory);
+	if (vr != VK_SUCCESS) {
+		SKR_VK_CHECK_NRET(vr, "vkAllocateMemory");
+		vkDestroyBuffer(_skr_vk.device, *out_buffer, NULL);
+		*out_buffer = VK_NULL_HANDLE;
+		*out_memory = VK_NULL_HANDLE;
+		return skr_err_out_of_memory;
+	}
+	vkBindBufferMemory(_skr_vk.device, *out_buffer, *out_memory, 0);
+	vkMapMemory       (_skr_vk.device, *out_memory, 0, size, 0, out_mapped);
+	return skr_err_success;
+}
+
+// Stages and access flags that may consume a buffer of this type, used as
+// the destination scope of barriers after transfer writes.
+static void _skr_buffer_consumer_scope(skr_buffer_type_ type, VkPipelineStageFlags* out_stages, VkAccessFlags* out_access) {
+	VkPipelineStageFlags stages = 0;
+	VkAccessFlags        access = 0;
+	if (type & skr_buffer_type_vertex)   { stages |= VK_PIPELINE_STAGE_VERTEX_INPUT_BIT; access |= VK_ACCESS_VERTEX_ATTRIBUTE_READ_BIT; }
+	if (type & skr_buffer_type_index)    { stages |= VK_PIPELINE_STAGE_VERTEX_INPUT_BIT; access |= VK_ACCESS_INDEX_READ_BIT; }
+	if (type & skr_buffer_type_constant) { stages |= VK_PIPELINE_STAGE_VERTEX_SHADER_BIT | VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT | VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT; access |= VK_ACCESS_UNIFORM_READ_BIT; }
+	if (type & skr_buffer_type_storage)  { stages |= VK_PIPELINE_STAGE_VERTEX_SHADER_BIT | VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT | VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT | VK_PIPELINE_STAGE_DRAW_INDIRECT_BIT; access |= VK_ACCESS_SHADER_READ_BIT | VK_ACCESS_SHADER_WRITE_BIT | VK_ACCESS_INDIRECT_COMMAND_READ_BIT; }
+	if (stages == 0) { stages = VK_PIPELINE_STAGE_ALL_COMMANDS_BIT; access = VK_ACCESS_MEMORY_READ_BIT; }
+	*out_stages = stages;
+	*out_access = access;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // Buffer creation and destruction
 ///////////////////////////////////////////////////////////////////////////////
@@ -44,23 +152,32 @@ skr_err_ skr_buffer_create(const void* opt_data, uint32_t size_count, uint32_t s
 		return skr_err_invalid_parameter;
 	}
 
+	// Stream buffers are dynamic buffers with a different memory policy
+	if (use & skr_use_stream) use |= skr_use_dynamic;
+	bool host_mapped = (use & (skr_use_dynamic | skr_use_readback)) != 0;
+
 	out_buffer->size = size_count * size_stride;
 	out_buffer->type = type;
 	out_buffer->use  = use;
 
 	VkBufferUsageFlags usage = _skr_to_vk_buffer_usage(type);
 
-	// Add transfer dst for initial data upload (unless dynamic)
-	if (opt_data != NULL && !(use & skr_use_dynamic)) {
+	// Add transfer dst for initial data upload and later range updates
+	// (unless dynamic), and transfer src so any buffer can be read back.
+	if (!(use & skr_use_dynamic)) {
 		usage |= VK_BUFFER_USAGE_TRANSFER_DST_BIT;
 	}
+	usage |= VK_BUFFER_USAGE_TRANSFER_SRC_BIT;
 
 	// Create buffer
 	VkResult vr = vkCreateBuffer(_skr_vk.device, &(VkBufferCreateInfo){
-		.sType       = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO,
-		.size        = out_buffer->size,
-		.usage       = usage,
-		.sharingMode = VK_SHARING_MODE_EXCLUSIVE,
+		.sType                 = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO,
+		.size                  = out_buffer->size,
+		.usage                 = usage,
+		// Concurrent sharing lets async compute use buffers without ownership transfers
+		.sharingMode           = _skr_vk.has_async_compute ? VK_SHARING_MODE_CONCURRENT : VK_SHARING_MODE_EXCLUSIVE,
+		.queueFamilyIndexCount = _skr_vk.has_async_compute ? 2 : 0,
+		.pQueueFamilyIndices   = _skr_vk.async_queue_families,
 	}, NULL, &out_buffer->buffer);
 	SKR_VK_CHECK_RET(vr, "vkCreateBuffer", skr_err_device_error);
 
@@ -68,14 +185,28 @@ skr_err_ skr_buffer_create(const void* opt_data, uint32_t size_count, uint32_t s
 	VkMemoryRequirements mem_requirements;
 	vkGetBufferMemoryRequirements(_skr_vk.device, out_buffer->buffer, &mem_requirements);
 
-	VkMemoryPropertyFlags mem_properties = (use & skr_use_dynamic)
-		? VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT
-		: VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT;
-
-	vr = vkAllocateMemory(_skr_vk.device, &(VkMemoryAllocateInfo){
+	uint32_t memory_type = host_mapped
+		? _skr_find_host_memory_type(mem_requirements.memoryTypeBits, use, &out_buffer->_non_coherent)
+		: _skr_find_memory_type     (_skr_vk.physical_device, mem_requirements.memoryTypeBits, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT);
+
+	// On UMA/ReBAR devices, static buffers go in device local memory the CPU
+	// can write to, so the initial upload can skip the staging copy. If that
+	// heap is full, fall back to regular device local memory.
+	bool     direct_upload = false;
+	uint32_t unified_types = host_mapped ? 0 : (mem_requirements.memoryTypeBits & _skr_vk.unified_memory_types);
+	if (unified_types != 0) {
+		uint32_t type_idx = 0;
+		while (!(unified_types & (1u << type_idx))) type_idx++;
+		direct_upload = vkAllocateMemory(_skr_vk.device, &(VkMemoryAllocateInfo){
+			.sType           = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO,
+			.allocationSize  = mem_requirements.size,
+			.memoryTypeIndex = type_idx,
+		}, NULL, &out_buffer->memory) == VK_SUCCESS;
+	}
+	vr = direct_upload ? VK_SUCCESS : vkAllocateMemory(_skr_vk.device, &(VkMemoryAllocateInfo){
 		.sType           = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO,
 		.allocationSize  = mem_requirements.size,
-		.memoryTypeIndex = _skr_find_memory_type(_skr_vk.physical_device, mem_requirements.memoryTypeBits, mem_properties),
+		.memoryTypeIndex = memory_type,
 	}, NULL, &out_buffer->memory);
 	if (vr != VK_SUCCESS) {
 		SKR_VK_CHECK_NRET(vr, "vkAllocateMemory");
@@ -88,56 +219,31 @@ skr_err_ skr_buffer_create(const void* opt_data, uint32_t size_count, uint32_t s
 
 	// Upload initial data
 	if (opt_data != NULL) {
-		if (use & skr_use_dynamic) {
-			// Direct map and copy for dynamic buffers
+		if (host_mapped || direct_upload) {
+			// Direct map and copy for host mapped and unified memory buffers
 			void* mapped;
-			vkMapMemory(_skr_vk.device, out_buffer->memory, 0, out_buffer->size, 0, &mapped);
+			vkMapMemory(_skr_vk.device, out_buffer->memory, 0, VK_WHOLE_SIZE, 0, &mapped);
 			memcpy(mapped, opt_data, out_buffer->size);
+			_skr_buffer_flush(out_buffer, out_buffer->memory, 0, out_buffer->size);
 			vkUnmapMemory(_skr_vk.device, out_buffer->memory);
 		} else {
 			// Use staging buffer for static buffers
-			VkBuffer staging_buffer;
-			vr = vkCreateBuffer(_skr_vk.device, &(VkBufferCreateInfo){
-				.sType       = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO,
-				.size        = out_buffer->size,
-				.usage       = VK_BUFFER_USAGE_TRANSFER_SRC_BIT,
-				.sharingMode = VK_SHARING_MODE_EXCLUSIVE,
-			}, NULL, &staging_buffer);
-			if (vr != VK_SUCCESS) {
-				SKR_VK_CHECK_NRET(vr, "vkCreateBuffer");
-				vkDestroyBuffer(_skr_vk.device, out_buffer->buffer, NULL);
-				vkFreeMemory(_skr_vk.device, out_buffer->memory, NULL);
-				*out_buffer = (skr_buffer_t){0};
-				return skr_err_device_error;
-			}
-
-			VkMemoryRequirements staging_mem_req;
-			vkGetBufferMemoryRequirements(_skr_vk.device, staging_buffer, &staging_mem_req);
-
+			VkBuffer       staging_buffer;
 			VkDeviceMemory staging_memory;
-			vr = vkAllocateMemory(_skr_vk.device, &(VkMemoryAllocateInfo){
-				.sType           = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO,
-				.allocationSize  = staging_mem_req.size,
-				.memoryTypeIndex = _skr_find_memory_type(_skr_vk.physical_device, staging_mem_req.memoryTypeBits, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT),
-			}, NULL, &staging_memory);
-			if (vr != VK_SUCCESS) {
-				SKR_VK_CHECK_NRET(vr, "vkAllocateMemory");
-				vkDestroyBuffer(_skr_vk.device, staging_buffer, NULL);
+			void*          staging_mapped;
+			skr_err_ err = _skr_buffer_create_staging(out_buffer->size, &staging_buffer, &staging_memory, &staging_mapped);
+			if (err != skr_err_success) {
 				vkDestroyBuffer(_skr_vk.device, out_buffer->buffer, NULL);
-				vkFreeMemory(_skr_vk.device, out_buffer->memory, NULL);
+				vkFreeMemory   (_skr_vk.device, out_buffer->memory, NULL);
 				*out_buffer = (skr_buffer_t){0};
-				return skr_err_out_of_memory;
+				return err;
 			}
-			vkBindBufferMemory(_skr_vk.device, staging_buffer, staging_memory, 0);
-
-			// Copy data to staging buffer
-			void* mapped;
-			vkMapMemory(_skr_vk.device, staging_memory, 0, out_buffer->size, 0, &mapped);
-			memcpy(mapped, opt_data, out_buffer->size);
+			memcpy(staging_mapped, opt_data, out_buffer->size);
 			vkUnmapMemory(_skr_vk.device, staging_memory);
 
 			_skr_cmd_ctx_t ctx = _skr_cmd_acquire();
 
+			_skr_barrier_flush(ctx.cmd);
 			vkCmdCopyBuffer(ctx.cmd, staging_buffer, out_buffer->buffer, 1, &(VkBufferCopy){
 				.size = out_buffer->size,
 			});
@@ -148,9 +254,9 @@ skr_err_ skr_buffer_create(const void* opt_data, uint32_t size_count, uint32_t s
 		}
 	}
 
-	// Keep dynamic buffers mapped
-	if (use & skr_use_dynamic) {
-		vkMapMemory(_skr_vk.device, out_buffer->memory, 0, out_buffer->size, 0, &out_buffer->mapped);
+	// Keep dynamic and readback buffers mapped
+	if (host_mapped) {
+		vkMapMemory(_skr_vk.device, out_buffer->memory, 0, VK_WHOLE_SIZE, 0, &out_buffer->mapped);
 	}
 
 	return skr_err_success;
@@ -162,13 +268,15 @@ bool skr_buffer_is_valid(const skr_buffer_t* buffer) {
 
 // Helper to allocate a new ring slot for dynamic buffer updates
 static bool _skr_buffer_alloc_ring_slot(skr_buffer_t* ref_buffer, uint8_t slot_idx) {
-	VkBufferUsageFlags usage = _skr_to_vk_buffer_usage(ref_buffer->type);
+	VkBufferUsageFlags usage = _skr_to_vk_buffer_usage(ref_buffer->type) | VK_BUFFER_USAGE_TRANSFER_SRC_BIT;
 
 	VkResult vr = vkCreateBuffer(_skr_vk.device, &(VkBufferCreateInfo){
-		.sType       = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO,
-		.size        = ref_buffer->size,
-		.usage       = usage,
-		.sharingMode = VK_SHARING_MODE_EXCLUSIVE,
+		.sType                 = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO,
+		.size                  = ref_buffer->size,
+		.usage                 = usage,
+		.sharingMode           = _skr_vk.has_async_compute ? VK_SHARING_MODE_CONCURRENT : VK_SHARING_MODE_EXCLUSIVE,
+		.queueFamilyIndexCount = _skr_vk.has_async_compute ? 2 : 0,
+		.pQueueFamilyIndices   = _skr_vk.async_queue_families,
 	}, NULL, &ref_buffer->_ring[slot_idx].buffer);
 	if (vr != VK_SUCCESS) {
 		SKR_VK_CHECK_NRET(vr, "vkCreateBuffer (ring slot)");
@@ -178,11 +286,12 @@ static bool _skr_buffer_alloc_ring_slot(skr_buffer_t* ref_buffer, uint8_t slot_i
 	VkMemoryRequirements mem_requirements;
 	vkGetBufferMemoryRequirements(_skr_vk.device, ref_buffer->_ring[slot_idx].buffer, &mem_requirements);
 
+	// Same memory policy as the original buffer, so coherence matches
+	bool non_coherent;
 	vr = vkAllocateMemory(_skr_vk.device, &(VkMemoryAllocateInfo){
 		.sType           = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO,
 		.allocationSize  = mem_requirements.size,
-		.memoryTypeIndex = _skr_find_memory_type(_skr_vk.physical_device, mem_requirements.memoryTypeBits,
-		                       VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT),
+		.memoryTypeIndex = _skr_find_host_memory_type(mem_requirements.memoryTypeBits, ref_buffer->use, &non_coherent),
 	}, NULL, &ref_buffer->_ring[slot_idx].memory);
 	if (vr != VK_SUCCESS) {
 		SKR_VK_CHECK_NRET(vr, "vkAllocateMemory (ring slot)");
@@ -192,21 +301,66 @@ static bool _skr_buffer_alloc_ring_slot(skr_buffer_t* ref_buffer, uint8_t slot_i
 	}
 
 	vkBindBufferMemory(_skr_vk.device, ref_buffer->_ring[slot_idx].buffer, ref_buffer->_ring[slot_idx].memory, 0);
-	vkMapMemory(_skr_vk.device, ref_buffer->_ring[slot_idx].memory, 0, ref_buffer->size, 0, &ref_buffer->_ring[slot_idx].mapped);
+	vkMapMemory(_skr_vk.device, ref_buffer->_ring[slot_idx].memory, 0, VK_WHOLE_SIZE, 0, &ref_buffer->_ring[slot_idx].mapped);
+	ref_buffer->_non_coherent = ref_buffer->_non_coherent || non_coherent;
+
+	// Holds nothing yet, the first rotation onto it copies everything
+	ref_buffer->_ring[slot_idx].stale_offset[0] = 0;
+	ref_buffer->_ring[slot_idx].stale_size  [0] = ref_buffer->size;
+	ref_buffer->_ring[slot_idx].stale_count     = 1;
 
 	return true;
 }
 
-void skr_buffer_set(skr_buffer_t* ref_buffer, const void* data, uint32_t size_bytes) {
-	if (!ref_buffer || !data) return;
+// Marks bytes of a ring slot as older than the current slot. Touching or
+// overlapping ranges merge, and once the slot's list is full a new range
+// merges with its nearest neighbour, so the list may cover a bit extra.
+static void _skr_buffer_stale_add(skr_buffer_t* ref_buffer, uint8_t slot_idx, uint32_t offset, uint32_t size) {
+	if (size == 0) return;
+	uint32_t* offsets = ref_buffer->_ring[slot_idx].stale_offset;
+	uint32_t* sizes   = ref_buffer->_ring[slot_idx].stale_size;
+	uint8_t*  count   = &ref_buffer->_ring[slot_idx].stale_count;
+	uint32_t  start   = offset;
+	uint32_t  end     = offset + size;
+
+	for (uint8_t i = 0; i < *count; ) {
+		uint32_t i_end = offsets[i] + sizes[i];
+		if (offsets[i] <= end && start <= i_end) {
+			if (offsets[i] < start) start = offsets[i];
+			if (i_end      > end  ) end   = i_end;
+			(*count)--;
+			offsets[i] = offsets[*count];
+			sizes  [i] = sizes  [*count];
+		} else {
+			i++;
+		}
+	}
 
-	if (!(ref_buffer->use & skr_use_dynamic)) {
-		skr_log(skr_log_critical, "skr_buffer_set only supports dynamic buffers");
+	if (*count == SKR_BUFFER_STALE_RANGES) {
+		uint8_t  nearest = 0;
+		uint32_t best    = UINT32_MAX;
+		for (uint8_t i = 0; i < *count; i++) {
+			uint32_t gap = offsets[i] > end ? offsets[i] - end : start - (offsets[i] + sizes[i]);
+			if (gap < best) { best = gap; nearest = i; }
+		}
+		if (offsets[nearest]                  < start) start = offsets[nearest];
+		if (offsets[nearest] + sizes[nearest] > end  ) end   = offsets[nearest] + sizes[nearest];
+		(*count)--;
+		offsets[nearest] = offsets[*count];
+		sizes  [nearest] = sizes  [*count];
+		_skr_buffer_stale_add(ref_buffer, slot_idx, start, end - start);
 		return;
 	}
 
-	uint32_t copy_size = size_bytes < ref_buffer->size ? size_bytes : ref_buffer->size;
+	offsets[*count] = start;
+	sizes  [*count] = end - start;
+	(*count)++;
+}
 
+// Makes the next ring slot current, so writes never land in memory an
+// in-flight frame may still be reading. Returns false if the slot couldn't
+// be allocated, the current slot then stays current.
+static bool _skr_buffer_ring_advance(skr_buffer_t* ref_buffer) {
 	// First update: initialize ring buffer system
 	if (ref_buffer->_ring_count == 0) {
 		// Migrate existing buffer to ring[0]
@@ -215,50 +369,166 @@ void skr_buffer_set(skr_buffer_t* ref_buffer, const void* data, uint32_t size_by
 		ref_buffer->_ring[0].mapped = ref_buffer->mapped;
 		ref_buffer->_ring_count     = 1;
 		ref_buffer->_ring_index     = 0;
-
-		// Allocate ring[1] for this write
-		if (!_skr_buffer_alloc_ring_slot(ref_buffer, 1)) {
-			// Fallback: write directly (unsafe but better than crash)
-			memcpy(ref_buffer->mapped, data, copy_size);
-			return;
-		}
-		ref_buffer->_ring_count = 2;
-
-		// Write to ring[1] and make it current
-		memcpy(ref_buffer->_ring[1].mapped, data, copy_size);
-		ref_buffer->_ring_index = 1;
-		ref_buffer->buffer      = ref_buffer->_ring[1].buffer;
-		ref_buffer->memory      = ref_buffer->_ring[1].memory;
-		ref_buffer->mapped      = ref_buffer->_ring[1].mapped;
-		return;
 	}
 
-	// Subsequent updates: advance to next slot in ring
+	// Advance to next slot in ring, allocating it if not yet allocated
 	uint8_t next_idx = (ref_buffer->_ring_index + 1) % SKR_MAX_FRAMES_IN_FLIGHT;
-
-	// Allocate slot if not yet allocated
 	if (next_idx >= ref_buffer->_ring_count) {
-		if (!_skr_buffer_alloc_ring_slot(ref_buffer, next_idx)) {
-			// Fallback: write to current slot (unsafe but better than crash)
-			memcpy(ref_buffer->mapped, data, copy_size);
-			return;
-		}
+		if (!_skr_buffer_alloc_ring_slot(ref_buffer, next_idx)) return false;
 		ref_buffer->_ring_count = next_idx + 1;
 	}
 
-	// Write to the new slot and make it current
-	memcpy(ref_buffer->_ring[next_idx].mapped, data, copy_size);
 	ref_buffer->_ring_index = next_idx;
 	ref_buffer->buffer      = ref_buffer->_ring[next_idx].buffer;
 	ref_buffer->memory      = ref_buffer->_ring[next_idx].memory;
 	ref_buffer->mapped      = ref_buffer->_ring[next_idx].mapped;
+	return true;
+}
+
+// Writes ranges through the mapping. Dynamic buffers move to the next ring
+// slot first, and only the parts of it that went stale since it was last
+// current are copied over from the previous slot. Reading the previous slot
+// back is slow on write-combined memory, so this stays as small as the
+// updates themselves rather than the whole buffer.
+static void _skr_buffer_write_mapped(skr_buffer_t* ref_buffer, const skr_buffer_range_t* ranges, uint32_t range_count) {
+	const uint8_t* prev    = (const uint8_t*)ref_buffer->mapped;
+	bool           rotated = (ref_buffer->use & skr_use_dynamic) && _skr_buffer_ring_advance(ref_buffer);
+	uint8_t*       dst     = (uint8_t*)ref_buffer->mapped;
+	uint8_t        curr    = ref_buffer->_ring_index;
+
+	if (rotated) {
+		for (uint8_t s = 0; s < ref_buffer->_ring[curr].stale_count; s++) {
+			uint32_t offset = ref_buffer->_ring[curr].stale_offset[s];
+			uint32_t size   = ref_buffer->_ring[curr].stale_size  [s];
+
+			// Nothing to carry over if a range is about to replace it whole
+			bool covered = false;
+			for (uint32_t r = 0; r < range_count && !covered; r++)
+				covered = ranges[r].offset <= offset && offset + size <= ranges[r].offset + ranges[r].size;
+			if (covered) continue;
+
+			memcpy(dst + offset, prev + offset, size);
+			_skr_buffer_flush(ref_buffer, ref_buffer->memory, offset, size);
+		}
+		ref_buffer->_ring[curr].stale_count = 0;
+	}
+
+	for (uint32_t i = 0; i < range_count; i++) {
+		if (ranges[i].size == 0) continue;
+		memcpy(dst + ranges[i].offset, ranges[i].data, ranges[i].size);
+		_skr_buffer_flush(ref_buffer, ref_buffer->memory, ranges[i].offset, ranges[i].size);
+		for (uint8_t slot = 0; slot < ref_buffer->_ring_count; slot++) {
+			if (slot != curr) _skr_buffer_stale_add(ref_buffer, slot, ranges[i].offset, ranges[i].size);
+		}
+	}
+}
+
+void skr_buffer_set(skr_buffer_t* ref_buffer, const void* data, uint32_t size_bytes) {
+	if (!ref_buffer || !data) return;
+
+	if (!(ref_buffer->use & skr_use_dynamic)) {
+		skr_log(skr_log_critical, "skr_buffer_set only supports dynamic buffers");
+		return;
+	}
+
+	uint32_t copy_size = size_bytes < ref_buffer->size ? size_bytes : ref_buffer->size;
+
+	// Fallback: if no new slot, write to current slot (unsafe but better than crash)
+	_skr_buffer_write_mapped(ref_buffer, &(skr_buffer_range_t){ .data = data, .offset = 0, .size = copy_size }, 1);
+}
+
+skr_err_ skr_buffer_set_range(skr_buffer_t* ref_buffer, const void* data, uint32_t offset_bytes, uint32_t size_bytes) {
+	return skr_buffer_set_ranges(ref_buffer, &(skr_buffer_range_t){ .data = data, .offset = offset_bytes, .size = size_bytes }, 1);
+}
+
+skr_err_ skr_buffer_set_ranges(skr_buffer_t* ref_buffer, const skr_buffer_range_t* ranges, uint32_t range_count) {
+	if (!skr_buffer_is_valid(ref_buffer) || (!ranges && range_count > 0)) return skr_err_invalid_parameter;
+
+	uint64_t total_size = 0;
+	for (uint32_t i = 0; i < range_count; i++) {
+		if (!ranges[i].data || (uint64_t)ranges[i].offset + ranges[i].size > ref_buffer->size) {
+			skr_log(skr_log_warning, "skr_buffer_set_ranges: range %u is out of bounds", i);
+			return skr_err_invalid_parameter;
+		}
+		total_size += ranges[i].size;
+	}
+	if (total_size == 0) return skr_err_success;
+
+	// Dynamic and readback buffers are written through their mapping.
+	// Dynamic ones rotate the ring like skr_buffer_set does, bytes outside
+	// the ranges are carried forward from the previous slot.
+	if (ref_buffer->use & (skr_use_dynamic | skr_use_readback)) {
+		if (!ref_buffer->mapped) {
+			skr_log(skr_log_critical, "Dynamic buffer is not mapped");
+			return skr_err_invalid_parameter;
+		}
+		_skr_buffer_write_mapped(ref_buffer, ranges, range_count);
+		return skr_err_success;
+	}
+
+	// Static buffers: pack all ranges into one staging buffer, and copy them
+	// over with a single vkCmdCopyBuffer.
+	VkBuffer       staging_buffer;
+	VkDeviceMemory staging_memory;
+	void*          staging_mapped;
+	skr_err_ err = _skr_buffer_create_staging(total_size, &staging_buffer, &staging_memory, &staging_mapped);
+	if (err != skr_err_success) return err;
+
+	VkBufferCopy  stack_regions[16];
+	VkBufferCopy* regions = range_count <= 16 ? stack_regions : _skr_malloc(range_count * sizeof(VkBufferCopy));
+	if (!regions) {
+		vkUnmapMemory  (_skr_vk.device, staging_memory);
+		vkDestroyBuffer(_skr_vk.device, staging_buffer, NULL);
+		vkFreeMemory   (_skr_vk.device, staging_memory, NULL);
+		return skr_err_out_of_memory;
+	}
+
+	uint32_t     region_count = 0;
+	VkDeviceSize src_offset   = 0;
+	for (uint32_t i = 0; i < range_count; i++) {
+		if (ranges[i].size == 0) continue;
+		memcpy((uint8_t*)staging_mapped + src_offset, ranges[i].data, ranges[i].size);
+		regions[region_count++] = (VkBufferCopy){
+			.srcOffset = src_offset,
+			.dstOffset = ranges[i].offset,
+			.size      = ranges[i].size,
+		};
+		src_offset += ranges[i].size;
+	}
+	vkUnmapMemory(_skr_vk.device, staging_memory);
+
+	VkPipelineStageFlags consumer_stages;
+	VkAccessFlags        consumer_access;
+	_skr_buffer_consumer_scope(ref_buffer->type, &consumer_stages, &consumer_access);
+
+	_skr_cmd_ctx_t ctx = _skr_cmd_acquire();
+
+	// Earlier work may still be reading or writing this buffer
+	_skr_barrier_buffer(ctx.cmd, ref_buffer->buffer, 0, VK_WHOLE_SIZE,
+		VK_PIPELINE_STAGE_ALL_COMMANDS_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT,
+		VK_ACCESS_MEMORY_WRITE_BIT,         VK_ACCESS_TRANSFER_WRITE_BIT);
+	_skr_barrier_flush(ctx.cmd);
+
+	vkCmdCopyBuffer(ctx.cmd, staging_buffer, ref_buffer->buffer, region_count, regions);
+
+	// Make the new data visible to whatever consumes this buffer type
+	_skr_barrier_buffer(ctx.cmd, ref_buffer->buffer, 0, VK_WHOLE_SIZE,
+		VK_PIPELINE_STAGE_TRANSFER_BIT, consumer_stages,
+		VK_ACCESS_TRANSFER_WRITE_BIT,   consumer_access);
+
+	_skr_cmd_destroy_buffer(ctx.destroy_list, staging_buffer);
+	_skr_cmd_destroy_memory(ctx.destroy_list, staging_memory);
+	_skr_cmd_release       (ctx.cmd);
+
+	if (regions != stack_regions) _skr_free(regions);
+	return skr_err_success;
 }
 
 void skr_buffer_get(const skr_buffer_t *buffer, void *ref_buffer, uint32_t buffer_size) {
 	if (!buffer || !ref_buffer) return;
 
-	if (!(buffer->use & skr_use_dynamic)) {
-		skr_log(skr_log_critical, "skr_buffer_get only supports dynamic buffers");
+	if (!(buffer->use & (skr_use_dynamic | skr_use_readback))) {
+		skr_log(skr_log_critical, "skr_buffer_get only supports dynamic and readback buffers");
 		return;
 	}
 
@@ -269,9 +539,166 @@ void skr_buffer_get(const skr_buffer_t *buffer, void *ref_buffer, uint32_t buffe
 
 	// Copy min of requested size and actual buffer size
 	uint32_t copy_size = buffer_size < buffer->size ? buffer_size : buffer->size;
+	_skr_buffer_invalidate(buffer, buffer->memory, 0, copy_size);
 	memcpy(ref_buffer, buffer->mapped, copy_size);
 }
 
+///////////////////////////////////////////////////////////////////////////////
+// Async readback
+///////////////////////////////////////////////////////////////////////////////
+
+void _skr_readback_pool_init(void) {
+	_skr_vk.readback_pool = (_skr_readback_pool_t){0};
+	mtx_init(&_skr_vk.readback_pool.mutex, mtx_plain);
+}
+
+static void _skr_readback_staging_destroy(_skr_readback_staging_t* ref_staging) {
+	vkUnmapMemory  (_skr_vk.device, ref_staging->memory);
+	vkFreeMemory   (_skr_vk.device, ref_staging->memory, NULL);
+	vkDestroyBuffer(_skr_vk.device, ref_staging->buffer, NULL);
+	*ref_staging = (_skr_readback_staging_t){0};
+}
+
+void _skr_readback_pool_shutdown(void) {
+	for (uint32_t i = 0; i < _skr_vk.readback_pool.count; i++) {
+		_skr_readback_staging_destroy(&_skr_vk.readback_pool.entries[i]);
+	}
+	mtx_destroy(&_skr_vk.readback_pool.mutex);
+	_skr_vk.readback_pool = (_skr_readback_pool_t){0};
+}
+
+// Takes the smallest idle staging buffer that fits, or creates one. Staging
+// memory is host cached when possible, but always coherent, since the CPU
+// reads it through the plain data pointer with no invalidate step.
+static bool _skr_readback_staging_acquire(uint32_t size, _skr_readback_staging_t* out_staging) {
+	mtx_lock(&_skr_vk.readback_pool.mutex);
+	int32_t best = -1;
+	for (uint32_t i = 0; i < _skr_vk.readback_pool.count; i++) {
+		uint32_t entry_size = _skr_vk.readback_pool.entries[i].size;
+		if (entry_size >= size && (best < 0 || entry_size < _skr_vk.readback_pool.entries[best].size)) best = (int32_t)i;
+	}
+	if (best >= 0) {
+		*out_staging = _skr_vk.readback_pool.entries[best];
+		_skr_vk.readback_pool.entries[best] = _skr_vk.readback_pool.entries[--_skr_vk.readback_pool.count];
+	}
+	mtx_unlock(&_skr_vk.readback_pool.mutex);
+	if (best >= 0) return true;
+
+	// Round up so slightly different sizes can share staging buffers
+	*out_staging = (_skr_readback_staging_t){ .size = (size + 4095) & ~4095u };
+
+	VkResult vr = vkCreateBuffer(_skr_vk.device, &(VkBufferCreateInfo){
+		.sType       = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO,
+		.size        = out_staging->size,
+		.usage       = VK_BUFFER_USAGE_TRANSFER_DST_BIT,
+		.sharingMode = VK_SHARING_MODE_EXCLUSIVE,
+	}, NULL, &out_staging->buffer);
+	SKR_VK_CHECK_RET(vr, "vkCreateBuffer (readback)", false);
+
+	VkMemoryRequirements mem_req;
+	vkGetBufferMemoryRequirements(_skr_vk.device, out_staging->buffer, &mem_req);
+
+	VkPhysicalDeviceMemoryProperties mem_properties;
+	vkGetPhysicalDeviceMemoryProperties(_skr_vk.physical_device, &mem_properties);
+	const VkMemoryPropertyFlags candidates[] = {
+		VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_CACHED_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT,
+		VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT,
+	};
+	uint32_t memory_type = UINT32_MAX;
+	for (uint32_t c = 0; c < sizeof(candidates) / sizeof(candidates[0]) && memory_type == UINT32_MAX; c++) {
+		for (uint32_t i = 0; i < mem_properties.memoryTypeCount; i++) {
+			if ((mem_req.memoryTypeBits & (1 << i)) && (mem_properties.memoryTypes[i].propertyFlags & candidates[c]) == candidates[c]) {
+				memory_type = i;
+				break;
+			}
+		}
+	}
+
+	vr = memory_type == UINT32_MAX ? VK_ERROR_OUT_OF_HOST_MEMORY : vkAllocateMemory(_skr_vk.device, &(VkMemoryAllocateInfo){
+		.sType           = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO,
+		.allocationSize  = mem_req.size,
+		.memoryTypeIndex = memory_type,
+	}, NULL, &out_staging->memory);
+	if (vr != VK_SUCCESS) {
+		SKR_VK_CHECK_NRET(vr, "vkAllocateMemory (readback)");
+		vkDestroyBuffer(_skr_vk.device, out_staging->buffer, NULL);
+		return false;
+	}
+	vkBindBufferMemory(_skr_vk.device, out_staging->buffer, out_staging->memory, 0);
+	vkMapMemory       (_skr_vk.device, out_staging->memory, 0, VK_WHOLE_SIZE, 0, &out_staging->mapped);
+	return true;
+}
+
+// The GPU must be done with the staging buffer
+static void _skr_readback_staging_release(_skr_readback_staging_t* ref_staging) {
+	mtx_lock(&_skr_vk.readback_pool.mutex);
+	bool pooled = _skr_vk.readback_pool.count < SKR_READBACK_POOL_MAX;
+	if (pooled) _skr_vk.readback_pool.entries[_skr_vk.readback_pool.count++] = *ref_staging;
+	mtx_unlock(&_skr_vk.readback_pool.mutex);
+
+	if (!pooled) _skr_readback_staging_destroy(ref_staging);
+}
+
+skr_err_ skr_buffer_readback(const skr_buffer_t* buffer, uint32_t offset_bytes, uint32_t size_bytes, skr_buffer_readback_t* out_readback) {
+	if (!out_readback) return skr_err_invalid_parameter;
+	*out_readback = (skr_buffer_readback_t){0};
+	if (!skr_buffer_is_valid(buffer) || size_bytes == 0) return skr_err_invalid_parameter;
+	if ((uint64_t)offset_bytes + size_bytes > buffer->size) {
+		skr_log(skr_log_critical, "skr_buffer_readback: range is out of bounds");
+		return skr_err_invalid_parameter;
+	}
+
+	_skr_readback_staging_t* staging = _skr_malloc(sizeof(_skr_readback_staging_t));
+	if (!staging) return skr_err_out_of_memory;
+	if (!_skr_readback_staging_acquire(size_bytes, staging)) {
+		_skr_free(staging);
+		return skr_err_out_of_memory;
+	}
+
+	_skr_cmd_ctx_t ctx = _skr_cmd_acquire();
+
+	// Wait for earlier GPU writes (compute, transfers) to this buffer
+	_skr_barrier_buffer(ctx.cmd, buffer->buffer, offset_bytes, size_bytes,
+		VK_PIPELINE_STAGE_ALL_COMMANDS_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT,
+		VK_ACCESS_MEMORY_WRITE_BIT,         VK_ACCESS_TRANSFER_READ_BIT);
+	_skr_barrier_flush(ctx.cmd);
+
+	vkCmdCopyBuffer(ctx.cmd, buffer->buffer, staging->buffer, 1, &(VkBufferCopy){
+		.srcOffset = offset_bytes,
+		.dstOffset = 0,
+		.size      = size_bytes,
+	});
+
+	// Make the copy visible to the host once the future completes
+	_skr_barrier_buffer(ctx.cmd, staging->buffer, 0, size_bytes,
+		VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_HOST_BIT,
+		VK_ACCESS_TRANSFER_WRITE_BIT,   VK_ACCESS_HOST_READ_BIT);
+
+	// Get future before releasing command buffer
+	skr_future_t future = skr_future_get();
+
+	_skr_cmd_release(ctx.cmd);
+
+	out_readback->data      = staging->mapped;
+	out_readback->size      = size_bytes;
+	out_readback->future    = future;
+	out_readback->_internal = staging;
+	return skr_err_success;
+}
+
+void skr_buffer_readback_destroy(skr_buffer_readback_t* ref_readback) {
+	if (!ref_readback || !ref_readback->_internal) return;
+
+	// Wait for GPU to complete before recycling (in case user forgot)
+	skr_future_wait(&ref_readback->future);
+
+	_skr_readback_staging_t* staging = (_skr_readback_staging_t*)ref_readback->_internal;
+	_skr_readback_staging_release(staging);
+	_skr_free(staging);
+
+	*ref_readback = (skr_buffer_readback_t){0};
+}
+
 uint32_t skr_buffer_get_size(const skr_buffer_t* buffer) {
 	return buffer ? buffer->size : 0;
 }
@@ -284,6 +711,13 @@ void skr_buffer_set_name(skr_buffer_t* ref_buffer, const char* name) {
 void skr_buffer_destroy(skr_buffer_t* ref_buffer) {
 	if (!ref_buffer || ref_buffer->buffer == VK_NULL_HANDLE) return;
 
+	uint64_t buffers[SKR_MAX_FRAMES_IN_FLIGHT + 1] = { (uint64_t)ref_buffer->buffer };
+	for (uint8_t i = 0; i < ref_buffer->_ring_count; i++) buffers[i + 1] = (uint64_t)ref_buffer->_ring[i].buffer;
+	_skr_material_sets_invalidate(buffers, ref_buffer->_ring_count + 1);
+	if (ref_buffer->bindless_slot != 0) {
+		_skr_cmd_destroy_bindless_slot(NULL, true, ref_buffer->bindless_slot - 1);
+	}
+
 	if (ref_buffer->_ring_count > 0) {
 		// Ring buffer mode: destroy all allocated ring slots
 		for (uint8_t i = 0; i < ref_buffer->_ring_count; i++) {
@@ -309,27 +743,103 @@ void skr_buffer_destroy(skr_buffer_t* ref_buffer) {
 // Bump Allocator
 ///////////////////////////////////////////////////////////////////////////////
 
+void _skr_bump_pool_init(void) {
+	_skr_vk.bump_page_pool = (_skr_bump_page_pool_t){0};
+	mtx_init(&_skr_vk.bump_page_pool.mutex, mtx_plain);
+}
+
+void _skr_bump_pool_shutdown(void) {
+	_skr_bump_page_pool_t* pool = &_skr_vk.bump_page_pool;
+	for (uint32_t l = 0; l < sizeof(pool->lists) / sizeof(pool->lists[0]); l++) {
+		for (uint32_t i = 0; i < pool->lists[l].count; i++) {
+			skr_buffer_destroy(pool->lists[l].pages[i]);
+			_skr_free         (pool->lists[l].pages[i]);
+		}
+	}
+	mtx_destroy(&pool->mutex);
+	*pool = (_skr_bump_page_pool_t){0};
+}
+
+// Caller must hold the pool mutex
+static _skr_bump_page_list_t* _skr_bump_pool_list(skr_buffer_type_ type) {
+	_skr_bump_page_pool_t* pool = &_skr_vk.bump_page_pool;
+	_skr_bump_page_list_t* free_list = NULL;
+	for (uint32_t l = 0; l < sizeof(pool->lists) / sizeof(pool->lists[0]); l++) {
+		if (pool->lists[l].buffer_type == type) return &pool->lists[l];
+		if (pool->lists[l].buffer_type == 0 && free_list == NULL) free_list = &pool->lists[l];
+	}
+	if (free_list) free_list->buffer_type = type;
+	return free_list;
+}
+
+// Gets a page that can hold at least min_size bytes. Standard pages are
+// recycled through the pool, larger requests get a dedicated page.
+static skr_buffer_t* _skr_bump_page_acquire(skr_buffer_type_ type, uint32_t min_size) {
+	if (min_size <= SKR_BUMP_PAGE_SIZE) {
+		skr_buffer_t* page = NULL;
+		mtx_lock(&_skr_vk.bump_page_pool.mutex);
+		_skr_bump_page_list_t* list = _skr_bump_pool_list(type);
+		if (list && list->count > 0) page = list->pages[--list->count];
+		mtx_unlock(&_skr_vk.bump_page_pool.mutex);
+		if (page) return page;
+	}
+
+	// Round dedicated pages up to whole standard pages
+	uint32_t size = ((min_size + SKR_BUMP_PAGE_SIZE - 1) / SKR_BUMP_PAGE_SIZE) * SKR_BUMP_PAGE_SIZE;
+	skr_buffer_t* page = _skr_malloc(sizeof(skr_buffer_t));
+	if (!page) return NULL;
+	if (skr_buffer_create(NULL, size, 1, type, skr_use_dynamic, page) != skr_err_success) {
+		_skr_free(page);
+		return NULL;
+	}
+	skr_buffer_set_name(page, type == skr_buffer_type_storage ? "bump_page_storage" : "bump_page_const");
+	return page;
+}
+
+// The GPU must be done with the page. Standard pages return to the pool,
+// everything else is destroyed.
+static void _skr_bump_page_release(skr_buffer_t* page) {
+	if (!page) return;
+	if (page->size == SKR_BUMP_PAGE_SIZE) {
+		mtx_lock(&_skr_vk.bump_page_pool.mutex);
+		_skr_bump_page_list_t* list = _skr_bump_pool_list(page->type);
+		bool pooled = list && list->count < SKR_BUMP_PAGE_POOL_MAX;
+		if (pooled) list->pages[list->count++] = page;
+		mtx_unlock(&_skr_vk.bump_page_pool.mutex);
+		if (pooled) return;
+	}
+	skr_buffer_destroy(page);
+	_skr_free         (page);
+}
+
+// Releases pages past the ones needed to cover target_size
+static void _skr_bump_alloc_trim(skr_bump_alloc_t* ref_alloc, uint32_t target_size) {
+	uint32_t keep     = 0;
+	uint32_t capacity = 0;
+	while (keep < ref_alloc->page_count && capacity < target_size) {
+		capacity += ref_alloc->pages[keep]->size;
+		keep++;
+	}
+	for (uint32_t i = keep; i < ref_alloc->page_count; i++) {
+		_skr_bump_page_release(ref_alloc->pages[i]);
+	}
+	ref_alloc->page_count = keep;
+}
+
 void _skr_bump_alloc_init(skr_bump_alloc_t* ref_alloc, skr_buffer_type_ type, uint32_t alignment) {
 	*ref_alloc = (skr_bump_alloc_t){
-		.buffer_type    = type,
-		.alignment      = alignment > 0 ? alignment : 1,
-		.high_water_mark = 0,
+		.buffer_type = type,
+		.alignment   = alignment > 0 ? alignment : 1,
 	};
 }
 
 void _skr_bump_alloc_destroy(skr_bump_alloc_t* ref_alloc) {
 	if (!ref_alloc) return;
 
-	// Destroy main buffer
-	if (ref_alloc->main_valid) {
-		skr_buffer_destroy(&ref_alloc->main_buffer);
-	}
-
-	// Destroy all overflow buffers
-	for (uint32_t i = 0; i < ref_alloc->overflow_count; i++) {
-		skr_buffer_destroy(&ref_alloc->overflow[i]);
+	for (uint32_t i = 0; i < ref_alloc->page_count; i++) {
+		_skr_bump_page_release(ref_alloc->pages[i]);
 	}
-	_skr_free(ref_alloc->overflow);
+	_skr_free(ref_alloc->pages);
 
 	*ref_alloc = (skr_bump_alloc_t){0};
 }
@@ -337,34 +847,102 @@ void _skr_bump_alloc_destroy(skr_bump_alloc_t* ref_alloc) {
 void _skr_bump_alloc_reset(skr_bump_alloc_t* ref_alloc) {
 	if (!ref_alloc) return;
 
-	// Resize main buffer if high-water mark exceeds current capacity
-	uint32_t main_capacity = ref_alloc->main_valid ? ref_alloc->main_buffer.size : 0;
-	if (ref_alloc->high_water_mark > main_capacity) {
-		// Destroy old main buffer
-		if (ref_alloc->main_valid) {
-			skr_buffer_destroy(&ref_alloc->main_buffer);
-			ref_alloc->main_valid = false;
-		}
+	uint32_t used     = ref_alloc->frame_used;
+	uint32_t capacity = 0;
+	for (uint32_t i = 0; i < ref_alloc->page_count; i++) {
+		capacity += ref_alloc->pages[i]->size;
+	}
 
-		// Create new buffer sized to high-water mark (with some headroom)
-		uint32_t new_size = ref_alloc->high_water_mark + (ref_alloc->high_water_mark / 4);  // +25% headroom
-		if (new_size < 4096) new_size = 4096;  // Minimum 4KB
+	// Several pages in a row: merge them into one dedicated page sized for
+	// the peak, so large writes stop scattering across pages.
+	bool multi_page = used > 0 && ref_alloc->page_curr > 0;
+	if (multi_page) {
+		ref_alloc->grow_frames += 1;
+		ref_alloc->grow_peak    = used > ref_alloc->grow_peak ? used : ref_alloc->grow_peak;
+	} else {
+		ref_alloc->grow_frames = 0;
+		ref_alloc->grow_peak   = 0;
+	}
+	if (ref_alloc->grow_frames >= SKR_BUMP_MERGE_FRAMES) {
+		uint32_t      merged_size = ref_alloc->grow_peak + ref_alloc->grow_peak / 4;  // +25% headroom
+		skr_buffer_t* merged      = _skr_bump_page_acquire(ref_alloc->buffer_type, merged_size > SKR_BUMP_PAGE_SIZE ? merged_size : SKR_BUMP_PAGE_SIZE + 1);
+		if (merged) {
+			_skr_bump_alloc_trim(ref_alloc, 0);
+			ref_alloc->pages[0]   = merged;
+			ref_alloc->page_count = 1;
+			capacity              = merged->size;
+		}
+		ref_alloc->grow_frames = 0;
+		ref_alloc->grow_peak   = 0;
+		ref_alloc->low_frames  = 0;
+		ref_alloc->low_peak    = 0;
+	}
 
-		skr_buffer_create(NULL, new_size, 1, ref_alloc->buffer_type, skr_use_dynamic, &ref_alloc->main_buffer);
-		ref_alloc->main_valid = true;
+	// Low usage for a while: hand back whatever the recent peak didn't need
+	uint32_t shrink_frames = _skr_vk.bump_shrink_frames > 0 ? _skr_vk.bump_shrink_frames : SKR_BUMP_SHRINK_FRAMES;
+	if (capacity > 0 && used <= capacity / 2) {
+		ref_alloc->low_frames += 1;
+		ref_alloc->low_peak    = used > ref_alloc->low_peak ? used : ref_alloc->low_peak;
+	} else {
+		ref_alloc->low_frames = 0;
+		ref_alloc->low_peak   = 0;
 	}
+	if (ref_alloc->low_frames >= shrink_frames) {
+		uint32_t target = ref_alloc->low_peak + ref_alloc->low_peak / 4;
+		// An oversized page is dropped entirely when it is mostly idle, the
+		// next write pulls a standard page from the pool instead.
+		if (ref_alloc->page_count == 1 && ref_alloc->pages[0]->size > SKR_BUMP_PAGE_SIZE && target <= ref_alloc->pages[0]->size / 2) {
+			target = 0;
+		}
+		_skr_bump_alloc_trim(ref_alloc, target);
+		ref_alloc->low_frames = 0;
+		ref_alloc->low_peak   = 0;
+	}
+
+	ref_alloc->page_curr  = 0;
+	ref_alloc->page_used  = 0;
+	ref_alloc->frame_used = 0;
+}
+
+// Moves to the next page that can fit size bytes, pulling a new one from the
+// pool if none of the retained pages fit.
+static bool _skr_bump_alloc_next_page(skr_bump_alloc_t* ref_alloc, uint32_t size) {
+	uint32_t next = ref_alloc->page_count > 0 ? ref_alloc->page_curr + 1 : 0;
 
-	// Reset main buffer offset
-	ref_alloc->main_used = 0;
+	// Look for a retained page that fits
+	uint32_t found = UINT32_MAX;
+	for (uint32_t i = next; i < ref_alloc->page_count; i++) {
+		if (ref_alloc->pages[i]->size >= size) { found = i; break; }
+	}
 
-	// Destroy overflow buffers from previous frame (GPU is done with them now)
-	for (uint32_t i = 0; i < ref_alloc->overflow_count; i++) {
-		skr_buffer_destroy(&ref_alloc->overflow[i]);
+	if (found == UINT32_MAX) {
+		if (ref_alloc->page_count >= ref_alloc->page_capacity) {
+			uint32_t       new_cap   = ref_alloc->page_capacity == 0 ? 4 : ref_alloc->page_capacity * 2;
+			skr_buffer_t** new_pages = _skr_realloc(ref_alloc->pages, new_cap * sizeof(skr_buffer_t*));
+			if (!new_pages) {
+				skr_log(skr_log_critical, "Failed to grow bump allocator page array");
+				return false;
+			}
+			ref_alloc->pages         = new_pages;
+			ref_alloc->page_capacity = new_cap;
+		}
+		skr_buffer_t* page = _skr_bump_page_acquire(ref_alloc->buffer_type, size);
+		if (!page) {
+			skr_log(skr_log_critical, "Failed to allocate bump allocator page");
+			return false;
+		}
+		found = ref_alloc->page_count;
+		ref_alloc->pages[ref_alloc->page_count++] = page;
 	}
-	ref_alloc->overflow_count = 0;
 
-	// Reset high-water mark for this frame
-	ref_alloc->high_water_mark = 0;
+	// Keep pages used this frame contiguous at the front of the array
+	skr_buffer_t* tmp       = ref_alloc->pages[next];
+	ref_alloc->pages[next]  = ref_alloc->pages[found];
+	ref_alloc->pages[found] = tmp;
+
+	ref_alloc->page_curr = next;
+	ref_alloc->page_used = 0;
+	return true;
 }
 
 skr_bump_result_t _skr_bump_alloc_write(skr_bump_alloc_t* ref_alloc, const void* data, uint32_t size) {
@@ -372,56 +950,21 @@ skr_bump_result_t _skr_bump_alloc_write(skr_bump_alloc_t* ref_alloc, const void*
 	if (!ref_alloc || !data || size == 0) return result;
 
 	// Align the allocation
-	uint32_t aligned_offset = (ref_alloc->main_used + ref_alloc->alignment - 1) & ~(ref_alloc->alignment - 1);
-	uint32_t main_capacity = ref_alloc->main_valid ? ref_alloc->main_buffer.size : 0;
-
-	// Try to allocate from main buffer
-	if (ref_alloc->main_valid && aligned_offset + size <= main_capacity) {
-		// Write to main buffer
-		memcpy((uint8_t*)ref_alloc->main_buffer.mapped + aligned_offset, data, size);
-		ref_alloc->main_used = aligned_offset + size;
-
-		// Track high-water mark
-		if (ref_alloc->main_used > ref_alloc->high_water_mark) {
-			ref_alloc->high_water_mark = ref_alloc->main_used;
-		}
+	uint32_t aligned_offset = (ref_alloc->page_used + ref_alloc->alignment - 1) & ~(ref_alloc->alignment - 1);
 
-		result.buffer = &ref_alloc->main_buffer;
-		result.offset = aligned_offset;
-		return result;
+	// Move on to another page if this doesn't fit in the current one
+	bool fits = ref_alloc->page_count > 0 && aligned_offset + size <= ref_alloc->pages[ref_alloc->page_curr]->size;
+	if (!fits) {
+		if (!_skr_bump_alloc_next_page(ref_alloc, size)) return result;
+		aligned_offset = 0;
 	}
 
-	// Main buffer is full or doesn't exist - create overflow buffer
-	// Grow overflow array if needed
-	if (ref_alloc->overflow_count >= ref_alloc->overflow_capacity) {
-		uint32_t new_cap = ref_alloc->overflow_capacity == 0 ? 4 : ref_alloc->overflow_capacity * 2;
-		skr_buffer_t* new_overflow = _skr_realloc(ref_alloc->overflow, new_cap * sizeof(skr_buffer_t));
-		if (!new_overflow) {
-			skr_log(skr_log_critical, "Failed to grow bump allocator overflow array");
-			return result;
-		}
-		ref_alloc->overflow = new_overflow;
-		ref_alloc->overflow_capacity = new_cap;
-	}
-
-	// Create overflow buffer for this allocation
-	skr_buffer_t* overflow = &ref_alloc->overflow[ref_alloc->overflow_count];
-	*overflow = (skr_buffer_t){0};
-
-	skr_buffer_create(data, size, 1, ref_alloc->buffer_type, skr_use_dynamic, overflow);
-	ref_alloc->overflow_count++;
-
-	// Track total usage in high-water mark (main + all overflow buffers)
-	uint32_t overflow_total = 0;
-	for (uint32_t i = 0; i < ref_alloc->overflow_count; i++) {
-		overflow_total += ref_alloc->overflow[i].size;
-	}
-	uint32_t total_used = ref_alloc->main_used + overflow_total;
-	if (total_used > ref_alloc->high_water_mark) {
-		ref_alloc->high_water_mark = total_used;
-	}
+	skr_buffer_t* page = ref_alloc->pages[ref_alloc->page_curr];
+	memcpy((uint8_t*)page->mapped + aligned_offset, data, size);
+	ref_alloc->frame_used += (aligned_offset - ref_alloc->page_used) + size;
+	ref_alloc->page_used   = aligned_offset + size;
 
-	result.buffer = overflow;
-	result.offset = 0;
+	result.buffer = page;
+	result.offset = aligned_offset;
 	return result;
 }
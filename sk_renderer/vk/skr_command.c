@@ -19,44 +19,68 @@ thread_local int32_t _skr_thread_idx = -1;
 
 bool _skr_cmd_init() {
 	memset(_skr_vk.thread_pools, 0, sizeof(_skr_vk.thread_pools));
+	_skr_vk.submit_queue.count = 0;
+	mtx_init(&_skr_vk.submit_queue.mutex, mtx_plain);
 	return true;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
 
+// Frees everything a ring owns except its timeline, which outlives the
+// thread. The ring's work must already be complete.
+static void _skr_cmd_ring_free(_skr_cmd_ring_t* ref_ring) {
+	// Clear last_submitted so buffer destroys go directly to immediate destruction
+	ref_ring->last_submitted = NULL;
+
+	for (uint32_t c = 0; c < skr_MAX_COMMAND_RING; c++) {
+		_skr_cmd_ring_slot_t* slot = &ref_ring->cmd_ring[c];
+		if (slot->cmd == VK_NULL_HANDLE) continue; // Never used, nothing was created
+
+		// Execute and free any remaining destroy lists
+		_skr_destroy_list_execute(&slot->destroy_list);
+		_skr_destroy_list_free   (&slot->destroy_list);
+
+		// Destroy bump allocators
+		_skr_bump_alloc_destroy(&slot->const_bump);
+		_skr_bump_alloc_destroy(&slot->storage_bump);
+
+		if (slot->descriptor_pool != VK_NULL_HANDLE)
+			vkDestroyDescriptorPool(_skr_vk.device, slot->descriptor_pool, NULL);
+	}
+
+	if (ref_ring->cmd_pool != VK_NULL_HANDLE)
+		vkDestroyCommandPool(_skr_vk.device, ref_ring->cmd_pool, NULL);
+
+	ref_ring->cmd_pool       = VK_NULL_HANDLE;
+	ref_ring->cmd_ring_index = 0;
+	memset(ref_ring->cmd_ring, 0, sizeof(ref_ring->cmd_ring));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
 void _skr_cmd_shutdown() {
+	_skr_cmd_submit_pending();
 	vkDeviceWaitIdle(_skr_vk.device);
 
-	// Destroy thread command pools and per-thread command ring fences
+	// Destroy thread command pools and per-thread timelines
 	mtx_lock(&_skr_vk.thread_pool_mutex);
 	for (uint32_t i = 0; i < skr_MAX_THREAD_POOLS; i++) {
 		_skr_vk_thread_t *thread = &_skr_vk.thread_pools[i];
 
-		// Clear active_cmd and last_submitted so buffer destroys go directly to immediate destruction
-		thread->active_cmd     = NULL;
-		thread->last_submitted = NULL;
-
-		for (uint32_t c = 0; c < skr_MAX_COMMAND_RING; c++) {
-			// Execute and free any remaining destroy lists
-			_skr_destroy_list_execute(&thread->cmd_ring[c].destroy_list);
-			_skr_destroy_list_free   (&thread->cmd_ring[c].destroy_list);
-
-			// Destroy bump allocators
-			_skr_bump_alloc_destroy(&thread->cmd_ring[c].const_bump);
-			_skr_bump_alloc_destroy(&thread->cmd_ring[c].storage_bump);
-
-			if (thread->cmd_ring[c].fence != VK_NULL_HANDLE)
-				vkDestroyFence(_skr_vk.device, thread->cmd_ring[c].fence, NULL);
-			if (thread->cmd_ring[c].descriptor_pool != VK_NULL_HANDLE)
-				vkDestroyDescriptorPool(_skr_vk.device, thread->cmd_ring[c].descriptor_pool, NULL);
-		}
+		// Clear active_cmd so buffer destroys go directly to immediate destruction
+		thread->active_cmd = NULL;
 
-		if (thread->cmd_pool != VK_NULL_HANDLE)
-			vkDestroyCommandPool(_skr_vk.device, thread->cmd_pool, NULL);
+		_skr_cmd_ring_free(&thread->graphics);
+		_skr_cmd_ring_free(&thread->compute);
+		if (thread->graphics.timeline != VK_NULL_HANDLE)
+			vkDestroySemaphore(_skr_vk.device, thread->graphics.timeline, NULL);
+		if (thread->compute.timeline != VK_NULL_HANDLE)
+			vkDestroySemaphore(_skr_vk.device, thread->compute.timeline, NULL);
 
 		*thread = (_skr_vk_thread_t){0};
 	}
 	mtx_unlock(&_skr_vk.thread_pool_mutex);
+	mtx_destroy(&_skr_vk.submit_queue.mutex);
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -70,6 +94,49 @@ _skr_vk_thread_t* _skr_cmd_get_thread() {
 
 ///////////////////////////////////////////////////////////////////////////////
 
+static VkResult _skr_timeline_wait(const VkSemaphore* timelines, const uint64_t* values, uint32_t count, bool any, uint64_t timeout_ns) {
+	return vkWaitSemaphoresKHR(_skr_vk.device, &(VkSemaphoreWaitInfo){
+		.sType          = VK_STRUCTURE_TYPE_SEMAPHORE_WAIT_INFO,
+		.flags          = any ? VK_SEMAPHORE_WAIT_ANY_BIT : 0,
+		.semaphoreCount = count,
+		.pSemaphores    = timelines,
+		.pValues        = values,
+	}, timeout_ns);
+}
+
+static void _skr_cmd_submit_for(VkSemaphore timeline, uint64_t value);
+
+// Async compute work records to the compute ring, when there is one
+static _skr_cmd_ring_t* _skr_cmd_active_ring(_skr_vk_thread_t* ref_pool) {
+	return ref_pool->in_async && _skr_vk.has_async_compute ? &ref_pool->compute : &ref_pool->graphics;
+}
+
+static VkResult _skr_cmd_pool_create(uint32_t queue_family, VkCommandPool* out_pool) {
+	return vkCreateCommandPool(_skr_vk.device, &(VkCommandPoolCreateInfo){
+		.sType            = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO,
+		.flags            = VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT,
+		.queueFamilyIndex = queue_family,
+	}, NULL, out_pool);
+}
+
+static VkResult _skr_timeline_create(VkSemaphore* out_timeline) {
+	return vkCreateSemaphore(_skr_vk.device, &(VkSemaphoreCreateInfo){
+		.sType = VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO,
+		.pNext = &(VkSemaphoreTypeCreateInfo){
+			.sType         = VK_STRUCTURE_TYPE_SEMAPHORE_TYPE_CREATE_INFO,
+			.semaphoreType = VK_SEMAPHORE_TYPE_TIMELINE,
+			.initialValue  = 0,
+		},
+	}, NULL, out_timeline);
+}
+
+static void _skr_thread_destroy_pools(_skr_vk_thread_t* ref_thread) {
+	if (ref_thread->graphics.cmd_pool != VK_NULL_HANDLE) vkDestroyCommandPool(_skr_vk.device, ref_thread->graphics.cmd_pool, NULL);
+	if (ref_thread->compute .cmd_pool != VK_NULL_HANDLE) vkDestroyCommandPool(_skr_vk.device, ref_thread->compute .cmd_pool, NULL);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
 void skr_thread_init() {
 	// Already initialized for this thread
 	if (_skr_thread_idx >= 0) {
@@ -77,16 +144,17 @@ void skr_thread_init() {
 		return;
 	}
 
-	// Create command pool first (outside the lock)
+	// Create command pools first (outside the lock)
 	_skr_vk_thread_t thread = {
 		.alive = true,
 	};
-	VkResult vr = vkCreateCommandPool(_skr_vk.device, &(VkCommandPoolCreateInfo){
-		.sType            = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO,
-		.flags            = VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT,
-		.queueFamilyIndex = _skr_vk.graphics_queue_family,
-	}, NULL, &thread.cmd_pool);
-	SKR_VK_CHECK_RET(vr, "vkCreateCommandPool",);
+	VkResult vr = _skr_cmd_pool_create(_skr_vk.graphics_queue_family, &thread.graphics.cmd_pool);
+	if (vr == VK_SUCCESS && _skr_vk.has_async_compute)
+		vr = _skr_cmd_pool_create(_skr_vk.compute_queue_family, &thread.compute.cmd_pool);
+	if (vr != VK_SUCCESS) {
+		_skr_thread_destroy_pools(&thread);
+		SKR_VK_CHECK_RET(vr, "vkCreateCommandPool",);
+	}
 
 	// Lock and find an available slot
 	mtx_lock(&_skr_vk.thread_pool_mutex);
@@ -102,11 +170,32 @@ void skr_thread_init() {
 
 	if (thread_idx < 0) {
 		mtx_unlock(&_skr_vk.thread_pool_mutex);
-		vkDestroyCommandPool(_skr_vk.device, thread.cmd_pool, NULL);
+		_skr_thread_destroy_pools(&thread);
 		skr_log(skr_log_critical, "Exceeded maximum thread pools (%d)", skr_MAX_THREAD_POOLS);
 		return;
 	}
 
+	// Timelines outlive their thread so futures from a previous owner of
+	// this slot stay valid. Values keep counting up from where it left off.
+	const _skr_vk_thread_t* prev = &_skr_vk.thread_pools[thread_idx];
+	thread.graphics.timeline       = prev->graphics.timeline;
+	thread.graphics.timeline_value = prev->graphics.timeline_value;
+	thread.compute .timeline       = prev->compute .timeline;
+	thread.compute .timeline_value = prev->compute .timeline_value;
+	bool new_timeline = thread.graphics.timeline == VK_NULL_HANDLE;
+	if (new_timeline) {
+		vr = _skr_timeline_create(&thread.graphics.timeline);
+		if (vr == VK_SUCCESS && _skr_vk.has_async_compute)
+			vr = _skr_timeline_create(&thread.compute.timeline);
+		if (vr != VK_SUCCESS) {
+			mtx_unlock(&_skr_vk.thread_pool_mutex);
+			if (thread.graphics.timeline != VK_NULL_HANDLE)
+				vkDestroySemaphore(_skr_vk.device, thread.graphics.timeline, NULL);
+			_skr_thread_destroy_pools(&thread);
+			SKR_VK_CHECK_RET(vr, "vkCreateSemaphore (timeline)",);
+		}
+	}
+
 	// Register thread - set thread_idx and copy to array atomically
 	_skr_thread_idx                  = thread_idx;
 	thread.thread_idx                = thread_idx;
@@ -116,7 +205,19 @@ void skr_thread_init() {
 
 	char name[64];
 	snprintf(name, sizeof(name), "CommandPool_thr%d", thread_idx);
-	_skr_set_debug_name(_skr_vk.device, VK_OBJECT_TYPE_COMMAND_POOL, (uint64_t)thread.cmd_pool, name);
+	_skr_set_debug_name(_skr_vk.device, VK_OBJECT_TYPE_COMMAND_POOL, (uint64_t)thread.graphics.cmd_pool, name);
+	if (new_timeline) {
+		snprintf(name, sizeof(name), "Timeline_thr%d", thread_idx);
+		_skr_set_debug_name(_skr_vk.device, VK_OBJECT_TYPE_SEMAPHORE, (uint64_t)thread.graphics.timeline, name);
+	}
+	if (_skr_vk.has_async_compute) {
+		snprintf(name, sizeof(name), "ComputePool_thr%d", thread_idx);
+		_skr_set_debug_name(_skr_vk.device, VK_OBJECT_TYPE_COMMAND_POOL, (uint64_t)thread.compute.cmd_pool, name);
+		if (new_timeline) {
+			snprintf(name, sizeof(name), "ComputeTimeline_thr%d", thread_idx);
+			_skr_set_debug_name(_skr_vk.device, VK_OBJECT_TYPE_SEMAPHORE, (uint64_t)thread.compute.timeline, name);
+		}
+	}
 
 	return;
 }
@@ -129,6 +230,8 @@ bool skr_thread_is_initialized() {
 
 ///////////////////////////////////////////////////////////////////////////////
 
+static void _skr_cmd_submit_consumes(_skr_vk_thread_t* ref_pool);
+
 void skr_thread_shutdown() {
 	if (_skr_thread_idx < 0) {
 		skr_log(skr_log_warning, "Thread not initialized, nothing to shutdown");
@@ -139,40 +242,32 @@ void skr_thread_shutdown() {
 
 	_skr_vk_thread_t *thread = &_skr_vk.thread_pools[_skr_thread_idx];
 
-	// Clear active_cmd and last_submitted so buffer destroys go directly to immediate destruction
-	thread->active_cmd     = NULL;
-	thread->last_submitted = NULL;
-
-	// Clean up command ring - wait on each fence individually and destroy
-	for (uint32_t c = 0; c < skr_MAX_COMMAND_RING; c++) {
-		if (thread->cmd_ring[c].fence != VK_NULL_HANDLE) {
-			vkWaitForFences(_skr_vk.device, 1, &thread->cmd_ring[c].fence, VK_TRUE, UINT64_MAX);
-		}
-
-		_skr_destroy_list_execute(&thread->cmd_ring[c].destroy_list);
-		_skr_destroy_list_free   (&thread->cmd_ring[c].destroy_list);
-
-		// Destroy bump allocators
-		_skr_bump_alloc_destroy(&thread->cmd_ring[c].const_bump);
-		_skr_bump_alloc_destroy(&thread->cmd_ring[c].storage_bump);
-
-		if (thread->cmd_ring[c].fence != VK_NULL_HANDLE)
-			vkDestroyFence(_skr_vk.device, thread->cmd_ring[c].fence, NULL);
-		if (thread->cmd_ring[c].descriptor_pool != VK_NULL_HANDLE)
-			vkDestroyDescriptorPool(_skr_vk.device, thread->cmd_ring[c].descriptor_pool, NULL);
-	}
-
-	// Destroy command pool
-	if (thread->cmd_pool != VK_NULL_HANDLE)
-		vkDestroyCommandPool(_skr_vk.device, thread->cmd_pool, NULL);
-
-	// Mark as non-alive for reuse (don't zero out the whole struct)
-	thread->alive           = false;
-	thread->cmd_pool        = VK_NULL_HANDLE;
-	thread->active_cmd      = NULL;
-	thread->cmd_ring_index  = 0;
-	thread->ref_count       = 0;
-	memset(thread->cmd_ring, 0, sizeof(thread->cmd_ring));
+	// No submit is coming to consume these, so they get one of their own
+	if (thread->consume_count > 0) _skr_cmd_submit_consumes(thread);
+
+	// Submissions signal each timeline in order, so the last one covers them all
+	_skr_cmd_submit_pending();
+	if (thread->graphics.last_submitted)
+		_skr_timeline_wait(&thread->graphics.timeline, &thread->graphics.last_submitted->timeline_value, 1, false, UINT64_MAX);
+	if (thread->compute.last_submitted)
+		_skr_timeline_wait(&thread->compute.timeline, &thread->compute.last_submitted->timeline_value, 1, false, UINT64_MAX);
+
+	// Clear active_cmd so buffer destroys go directly to immediate destruction
+	thread->active_cmd = NULL;
+
+	// Clean up command rings
+	_skr_cmd_ring_free(&thread->graphics);
+	_skr_cmd_ring_free(&thread->compute);
+
+	// Mark as non-alive for reuse (don't zero out the whole struct, the
+	// timelines are kept for the next thread that takes this slot)
+	thread->alive                 = false;
+	thread->ref_count             = 0;
+	thread->compute_wait          = 0;
+	thread->in_async              = false;
+	thread->consume_count         = 0;
+	thread->async_graphics        = (skr_future_t){0};
+	thread->async_saved_ref_count = 0;
 
 	_skr_thread_idx = -1;
 
@@ -181,52 +276,46 @@ void skr_thread_shutdown() {
 
 ///////////////////////////////////////////////////////////////////////////////
 
-static _skr_cmd_ring_slot_t *_skr_cmd_ring_begin(_skr_vk_thread_t* ref_pool) {
-	// Find available slot in the per-thread command ring
+static _skr_cmd_ring_slot_t *_skr_cmd_ring_begin(_skr_vk_thread_t* ref_pool, _skr_cmd_ring_t* ref_ring) {
+	// Find available slot in the thread's command ring, one whose work the
+	// timeline has already passed. A single counter query covers every slot.
 	_skr_cmd_ring_slot_t* slot      = NULL;
-	uint32_t              start_idx = ref_pool->cmd_ring_index;
+	uint32_t              start_idx = ref_ring->cmd_ring_index;
+	uint64_t              completed = 0;
+	vkGetSemaphoreCounterValueKHR(_skr_vk.device, ref_ring->timeline, &completed);
 
 	uint32_t idx;
 	for (uint32_t i = 0; i < skr_MAX_COMMAND_RING; i++) {
 		idx = (start_idx + i) % skr_MAX_COMMAND_RING;
-		_skr_cmd_ring_slot_t* curr = &ref_pool->cmd_ring[idx];
+		_skr_cmd_ring_slot_t* curr = &ref_ring->cmd_ring[idx];
 
-		// Use this slot if available
-		if (!curr->alive) {
-			slot        = curr;
-			slot->alive = true;
-			ref_pool->cmd_ring_index = (idx + 1) % skr_MAX_COMMAND_RING;
+		if (curr->timeline_value <= completed) {
+			slot = curr;
 			break;
 		}
 	}
 
-	// If no slots available, wait for oldest one
+	// If no slots available, wait for oldest one, it may still be queued
 	if (!slot) {
-		idx         = start_idx;
-		slot        = &ref_pool->cmd_ring[start_idx];
-		slot->alive = true;
-		vkWaitForFences(_skr_vk.device, 1, &slot->fence, VK_TRUE, UINT64_MAX);
-		ref_pool->cmd_ring_index = (start_idx + 1) % skr_MAX_COMMAND_RING;
-
-		// Fence is done, make sure we free its assets too
-		_skr_destroy_list_execute(&slot->destroy_list);
-		_skr_destroy_list_clear  (&slot->destroy_list);
-
-		// Increment generation to invalidate old futures referencing this fence
-		slot->generation++;
+		idx  = start_idx;
+		slot = &ref_ring->cmd_ring[start_idx];
+		_skr_cmd_submit_for(ref_ring->timeline, slot->timeline_value);
+		_skr_timeline_wait(&ref_ring->timeline, &slot->timeline_value, 1, false, UINT64_MAX);
 	}
+	ref_ring->cmd_ring_index = (idx + 1) % skr_MAX_COMMAND_RING;
+
+	// Submissions from this thread happen in ring_begin order, so values
+	// handed out here are signaled in increasing order.
+	slot->timeline_value = ++ref_ring->timeline_value;
 
 	// Allocate command buffer if needed
 	if (slot->cmd == VK_NULL_HANDLE) {
 		vkAllocateCommandBuffers(_skr_vk.device, &(VkCommandBufferAllocateInfo){
 			.sType              = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO,
 			.level              = VK_COMMAND_BUFFER_LEVEL_PRIMARY,
-			.commandPool        = ref_pool->cmd_pool,
+			.commandPool        = ref_ring->cmd_pool,
 			.commandBufferCount = 1,
 		}, &slot->cmd);
-		vkCreateFence(_skr_vk.device, &(VkFenceCreateInfo){
-			.sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO,
-		}, NULL, &slot->fence);
 		slot->destroy_list = _skr_destroy_list_create();
 		_skr_bump_alloc_init(&slot->const_bump,   skr_buffer_type_constant, _skr_vk.min_ubo_offset_align);
 		_skr_bump_alloc_init(&slot->storage_bump, skr_buffer_type_storage,  _skr_vk.min_ssbo_offset_align);
@@ -238,6 +327,8 @@ static _skr_cmd_ring_slot_t *_skr_cmd_ring_begin(_skr_vk_thread_t* ref_pool) {
 				{ .type = VK_DESCRIPTOR_TYPE_STORAGE_IMAGE,          .descriptorCount = 1000 },
 				{ .type = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER, .descriptorCount = 1000 },
 				{ .type = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER,         .descriptorCount = 1000 },
+				{ .type = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC, .descriptorCount = 1000 },
+				{ .type = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER_DYNAMIC, .descriptorCount = 1000 },
 			};
 			VkDescriptorPoolCreateInfo pool_info = {
 				.sType         = VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO,
@@ -250,25 +341,26 @@ static _skr_cmd_ring_slot_t *_skr_cmd_ring_begin(_skr_vk_thread_t* ref_pool) {
 			SKR_VK_CHECK_NRET(vr, "vkCreateDescriptorPool");
 		}
 
+		const char* kind = ref_ring == &ref_pool->compute ? "Compute" : "";
 		char name[64];
-		snprintf(name,sizeof(name), "CommandBuffer_thr%u_%u", ref_pool->thread_idx, idx);
+		snprintf(name,sizeof(name), "%sCommandBuffer_thr%u_%u", kind, ref_pool->thread_idx, idx);
 		_skr_set_debug_name(_skr_vk.device, VK_OBJECT_TYPE_COMMAND_BUFFER, (uint64_t)slot->cmd, name);
 
-		snprintf(name,sizeof(name), "Command_Fence_thr%u_%u", ref_pool->thread_idx, idx);
-		_skr_set_debug_name(_skr_vk.device, VK_OBJECT_TYPE_FENCE, (uint64_t)slot->fence, name);
-
 		if (slot->descriptor_pool != VK_NULL_HANDLE) {
-			snprintf(name,sizeof(name), "DescriptorPool_thr%u_%u", ref_pool->thread_idx, idx);
+			snprintf(name,sizeof(name), "%sDescriptorPool_thr%u_%u", kind, ref_pool->thread_idx, idx);
 			_skr_set_debug_name(_skr_vk.device, VK_OBJECT_TYPE_DESCRIPTOR_POOL, (uint64_t)slot->descriptor_pool, name);
 		}
 	} else {
+		// Slot's previous work is done, make sure we free its assets too
+		_skr_destroy_list_execute(&slot->destroy_list);
+		_skr_destroy_list_clear  (&slot->destroy_list);
+
 		vkResetCommandBuffer(slot->cmd, 0);
-		vkResetFences       (_skr_vk.device, 1, &slot->fence);
 		// Reset descriptor pool when reusing command buffer slot
 		if (slot->descriptor_pool != VK_NULL_HANDLE) {
 			vkResetDescriptorPool(_skr_vk.device, slot->descriptor_pool, 0);
 		}
-		// Reset bump allocators - resizes main buffer if needed, clears overflow
+		// Reset bump allocators - rewinds pages, merges or shrinks them if needed
 		_skr_bump_alloc_reset(&slot->const_bump);
 		_skr_bump_alloc_reset(&slot->storage_bump);
 	}
@@ -349,7 +441,7 @@ _skr_cmd_ctx_t _skr_cmd_acquire() {
 	assert(pool);
 
 	if (pool->ref_count == 0)
-		pool->active_cmd = _skr_cmd_ring_begin(pool);
+		pool->active_cmd = _skr_cmd_ring_begin(pool, _skr_cmd_active_ring(pool));
 
 	pool->ref_count++;
 	return (_skr_cmd_ctx_t){
@@ -363,46 +455,211 @@ _skr_cmd_ctx_t _skr_cmd_acquire() {
 
 ///////////////////////////////////////////////////////////////////////////////
 
-void _skr_cmd_release(VkCommandBuffer buffer) {
-	_skr_vk_thread_t* pool = _skr_cmd_get_thread();
-	assert(pool);
+///////////////////////////////////////////////////////////////////////////////
+// Submission queue - graphics command buffers finished on any thread wait
+// here, and go out together in one vkQueueSubmit at frame end, an explicit
+// skr_cmd_flush, or when something needs to wait on one of them. This keeps
+// loader threads off the graphics queue lock, and the driver sees a few
+// large submits instead of many small ones.
+///////////////////////////////////////////////////////////////////////////////
 
-	pool->ref_count--;
-	assert(pool->ref_count       >= 0      && "Unbalanced acquire/release");
-	assert(pool->active_cmd->cmd == buffer && "Shouldn't release someone else's buffer!");
+// Submits everything pending, followed by opt_last. Call with the submit
+// queue mutex held.
+static void _skr_submit_queue_flush_locked(const VkSubmitInfo* opt_last) {
+	_skr_submit_queue_t* queue = &_skr_vk.submit_queue;
+	uint32_t             count = queue->count;
+	for (uint32_t i = 0; i < count; i++) {
+		_skr_pending_submit_t* pending = &queue->pending[i];
+		bool                   waits   = pending->wait != VK_NULL_HANDLE;
+		queue->timeline_infos[i] = (VkTimelineSemaphoreSubmitInfo){
+			.sType                     = VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO,
+			.waitSemaphoreValueCount   = waits ? 1 : 0,
+			.pWaitSemaphoreValues      = &pending->wait_value,
+			.signalSemaphoreValueCount = 1,
+			.pSignalSemaphoreValues    = &pending->signal_value,
+		};
+		queue->infos[i] = (VkSubmitInfo){
+			.sType                = VK_STRUCTURE_TYPE_SUBMIT_INFO,
+			.pNext                = &queue->timeline_infos[i],
+			.waitSemaphoreCount   = waits ? 1 : 0,
+			.pWaitSemaphores      = &pending->wait,
+			.pWaitDstStageMask    = &pending->wait_stage,
+			.commandBufferCount   = 1,
+			.pCommandBuffers      = &pending->cmd,
+			.signalSemaphoreCount = 1,
+			.pSignalSemaphores    = &pending->signal,
+		};
+	}
+	if (opt_last) queue->infos[count++] = *opt_last;
+	if (count == 0) return;
 
-	if (pool->ref_count == 0) {
-		// Outside a batch: submit the command buffer from the ring
-		// The ring will handle waiting when it needs to reuse a slot
-		vkEndCommandBuffer(pool->active_cmd->cmd);
+	mtx_lock(_skr_vk.graphics_queue_mutex);
+	vkQueueSubmit(_skr_vk.graphics_queue, count, queue->infos, VK_NULL_HANDLE);
+	mtx_unlock(_skr_vk.graphics_queue_mutex);
+	queue->count = 0;
+}
 
-		mtx_lock(_skr_vk.graphics_queue_mutex);
-		vkQueueSubmit(_skr_vk.graphics_queue, 1, &(VkSubmitInfo){
-			.sType              = VK_STRUCTURE_TYPE_SUBMIT_INFO,
-			.commandBufferCount = 1,
-			.pCommandBuffers    = &pool->active_cmd->cmd,
-		}, pool->active_cmd->fence);
-		mtx_unlock(_skr_vk.graphics_queue_mutex);
+void _skr_cmd_submit_pending() {
+	mtx_lock(&_skr_vk.submit_queue.mutex);
+	_skr_submit_queue_flush_locked(NULL);
+	mtx_unlock(&_skr_vk.submit_queue.mutex);
+}
 
-		// Track this as the most recently submitted command
-		pool->last_submitted = pool->active_cmd;
-		pool->active_cmd     = NULL;
+// Submits the queue if a timeline value waited on is still in it, otherwise
+// the wait would never finish
+static void _skr_cmd_submit_for(VkSemaphore timeline, uint64_t value) {
+	_skr_submit_queue_t* queue = &_skr_vk.submit_queue;
+	mtx_lock(&queue->mutex);
+	for (uint32_t i = 0; i < queue->count; i++) {
+		if (queue->pending[i].signal == timeline && queue->pending[i].signal_value <= value) {
+			_skr_submit_queue_flush_locked(NULL);
+			break;
+		}
 	}
+	mtx_unlock(&queue->mutex);
 }
 
 ///////////////////////////////////////////////////////////////////////////////
 
-VkCommandBuffer _skr_cmd_end() {
+static bool _skr_future_gather(const skr_future_t* futures, uint32_t count, bool any, VkSemaphore* out_timelines, uint64_t* out_values, uint32_t* out_count);
+
+// Ends the active slot and submits it on its ring's queue, signaling the
+// ring's timeline along with any caller provided binary semaphores. Graphics
+// submits also wait on async compute recorded since the last one, and
+// compute submits wait on the caller's futures. Graphics work without binary
+// semaphores goes to the submission queue, and only reaches the GPU right
+// away with flush.
+static skr_future_t _skr_cmd_submit(_skr_vk_thread_t* ref_pool, const VkSemaphore* wait_semaphores, uint32_t wait_count, const VkSemaphore* signal_semaphores, uint32_t signal_count, const skr_future_t* opt_wait_futures, uint32_t wait_future_count, bool flush) {
+	_skr_cmd_ring_t*      ring       = _skr_cmd_active_ring(ref_pool);
+	_skr_cmd_ring_slot_t* slot       = ref_pool->active_cmd;
+	bool                  is_compute = ring == &ref_pool->compute;
+	_skr_barrier_flush(slot->cmd);
+	vkEndCommandBuffer(slot->cmd);
+
+	assert(wait_count <= SKR_MAX_SURFACES && "Wait count exceeds maximum surfaces");
+	assert(signal_count <= SKR_MAX_SURFACES && "Signal count exceeds maximum surfaces");
+
+	// Binary semaphores first, timelines after, binary values are ignored
+	VkSemaphore          waits      [SKR_MAX_SURFACES + SKR_MAX_CONSUME_WAITS + SKR_MAX_TIMELINES];
+	uint64_t             wait_values[SKR_MAX_SURFACES + SKR_MAX_CONSUME_WAITS + SKR_MAX_TIMELINES] = {0};
+	VkPipelineStageFlags wait_stages[SKR_MAX_SURFACES + SKR_MAX_CONSUME_WAITS + SKR_MAX_TIMELINES];
+	uint32_t             wait_total = wait_count;
+	for (uint32_t i = 0; i < wait_count; i++) {
+		waits      [i] = wait_semaphores[i];
+		wait_stages[i] = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT;
+	}
+	// Stray acquire semaphores ride along on graphics submits, and are
+	// destroyed with this slot once its work is done
+	if (!is_compute) {
+		for (uint32_t i = 0; i < ref_pool->consume_count; i++) {
+			waits      [wait_total] = ref_pool->consume_waits[i];
+			wait_stages[wait_total] = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT;
+			wait_total++;
+			_skr_cmd_destroy_semaphore(&slot->destroy_list, ref_pool->consume_waits[i]);
+		}
+		ref_pool->consume_count = 0;
+	}
+	uint32_t binary_count = wait_total;
+	if (is_compute) {
+		uint32_t timeline_count = 0;
+		_skr_future_gather(opt_wait_futures, wait_future_count, false, &waits[wait_total], &wait_values[wait_total], &timeline_count);
+		for (uint32_t i = 0; i < timeline_count; i++)
+			wait_stages[wait_total + i] = VK_PIPELINE_STAGE_ALL_COMMANDS_BIT;
+		wait_total += timeline_count;
+	} else if (ref_pool->compute_wait != 0) {
+		waits      [wait_total] = ref_pool->compute.timeline;
+		wait_values[wait_total] = ref_pool->compute_wait;
+		wait_stages[wait_total] = VK_PIPELINE_STAGE_DRAW_INDIRECT_BIT | VK_PIPELINE_STAGE_VERTEX_INPUT_BIT | VK_PIPELINE_STAGE_VERTEX_SHADER_BIT |
+		                          VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT | VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT | VK_PIPELINE_STAGE_TRANSFER_BIT;
+		wait_total++;
+		ref_pool->compute_wait = 0;
+	}
+
+	// Timeline goes last
+	VkSemaphore signals      [SKR_MAX_SURFACES + 1];
+	uint64_t    signal_values[SKR_MAX_SURFACES + 1] = {0};
+	for (uint32_t i = 0; i < signal_count; i++) {
+		signals[i] = signal_semaphores[i];
+	}
+	signals      [signal_count] = ring->timeline;
+	signal_values[signal_count] = slot->timeline_value;
+
+	VkTimelineSemaphoreSubmitInfo timeline_info = {
+		.sType                     = VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO,
+		.waitSemaphoreValueCount   = wait_total,
+		.pWaitSemaphoreValues      = wait_values,
+		.signalSemaphoreValueCount = signal_count + 1,
+		.pSignalSemaphoreValues    = signal_values,
+	};
+	VkSubmitInfo submit_info = {
+		.sType                = VK_STRUCTURE_TYPE_SUBMIT_INFO,
+		.pNext                = &timeline_info,
+		.commandBufferCount   = 1,
+		.pCommandBuffers      = &slot->cmd,
+		.waitSemaphoreCount   = wait_total,
+		.pWaitSemaphores      = waits,
+		.pWaitDstStageMask    = wait_total > 0 ? wait_stages : NULL,
+		.signalSemaphoreCount = signal_count + 1,
+		.pSignalSemaphores    = signals,
+	};
+
+	if (is_compute) {
+		// Futures being waited on may still be in the submission queue
+		if (wait_future_count > 0) _skr_cmd_submit_pending();
+		mtx_lock(_skr_vk.compute_queue_mutex);
+		vkQueueSubmit(_skr_vk.compute_queue, 1, &submit_info, VK_NULL_HANDLE);
+		mtx_unlock(_skr_vk.compute_queue_mutex);
+	} else {
+		_skr_submit_queue_t* queue = &_skr_vk.submit_queue;
+		mtx_lock(&queue->mutex);
+		if (binary_count == 0 && signal_count == 0) {
+			// Only timelines involved, so it can wait for the next batch. At
+			// most one compute timeline wait comes through here. A full queue
+			// goes out now rather than overflowing.
+			if (queue->count >= SKR_MAX_PENDING_SUBMITS) _skr_submit_queue_flush_locked(NULL);
+			queue->pending[queue->count++] = (_skr_pending_submit_t){
+				.cmd          = slot->cmd,
+				.wait         = wait_total > 0 ? waits      [0] : VK_NULL_HANDLE,
+				.wait_value   = wait_total > 0 ? wait_values[0] : 0,
+				.wait_stage   = wait_total > 0 ? wait_stages[0] : VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT,
+				.signal       = ring->timeline,
+				.signal_value = slot->timeline_value,
+			};
+			if (flush) _skr_submit_queue_flush_locked(NULL);
+		} else {
+			// Surface semaphores mean a present is waiting, send it all now
+			_skr_submit_queue_flush_locked(&submit_info);
+		}
+		mtx_unlock(&queue->mutex);
+	}
+
+	// Track this as the most recently submitted command, graphics work from
+	// this thread now depends on it if it was async compute
+	ring->last_submitted = slot;
+	ref_pool->active_cmd = NULL;
+	if (is_compute) ref_pool->compute_wait = slot->timeline_value;
+
+	return (skr_future_t){
+		.timeline = ring->timeline,
+		.value    = slot->timeline_value,
+	};
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+void _skr_cmd_release(VkCommandBuffer buffer) {
 	_skr_vk_thread_t* pool = _skr_cmd_get_thread();
 	assert(pool);
 
 	pool->ref_count--;
-	assert(pool->ref_count == 0 && "Unbalanced acquire/release - ref count should be 0");
-
-	// Track this as the most recently used command (not yet submitted, but will be soon)
-	pool->last_submitted = pool->active_cmd;
+	assert(pool->ref_count       >= 0      && "Unbalanced acquire/release");
+	assert(pool->active_cmd->cmd == buffer && "Shouldn't release someone else's buffer!");
 
-	return pool->active_cmd->cmd;
+	if (pool->ref_count == 0) {
+		// Outside a batch: queue the command buffer for submission
+		// The ring will handle waiting when it needs to reuse a slot
+		_skr_cmd_submit(pool, NULL, 0, NULL, 0, NULL, 0, false);
+	}
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -414,47 +671,35 @@ skr_future_t _skr_cmd_end_submit(const VkSemaphore* wait_semaphores, uint32_t wa
 	pool->ref_count--;
 	assert(pool->ref_count == 0 && "Unbalanced acquire/release - ref count should be 0");
 
-	// End the command buffer
-	vkEndCommandBuffer(pool->active_cmd->cmd);
-
-	// Build wait stages (one per wait semaphore)
-	assert(wait_count <= SKR_MAX_SURFACES && "Wait count exceeds maximum surfaces");
-	assert(signal_count <= SKR_MAX_SURFACES && "Signal count exceeds maximum surfaces");
+	return _skr_cmd_submit(pool, wait_semaphores, wait_count, signal_semaphores, signal_count, NULL, 0, true);
+}
 
-	VkPipelineStageFlags wait_stages[SKR_MAX_SURFACES];
-	for (uint32_t i = 0; i < wait_count; i++) {
-		wait_stages[i] = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT;
-	}
+// Submits what this thread has recorded so far, carrying the queued consume
+// waits. Only for when no real submit will come along in time, recording
+// carries on in a new batch like skr_cmd_flush.
+static void _skr_cmd_submit_consumes(_skr_vk_thread_t* ref_pool) {
+	int32_t saved_ref_count = ref_pool->ref_count;
+	if (ref_pool->active_cmd == NULL) ref_pool->active_cmd = _skr_cmd_ring_begin(ref_pool, &ref_pool->graphics);
 
-	// Submit with command buffer's fence
-	mtx_lock(_skr_vk.graphics_queue_mutex);
-	vkQueueSubmit(_skr_vk.graphics_queue, 1, &(VkSubmitInfo){
-		.sType                = VK_STRUCTURE_TYPE_SUBMIT_INFO,
-		.commandBufferCount   = 1,
-		.pCommandBuffers      = &pool->active_cmd->cmd,
-		.waitSemaphoreCount   = wait_count,
-		.pWaitSemaphores      = wait_semaphores,
-		.pWaitDstStageMask    = wait_count > 0 ? wait_stages : NULL,
-		.signalSemaphoreCount = signal_count,
-		.pSignalSemaphores    = signal_semaphores,
-	}, pool->active_cmd->fence);  // Always use command buffer's fence
-	mtx_unlock(_skr_vk.graphics_queue_mutex);
+	_skr_cmd_submit(ref_pool, NULL, 0, NULL, 0, NULL, 0, true);
 
-	// Create future for this submission
-	skr_future_t future = {
-		.slot       = pool->active_cmd,
-		.generation = pool->active_cmd->generation,
-	};
+	ref_pool->ref_count  = saved_ref_count;
+	ref_pool->active_cmd = saved_ref_count > 0 ? _skr_cmd_ring_begin(ref_pool, &ref_pool->graphics) : NULL;
+}
 
-	// Track this as the most recently submitted command
-	pool->last_submitted = pool->active_cmd;
-	pool->active_cmd     = NULL;
+// Hands a binary semaphore nobody else will wait on to this thread's next
+// graphics submit, which consumes its signal and then destroys it. The
+// frame's own submit normally carries it, so nothing is split.
+void _skr_cmd_consume_semaphore(VkSemaphore semaphore) {
+	_skr_vk_thread_t* pool = _skr_cmd_get_thread();
+	assert(pool && !pool->in_async && "Binary semaphores are consumed on the graphics queue");
 
-	return future;
+	// Only a thread that keeps skipping acquires without ever submitting
+	// gets here, send what's queued rather than grow without bound
+	if (pool->consume_count >= SKR_MAX_CONSUME_WAITS) _skr_cmd_submit_consumes(pool);
+	pool->consume_waits[pool->consume_count++] = semaphore;
 }
 
-//TODO: all of this is just using the graphics_queue! It should be configurable
-
 ///////////////////////////////////////////////////////////////////////////////
 // Future API - for GPU/CPU synchronization
 ///////////////////////////////////////////////////////////////////////////////
@@ -464,54 +709,101 @@ skr_future_t skr_future_get() {
 
 	// Invalid future if not on an initialized thread
 	if (!pool || !pool->alive) {
-		return (skr_future_t){ .slot = NULL, .generation = 0 };
+		return (skr_future_t){0};
 	}
 
 	// Prefer active_cmd if we're currently recording, otherwise use last_submitted
-	_skr_cmd_ring_slot_t* target = pool->active_cmd ? pool->active_cmd : pool->last_submitted;
+	_skr_cmd_ring_t*      ring   = _skr_cmd_active_ring(pool);
+	_skr_cmd_ring_slot_t* target = pool->active_cmd ? pool->active_cmd : ring->last_submitted;
 
 	// Return invalid if no command has been submitted yet
-	if (!target || target->fence == VK_NULL_HANDLE) {
-		return (skr_future_t){ .slot = NULL, .generation = 0 };
+	if (!target) {
+		return (skr_future_t){0};
 	}
 
 	return (skr_future_t){
-		.slot       = target,
-		.generation = target->generation,
+		.timeline = ring->timeline,
+		.value    = target->timeline_value,
 	};
 }
 
 bool skr_future_check(const skr_future_t* future) {
-	if (!future || !future->slot) {
+	if (!future || !future->timeline) {
 		return true; // Invalid futures are considered "done"
 	}
 
-	_skr_cmd_ring_slot_t* slot = (_skr_cmd_ring_slot_t*)future->slot;
-
-	// If generation doesn't match, the slot was reused, so the original work is done
-	if (slot->generation != future->generation) {
-		return true;
-	}
+	// Query timeline counter (non-blocking)
+	uint64_t completed = 0;
+	vkGetSemaphoreCounterValueKHR(_skr_vk.device, future->timeline, &completed);
+	if (completed >= future->value) return true;
 
-	// Query fence status (non-blocking)
-	VkResult result = vkGetFenceStatus(_skr_vk.device, slot->fence);
-	return result == VK_SUCCESS; // VK_SUCCESS = signaled, VK_NOT_READY = not signaled
+	// Someone is polling for it, so it shouldn't sit in the queue until frame end
+	_skr_cmd_submit_for(future->timeline, future->value);
+	return false;
 }
 
 void skr_future_wait(const skr_future_t* future) {
-	if (!future || !future->slot) {
+	if (!future || !future->timeline) {
 		return; // Invalid futures are no-op
 	}
 
-	_skr_cmd_ring_slot_t* slot = (_skr_cmd_ring_slot_t*)future->slot;
+	// Block until timeline reaches the value
+	_skr_cmd_submit_for(future->timeline, future->value);
+	_skr_timeline_wait(&future->timeline, &future->value, 1, false, UINT64_MAX);
+}
 
-	// If generation doesn't match, the slot was reused, so work is already done
-	if (slot->generation != future->generation) {
-		return;
+// Collapses futures to one value per timeline: the lowest for "any", the
+// highest for "all". There are at most SKR_MAX_TIMELINES timelines, so
+// any number of futures fits in a fixed size wait. Returns false if an
+// invalid (already done) future satisfies an "any" wait on its own.
+static bool _skr_future_gather(const skr_future_t* futures, uint32_t count, bool any, VkSemaphore* out_timelines, uint64_t* out_values, uint32_t* out_count) {
+	*out_count = 0;
+	for (uint32_t i = 0; i < count; i++) {
+		if (!futures[i].timeline) {
+			if (any) return false;
+			continue;
+		}
+
+		uint32_t t = 0;
+		while (t < *out_count && out_timelines[t] != futures[i].timeline) t++;
+		if (t == *out_count) {
+			if (*out_count == SKR_MAX_TIMELINES) continue; // Can't happen, timelines are per thread slot
+			out_timelines[t] = futures[i].timeline;
+			out_values   [t] = futures[i].value;
+			(*out_count)++;
+		} else if (any ? futures[i].value < out_values[t] : futures[i].value > out_values[t]) {
+			out_values[t] = futures[i].value;
+		}
 	}
+	return true;
+}
+
+bool skr_future_wait_any(const skr_future_t* futures, uint32_t count, uint64_t timeout_ns) {
+	if (!futures || count == 0) return true;
+
+	VkSemaphore timelines[SKR_MAX_TIMELINES];
+	uint64_t    values   [SKR_MAX_TIMELINES];
+	uint32_t    timeline_count;
+	if (!_skr_future_gather(futures, count, true, timelines, values, &timeline_count) || timeline_count == 0)
+		return true;
+	for (uint32_t i = 0; i < timeline_count; i++)
+		_skr_cmd_submit_for(timelines[i], values[i]);
 
-	// Block until fence signals
-	vkWaitForFences(_skr_vk.device, 1, &slot->fence, VK_TRUE, UINT64_MAX);
+	return _skr_timeline_wait(timelines, values, timeline_count, true, timeout_ns) == VK_SUCCESS;
+}
+
+bool skr_future_wait_all(const skr_future_t* futures, uint32_t count, uint64_t timeout_ns) {
+	if (!futures || count == 0) return true;
+
+	VkSemaphore timelines[SKR_MAX_TIMELINES];
+	uint64_t    values   [SKR_MAX_TIMELINES];
+	uint32_t    timeline_count;
+	_skr_future_gather(futures, count, false, timelines, values, &timeline_count);
+	if (timeline_count == 0) return true;
+	for (uint32_t i = 0; i < timeline_count; i++)
+		_skr_cmd_submit_for(timelines[i], values[i]);
+
+	return _skr_timeline_wait(timelines, values, timeline_count, false, timeout_ns) == VK_SUCCESS;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -528,8 +820,8 @@ skr_future_t skr_cmd_end() {
 
 	// Capture future before potentially clearing active_cmd
 	skr_future_t future = {
-		.slot       = pool->active_cmd,
-		.generation = pool->active_cmd->generation,
+		.timeline = _skr_cmd_active_ring(pool)->timeline,
+		.value    = pool->active_cmd->timeline_value,
 	};
 
 	_skr_cmd_release(pool->active_cmd->cmd);
@@ -537,46 +829,104 @@ skr_future_t skr_cmd_end() {
 	return future;
 }
 
+///////////////////////////////////////////////////////////////////////////////
+// Async compute - work between begin/end records to the thread's compute
+// ring and runs on the dedicated compute queue, overlapping with rendering.
+// Graphics recorded earlier on this thread is submitted at begin and the
+// compute waits on it, graphics submitted afterwards waits on the compute.
+// Anything else the compute work depends on is passed to end as futures.
+///////////////////////////////////////////////////////////////////////////////
+
+void skr_compute_async_begin() {
+	_skr_vk_thread_t* pool = _skr_cmd_get_thread();
+	assert(pool && !pool->in_async && "skr_compute_async_begin can't nest");
+
+	if (_skr_vk.has_async_compute) {
+		// Uploads and transitions recorded so far must run before the compute
+		// that reads them, and hazard tracking already assumes they did. So
+		// the open graphics batch goes out now, and a fresh one starts at end.
+		pool->async_saved_ref_count = pool->ref_count;
+		if (pool->active_cmd) _skr_cmd_submit(pool, NULL, 0, NULL, 0, NULL, 0, true);
+		pool->async_graphics = pool->graphics.last_submitted
+			? (skr_future_t){ .timeline = pool->graphics.timeline, .value = pool->graphics.last_submitted->timeline_value }
+			: (skr_future_t){0};
+		pool->active_cmd = NULL;
+		pool->ref_count  = 0;
+	}
+	pool->in_async = true;
+	_skr_cmd_ctx_t ctx = _skr_cmd_acquire();
+
+	// Hazard tracking is shared with graphics, whose barriers don't reach
+	// this queue. One barrier up front covers earlier async compute work.
+	if (_skr_vk.has_async_compute) {
+		_skr_barrier_memory(ctx.cmd,
+			VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT | VK_PIPELINE_STAGE_TRANSFER_BIT,
+			VK_PIPELINE_STAGE_DRAW_INDIRECT_BIT  | VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT | VK_PIPELINE_STAGE_TRANSFER_BIT,
+			VK_ACCESS_SHADER_WRITE_BIT | VK_ACCESS_TRANSFER_WRITE_BIT,
+			VK_ACCESS_INDIRECT_COMMAND_READ_BIT | VK_ACCESS_SHADER_READ_BIT | VK_ACCESS_SHADER_WRITE_BIT | VK_ACCESS_TRANSFER_READ_BIT | VK_ACCESS_TRANSFER_WRITE_BIT);
+	}
+}
+
+skr_future_t skr_compute_async_end(const skr_future_t* opt_waits, uint32_t wait_count) {
+	_skr_vk_thread_t* pool = _skr_cmd_get_thread();
+	assert(pool && pool->in_async && "Unbalanced skr_compute_async_begin/end");
+
+	// Without a dedicated queue, this was just a batch on the graphics queue
+	if (!_skr_vk.has_async_compute) {
+		pool->in_async = false;
+		return skr_cmd_end();
+	}
+
+	pool->ref_count--;
+	assert(pool->ref_count == 0 && "Unbalanced acquire/release inside async compute");
+
+	// Wait on the graphics submitted at begin along with the caller's futures
+	skr_future_t  stack_waits[8];
+	skr_future_t* waits = wait_count + 1 <= 8 ? stack_waits : _skr_malloc((wait_count + 1) * sizeof(skr_future_t));
+	if (!waits) {
+		skr_log(skr_log_critical, "skr_compute_async_end failed to allocate waits");
+		waits      = stack_waits;
+		wait_count = 0;
+	}
+	for (uint32_t i = 0; i < wait_count; i++) waits[i] = opt_waits[i];
+	waits[wait_count] = pool->async_graphics;
+	skr_future_t future = _skr_cmd_submit(pool, NULL, 0, NULL, 0, waits, wait_count + 1, true);
+	if (waits != stack_waits) _skr_free(waits);
+
+	// Outstanding graphics acquires continue in a new batch, which waits on
+	// the compute through compute_wait
+	pool->in_async              = false;
+	pool->ref_count             = pool->async_saved_ref_count;
+	pool->active_cmd            = pool->ref_count > 0 ? _skr_cmd_ring_begin(pool, &pool->graphics) : NULL;
+	pool->async_graphics        = (skr_future_t){0};
+	pool->async_saved_ref_count = 0;
+	return future;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 
 skr_future_t skr_cmd_flush() {
 	_skr_vk_thread_t* pool = _skr_cmd_get_thread();
 	assert(pool);
 
-	// Nothing to flush if not recording
+	// Nothing of ours to flush if not recording, but other threads may have
+	// work queued
 	if (pool->active_cmd == NULL || pool->ref_count == 0) {
-		return (skr_future_t){ .slot = NULL, .generation = 0 };
+		_skr_cmd_submit_pending();
+		return (skr_future_t){0};
 	}
 
 	// Save ref_count - we need to restore this level after starting new batch
 	int32_t saved_ref_count = pool->ref_count;
 
-	// End recording
-	vkEndCommandBuffer(pool->active_cmd->cmd);
-
-	// Submit with no semaphores (mid-frame, not tied to surface)
-	mtx_lock(_skr_vk.graphics_queue_mutex);
-	vkQueueSubmit(_skr_vk.graphics_queue, 1, &(VkSubmitInfo){
-		.sType              = VK_STRUCTURE_TYPE_SUBMIT_INFO,
-		.commandBufferCount = 1,
-		.pCommandBuffers    = &pool->active_cmd->cmd,
-	}, pool->active_cmd->fence);
-	mtx_unlock(_skr_vk.graphics_queue_mutex);
-
-	// Create future before clearing active_cmd
-	skr_future_t result = {
-		.slot       = pool->active_cmd,
-		.generation = pool->active_cmd->generation,
-	};
-
-	// Mark this slot as submitted and clear
-	pool->last_submitted = pool->active_cmd;
-	pool->active_cmd     = NULL;
-	pool->ref_count      = 0;
+	// Submit with no semaphores (mid-frame, not tied to surface). Flushing
+	// is explicit, so everything queued from other threads goes out too.
+	skr_future_t result = _skr_cmd_submit(pool, NULL, 0, NULL, 0, NULL, 0, true);
+	pool->ref_count = 0;
 
 	// Immediately start a new batch at the same ref level
 	// This ensures outstanding acquires still have a valid command buffer
-	pool->active_cmd = _skr_cmd_ring_begin(pool);
+	pool->active_cmd = _skr_cmd_ring_begin(pool, _skr_cmd_active_ring(pool));
 	pool->ref_count  = saved_ref_count;
 
 	return result;
@@ -10,6 +10,20 @@
 #include <stdlib.h>
 #include <string.h>
 
+static VkResult _skr_compute_create_pipeline(const skr_shader_t* shader, VkPipelineLayout layout, VkPipeline* out_pipeline) {
+	VkComputePipelineCreateInfo pipeline_info = {
+		.sType  = VK_STRUCTURE_TYPE_COMPUTE_PIPELINE_CREATE_INFO,
+		.stage  = (VkPipelineShaderStageCreateInfo){
+			.sType  = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO,
+			.stage  = VK_SHADER_STAGE_COMPUTE_BIT,
+			.module = shader->compute_stage.shader,
+			.pName  = "cs",
+		},
+		.layout = layout,
+	};
+	return vkCreateComputePipelines(_skr_vk.device, _skr_vk.pipeline_cache, 1, &pipeline_info, NULL, out_pipeline);
+}
+
 skr_err_ skr_compute_create(const skr_shader_t* shader, skr_compute_t* out_compute) {
 	if (!out_compute) return skr_err_invalid_parameter;
 
@@ -21,6 +35,11 @@ skr_err_ skr_compute_create(const skr_shader_t* shader, skr_compute_t* out_compu
 		return skr_err_invalid_parameter;
 	}
 
+	if (shader->bindless && !_skr_bindless_available()) {
+		skr_log(skr_log_critical, "Compute shader '%s' needs bindless, which isn't available", shader->meta->name);
+		return skr_err_unsupported;
+	}
+
 	out_compute->shader = shader;
 
 	// Create descriptor set layout
@@ -30,6 +49,8 @@ skr_err_ skr_compute_create(const skr_shader_t* shader, skr_compute_t* out_compu
 
 		// Add buffer bindings
 		for (uint32_t i = 0; i < shader->meta->buffer_count; i++) {
+			if (shader->meta->buffers[i].bind.register_type == skr_register_push_constant) continue;
+
 			VkDescriptorType desc_type = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
 			if (shader->meta->buffers[i].bind.register_type == skr_register_readwrite) {
 				desc_type = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
@@ -78,14 +99,22 @@ skr_err_ skr_compute_create(const skr_shader_t* shader, skr_compute_t* out_compu
 		SKR_VK_CHECK_RET(vr, "vkCreateDescriptorSetLayout", skr_err_device_error);
 	}
 
-	// Create pipeline layout
+	// Create pipeline layout, bindless shaders add the global tables as a second set
 	VkPipelineLayoutCreateInfo pipeline_layout_info = {
-		.sType          = VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO,
-		.setLayoutCount = out_compute->descriptor_layout != VK_NULL_HANDLE ? 1 : 0,
-		.pSetLayouts    = out_compute->descriptor_layout != VK_NULL_HANDLE ? &out_compute->descriptor_layout : NULL,
+		.sType                  = VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO,
+		.setLayoutCount         = out_compute->descriptor_layout != VK_NULL_HANDLE ? 1 : 0,
+		.pSetLayouts            = out_compute->descriptor_layout != VK_NULL_HANDLE ? &out_compute->descriptor_layout : NULL,
+		.pushConstantRangeCount = shader->push_range.size > 0 ? 1 : 0,
+		.pPushConstantRanges    = shader->push_range.size > 0 ? &shader->push_range : NULL,
 	};
 
-	VkResult vr = vkCreatePipelineLayout(_skr_vk.device, &pipeline_layout_info, NULL, &out_compute->layout);
+	VkResult vr = VK_SUCCESS;
+	if (shader->bindless) {
+		out_compute->layout = _skr_bindless_create_layout(out_compute->descriptor_layout, shader->push_range);
+		if (out_compute->layout == VK_NULL_HANDLE) vr = VK_ERROR_INITIALIZATION_FAILED;
+	} else {
+		vr = vkCreatePipelineLayout(_skr_vk.device, &pipeline_layout_info, NULL, &out_compute->layout);
+	}
 	if (vr != VK_SUCCESS) {
 		SKR_VK_CHECK_NRET(vr, "vkCreatePipelineLayout");
 		if (out_compute->descriptor_layout) {
@@ -96,18 +125,8 @@ skr_err_ skr_compute_create(const skr_shader_t* shader, skr_compute_t* out_compu
 	}
 
 	// Create compute pipeline
-	VkComputePipelineCreateInfo pipeline_info = {
-		.sType  = VK_STRUCTURE_TYPE_COMPUTE_PIPELINE_CREATE_INFO,
-		.stage  = (VkPipelineShaderStageCreateInfo){
-			.sType  = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO,
-			.stage  = VK_SHADER_STAGE_COMPUTE_BIT,
-			.module = shader->compute_stage.shader,
-			.pName  = "cs",
-		},
-		.layout = out_compute->layout,
-	};
-
-	vr = vkCreateComputePipelines(_skr_vk.device, _skr_vk.pipeline_cache, 1, &pipeline_info, NULL, &out_compute->pipeline);
+	vr = _skr_compute_create_pipeline(shader, out_compute->layout, &out_compute->pipeline);
+	out_compute->shader_reloads = shader->reloads;
 	if (vr != VK_SUCCESS) {
 		SKR_VK_CHECK_NRET(vr, "vkCreateComputePipelines");
 		vkDestroyPipelineLayout(_skr_vk.device, out_compute->layout, NULL);
@@ -317,8 +336,103 @@ void skr_compute_get_param(const skr_compute_t* compute, const char* name, sksc_
 	memcpy(out_data, (uint8_t*)compute->param_buffer + var->offset, copy_size);
 }
 
+void skr_compute_set_tex_id(skr_compute_t* ref_compute, skr_param_id_t id, skr_tex_t* texture) {
+	if (!ref_compute) return;
+	if (!_skr_material_bind_is_tex(ref_compute->shader->meta, id.bind_idx) || id.bind_idx >= (int32_t)ref_compute->bind_count) {
+		skr_log(skr_log_warning, "skr_compute_set_tex_id: id isn't a texture");
+		return;
+	}
+	ref_compute->binds[id.bind_idx].texture = texture;
+}
+
+void skr_compute_set_buffer_id(skr_compute_t* ref_compute, skr_param_id_t id, skr_buffer_t* buffer) {
+	if (!ref_compute) return;
+	if (!_skr_material_bind_is_buffer(ref_compute->shader->meta, id.bind_idx) || id.bind_idx >= (int32_t)ref_compute->bind_count) {
+		skr_log(skr_log_warning, "skr_compute_set_buffer_id: id isn't a buffer");
+		return;
+	}
+	ref_compute->binds[id.bind_idx].buffer = buffer;
+}
+
+void skr_compute_set_param_id(skr_compute_t* ref_compute, skr_param_id_t id, const void* data, uint32_t size) {
+	if (!ref_compute) return;
+	if (!ref_compute->param_buffer || size == 0 || size > id.size || id.offset + size > ref_compute->param_buffer_size) {
+		skr_log(skr_log_warning, "Compute parameter id doesn't fit this compute");
+		return;
+	}
+	memcpy((uint8_t*)ref_compute->param_buffer + id.offset, data, size);
+	ref_compute->param_dirty = true;
+}
+
+// Finds the hazard state a compute bind touches, NULL for binds that aren't
+// tracked (constant buffers are CPU written through the bump allocator)
+static skr_hazard_t* _skr_compute_bind_hazard(const skr_material_bind_t* bind, bool* out_write) {
+	switch (bind->bind.register_type) {
+	case skr_register_readwrite_tex: *out_write = true;  return bind->texture ? &bind->texture->hazard  : NULL;
+	case skr_register_texture:       *out_write = false; return bind->texture ? &bind->texture->hazard  : NULL;
+	case skr_register_readwrite:     *out_write = true;  return bind->buffer  ? &bind->buffer ->_hazard : NULL;
+	case skr_register_read_buffer:   *out_write = false; return bind->buffer  ? &bind->buffer ->_hazard : NULL;
+	default: return NULL;
+	}
+}
+
+// Transitions bound textures and adds barriers only against the resources
+// this dispatch actually shares with earlier, unsynchronized compute work.
+static void _skr_compute_sync_binds(VkCommandBuffer cmd, skr_compute_t* ref_compute) {
+	for (uint32_t i = 0; i < ref_compute->bind_count; i++) {
+		skr_material_bind_t *res = &ref_compute->binds[i];
+		if      (res->bind.register_type == skr_register_readwrite_tex && res->texture) {_skr_tex_transition_for_storage    (cmd, res->texture); }
+		else if (res->bind.register_type == skr_register_texture       && res->texture) {_skr_tex_transition_for_shader_read(cmd, res->texture, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT); }
+
+		bool          write  = false;
+		skr_hazard_t* hazard = _skr_compute_bind_hazard(res, &write);
+		if (hazard) _skr_hazard_access(cmd, hazard, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT,
+			write ? (VK_ACCESS_SHADER_READ_BIT | VK_ACCESS_SHADER_WRITE_BIT) : VK_ACCESS_SHADER_READ_BIT, write);
+	}
+}
+
+static void _skr_compute_record_binds(skr_compute_t* ref_compute) {
+	for (uint32_t i = 0; i < ref_compute->bind_count; i++) {
+		bool          write  = false;
+		skr_hazard_t* hazard = _skr_compute_bind_hazard(&ref_compute->binds[i], &write);
+		if (hazard) _skr_hazard_record(hazard, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT,
+			write ? VK_ACCESS_SHADER_WRITE_BIT : VK_ACCESS_SHADER_READ_BIT, write);
+	}
+}
+
 void skr_compute_execute(skr_compute_t* ref_compute, uint32_t x, uint32_t y, uint32_t z) {
-	if (!skr_compute_is_valid(ref_compute)) return;
+	skr_compute_dispatch_batch(ref_compute, &(skr_compute_dispatch_t){ .x = x, .y = y, .z = z }, 1);
+}
+
+static int32_t _skr_compute_find_bind(const skr_compute_t* compute, skr_bind_t bind) {
+	for (uint32_t i = 0; i < compute->bind_count; i++) {
+		if (compute->binds[i].bind.slot == bind.slot) return (int32_t)i;
+	}
+	return -1;
+}
+
+// After skr_shader_reload, swap in a pipeline built from the new module.
+// The layout stays, a reload can't change the shader's interface.
+static void _skr_compute_refresh_pipeline(skr_compute_t* ref_compute) {
+	if (ref_compute->shader_reloads == ref_compute->shader->reloads) return;
+	ref_compute->shader_reloads = ref_compute->shader->reloads;
+
+	VkPipeline pipeline = VK_NULL_HANDLE;
+	VkResult   vr       = _skr_compute_create_pipeline(ref_compute->shader, ref_compute->layout, &pipeline);
+	if (vr != VK_SUCCESS) {
+		SKR_VK_CHECK_NRET(vr, "vkCreateComputePipelines");
+		return; // Keep the old pipeline running
+	}
+	_skr_cmd_destroy_pipeline(NULL, ref_compute->pipeline);
+	ref_compute->pipeline = pipeline;
+}
+
+// Records a run of dispatches with one command buffer acquire and pipeline
+// bind. The first dispatch writes every descriptor, later ones only re-write
+// bindings that changed (or all of them when push descriptors aren't
+// available, since each dispatch then needs a fresh set).
+void skr_compute_dispatch_batch(skr_compute_t* ref_compute, const skr_compute_dispatch_t* dispatches, uint32_t count) {
+	if (!skr_compute_is_valid(ref_compute) || !dispatches || count == 0) return;
 
 	const sksc_shader_meta_t* meta = ref_compute->shader->meta;
 
@@ -326,72 +440,114 @@ void skr_compute_execute(skr_compute_t* ref_compute, uint32_t x, uint32_t y, uin
 	_skr_cmd_ctx_t  ctx = _skr_cmd_acquire();
 	VkCommandBuffer cmd = ctx.cmd;
 	if (!cmd) {
-		skr_log(skr_log_warning, "skr_compute_execute failed to acquire command buffer");
+		skr_log(skr_log_warning, "skr_compute_dispatch_batch failed to acquire command buffer");
 		return;
 	}
 
-	// Upload parameter buffer to bump allocator if it exists
-	if (ref_compute->param_buffer && meta->global_buffer_id >= 0) {
-		// Write to command buffer's bump allocator
-		skr_bump_result_t result = _skr_bump_alloc_write(ctx.const_bump, ref_compute->param_buffer, ref_compute->param_buffer_size);
+	_skr_compute_refresh_pipeline(ref_compute);
+	vkCmdBindPipeline(cmd, VK_PIPELINE_BIND_POINT_COMPUTE, ref_compute->pipeline);
+	if (ref_compute->shader->bindless) _skr_bindless_bind(cmd, VK_PIPELINE_BIND_POINT_COMPUTE, ref_compute->layout);
+
+	bool has_params = ref_compute->param_buffer && meta->global_buffer_id >= 0;
+	for (uint32_t d = 0; d < count; d++) {
+		const skr_compute_dispatch_t* dispatch = &dispatches[d];
+
+		// Bit per bind that needs its descriptor re-written, binds past 64
+		// force a full write
+		uint64_t changed   = 0;
+		bool     write_all = d == 0 || !_skr_vk.has_push_descriptors;
+		for (uint32_t o = 0; o < dispatch->override_count; o++) {
+			const skr_compute_override_t* override = &dispatch->overrides[o];
+			int32_t idx = _skr_compute_find_bind(ref_compute, override->bind);
+			if (idx < 0) {
+				skr_log(skr_log_warning, "skr_compute_dispatch_batch: no binding at slot %u", override->bind.slot);
+				continue;
+			}
+			skr_material_bind_t* res = &ref_compute->binds[idx];
+			if (res->buffer == override->buffer && res->texture == override->tex) continue;
+			res->buffer  = override->buffer;
+			res->texture = override->tex;
+			if (idx < 64) changed  |= 1ull << idx;
+			else          write_all = true;
+		}
 
-		if (!result.buffer) {
-			skr_log(skr_log_warning, "skr_compute_execute: bump allocator failed");
+		// Upload parameter buffer to bump allocator, only when it changes
+		if (dispatch->params && has_params) {
+			memcpy(ref_compute->param_buffer, dispatch->params, ref_compute->param_buffer_size);
+			ref_compute->param_dirty = true;
+		}
+		if (has_params && ref_compute->shader->push_range.size > 0) {
+			// Push constants ride along in the command buffer, no bump or descriptor
+			if (d == 0 || ref_compute->param_dirty)
+				vkCmdPushConstants(cmd, ref_compute->layout, ref_compute->shader->push_range.stageFlags, 0, ref_compute->param_buffer_size, ref_compute->param_buffer);
+			ref_compute->param_dirty = false;
+		} else if (has_params && (d == 0 || ref_compute->param_dirty)) {
+			skr_bump_result_t result = _skr_bump_alloc_write(ctx.const_bump, ref_compute->param_buffer, ref_compute->param_buffer_size);
+			if (!result.buffer) {
+				skr_log(skr_log_warning, "skr_compute_dispatch_batch: bump allocator failed");
+				_skr_cmd_release(cmd);
+				return;
+			}
+
+			// Set up bind with offset
+			int32_t global_id = meta->global_buffer_id;
+			ref_compute->binds[global_id].buffer        = result.buffer;
+			ref_compute->binds[global_id].buffer_offset = result.offset;
+			ref_compute->binds[global_id].buffer_range  = ref_compute->param_buffer_size;
+			ref_compute->param_dirty = false;
+			if (global_id < 64) changed  |= 1ull << global_id;
+			else                write_all = true;
+		}
+
+		// Transition bound textures and resolve hazards against earlier dispatches
+		_skr_compute_sync_binds(cmd, ref_compute);
+
+		VkWriteDescriptorSet   writes      [32];
+		VkDescriptorBufferInfo buffer_infos[16];
+		VkDescriptorImageInfo  image_infos [16];
+		uint32_t write_ct  = 0;
+		uint32_t buffer_ct = 0;
+		uint32_t image_ct  = 0;
+		int32_t  fail_idx  = -1;
+		if (write_all) {
+			fail_idx = _skr_material_add_writes(ref_compute->binds, ref_compute->bind_count, NULL, 0,
+				writes,       sizeof(writes      )/sizeof(writes      [0]),
+				buffer_infos, sizeof(buffer_infos)/sizeof(buffer_infos[0]),
+				image_infos,  sizeof(image_infos )/sizeof(image_infos [0]),
+				&write_ct, &buffer_ct, &image_ct);
+		} else {
+			for (uint32_t i = 0; changed != 0 && i < ref_compute->bind_count; i++) {
+				if ((changed & (1ull << i)) == 0) continue;
+				changed &= ~(1ull << i);
+				if (_skr_material_add_writes(&ref_compute->binds[i], 1, NULL, 0,
+					writes,       sizeof(writes      )/sizeof(writes      [0]),
+					buffer_infos, sizeof(buffer_infos)/sizeof(buffer_infos[0]),
+					image_infos,  sizeof(image_infos )/sizeof(image_infos [0]),
+					&write_ct, &buffer_ct, &image_ct) >= 0) {
+					fail_idx = (int32_t)i;
+					break;
+				}
+			}
+		}
+		if (fail_idx >= 0) {
+			skr_log(skr_log_critical, "Compute dispatch missing binding '%s' in shader '%s'", _skr_material_bind_name(meta, fail_idx), meta->name);
 			_skr_cmd_release(cmd);
 			return;
 		}
 
-		// Set up bind with offset
-		ref_compute->binds[meta->global_buffer_id].buffer        = result.buffer;
-		ref_compute->binds[meta->global_buffer_id].buffer_offset = result.offset;
-		ref_compute->binds[meta->global_buffer_id].buffer_range  = ref_compute->param_buffer_size;
-		ref_compute->param_dirty = false;
-	}
+		//_skr_log_descriptor_writes(writes, write_ct, buffer_ct, image_ct);
 
-	vkCmdBindPipeline(cmd, VK_PIPELINE_BIND_POINT_COMPUTE, ref_compute->pipeline);
+		// Pushed descriptors persist between dispatches, so only changes go out
+		_skr_bind_descriptors(cmd, ctx.descriptor_pool, VK_PIPELINE_BIND_POINT_COMPUTE,
+		                      ref_compute->layout, ref_compute->descriptor_layout, writes, write_ct);
 
-	// Transition all bound textures to appropriate layouts before dispatch
-	for (uint32_t i = 0; i < ref_compute->bind_count; i++) {
-		skr_material_bind_t *res = &ref_compute->binds[i];
-		if      (res->bind.register_type == skr_register_readwrite_tex && res->texture) {_skr_tex_transition_for_storage    (cmd, res->texture); }
-		else if (res->bind.register_type == skr_register_texture       && res->texture) {_skr_tex_transition_for_shader_read(cmd, res->texture, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT); }
-	}
+		_skr_barrier_flush(cmd);
+		vkCmdDispatch(cmd, dispatch->x, dispatch->y, dispatch->z);
 
-	VkWriteDescriptorSet   writes      [32];
-	VkDescriptorBufferInfo buffer_infos[16];
-	VkDescriptorImageInfo  image_infos [16];
-	uint32_t write_ct  = 0;
-	uint32_t buffer_ct = 0;
-	uint32_t image_ct  = 0;
-	int32_t fail_idx = _skr_material_add_writes(ref_compute->binds, ref_compute->bind_count, NULL, 0,
-		writes,       sizeof(writes      )/sizeof(writes      [0]),
-		buffer_infos, sizeof(buffer_infos)/sizeof(buffer_infos[0]),
-		image_infos,  sizeof(image_infos )/sizeof(image_infos [0]),
-		&write_ct, &buffer_ct, &image_ct);
-	if (fail_idx >= 0) {
-		skr_log(skr_log_critical, "Compute dispatch missing binding '%s' in shader '%s'", _skr_material_bind_name(meta, fail_idx), meta->name);
-		_skr_cmd_release(cmd);
-		return;
+		// No barrier here: the next command that depends on these writes adds one
+		_skr_compute_record_binds(ref_compute);
 	}
 
-	//_skr_log_descriptor_writes(writes, write_ct, buffer_ct, image_ct);
-
-	_skr_bind_descriptors(cmd, ctx.descriptor_pool, VK_PIPELINE_BIND_POINT_COMPUTE,
-	                      ref_compute->layout, ref_compute->descriptor_layout, writes, write_ct);
-
-	vkCmdDispatch(cmd, x, y, z);
-
-	// Add memory barrier for storage resources to ensure writes are visible to next operation
-	// This includes compute→compute, compute→vertex, and compute→fragment transitions
-	vkCmdPipelineBarrier(cmd,
-		VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT,
-		VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT | VK_PIPELINE_STAGE_VERTEX_SHADER_BIT | VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT,
-		0, 1, &(VkMemoryBarrier){
-			.sType         = VK_STRUCTURE_TYPE_MEMORY_BARRIER,
-			.srcAccessMask = VK_ACCESS_SHADER_WRITE_BIT,
-			.dstAccessMask = VK_ACCESS_SHADER_READ_BIT | VK_ACCESS_SHADER_WRITE_BIT,
-		}, 0, NULL, 0, NULL);
-
 	_skr_cmd_release(cmd);
 }
 
@@ -409,7 +565,7 @@ void skr_compute_execute_indirect(skr_compute_t* ref_compute, skr_buffer_t* indi
 	}
 
 	// Upload parameter buffer to bump allocator if it exists
-	if (ref_compute->param_buffer && meta->global_buffer_id >= 0) {
+	if (ref_compute->param_buffer && meta->global_buffer_id >= 0 && ref_compute->shader->push_range.size == 0) {
 		// Write to command buffer's bump allocator
 		skr_bump_result_t result = _skr_bump_alloc_write(ctx.const_bump, ref_compute->param_buffer, ref_compute->param_buffer_size);
 
@@ -426,7 +582,17 @@ void skr_compute_execute_indirect(skr_compute_t* ref_compute, skr_buffer_t* indi
 		ref_compute->param_dirty = false;
 	}
 
+	_skr_compute_refresh_pipeline(ref_compute);
 	vkCmdBindPipeline(cmd, VK_PIPELINE_BIND_POINT_COMPUTE, ref_compute->pipeline);
+	if (ref_compute->shader->bindless) _skr_bindless_bind(cmd, VK_PIPELINE_BIND_POINT_COMPUTE, ref_compute->layout);
+	if (ref_compute->param_buffer && ref_compute->shader->push_range.size > 0) {
+		vkCmdPushConstants(cmd, ref_compute->layout, ref_compute->shader->push_range.stageFlags, 0, ref_compute->param_buffer_size, ref_compute->param_buffer);
+		ref_compute->param_dirty = false;
+	}
+
+	// The args buffer may have just been written by another dispatch
+	_skr_compute_sync_binds(cmd, ref_compute);
+	_skr_hazard_access(cmd, &indirect_args->_hazard, VK_PIPELINE_STAGE_DRAW_INDIRECT_BIT, VK_ACCESS_INDIRECT_COMMAND_READ_BIT, false);
 
 	VkWriteDescriptorSet   writes      [32];
 	VkDescriptorBufferInfo buffer_infos[16];
@@ -448,6 +614,11 @@ void skr_compute_execute_indirect(skr_compute_t* ref_compute, skr_buffer_t* indi
 	_skr_bind_descriptors(cmd, ctx.descriptor_pool, VK_PIPELINE_BIND_POINT_COMPUTE,
 	                      ref_compute->layout, ref_compute->descriptor_layout, writes, write_ct);
 
+	_skr_barrier_flush(cmd);
 	vkCmdDispatchIndirect(cmd, indirect_args->buffer, 0);
+
+	_skr_hazard_record(&indirect_args->_hazard, VK_PIPELINE_STAGE_DRAW_INDIRECT_BIT, VK_ACCESS_INDIRECT_COMMAND_READ_BIT, false);
+	_skr_compute_record_binds(ref_compute);
+
 	_skr_cmd_release(cmd);
 }
@@ -116,8 +116,17 @@ void _skr_append_renderpass_config(char* ref_str, size_t str_size, const skr_pip
 		rp_key->depth_format == VK_FORMAT_D32_SFLOAT_S8_UINT ? "d32s8" :
 		rp_key->depth_format == VK_FORMAT_D32_SFLOAT         ? "d32" : "?";
 
+	// Load/store ops as l(oad) c(lear) d(ont care) s(tore): color load, depth load, depth store
+	const char load_ch[]  = { 'l', 'c', 'd' };
+	const char store_ch[] = { 's', 'd' };
+	char ops[4] = {
+		rp_key->color_load_op  <= VK_ATTACHMENT_LOAD_OP_DONT_CARE  ? load_ch [rp_key->color_load_op ] : '?',
+		rp_key->depth_load_op  <= VK_ATTACHMENT_LOAD_OP_DONT_CARE  ? load_ch [rp_key->depth_load_op ] : '?',
+		rp_key->depth_store_op <= VK_ATTACHMENT_STORE_OP_DONT_CARE ? store_ch[rp_key->depth_store_op] : '?',
+		'\0' };
+
 	size_t pos = strlen(ref_str);
-	snprintf(ref_str + pos, str_size - pos, "%s_%s_x%d", color_str, depth_str, rp_key->samples);
+	snprintf(ref_str + pos, str_size - pos, "%s_%s_x%d_%s", color_str, depth_str, rp_key->samples, ops);
 }
 
 static const char* _skr_descriptor_type_name(VkDescriptorType type) {
@@ -46,6 +46,9 @@ typedef enum {
 	#undef MAKE_ENUM
 	// Non-Vulkan types (custom handling)
 	skr_destroy_type_bind_pool_slots,  // handle = (start << 32) | count
+	skr_destroy_type_bindless_slot,    // handle = (is_buffer << 32) | index
+	skr_destroy_type_material_set,     // handle = VkDescriptorSet from the bind pool's set pool
+	skr_destroy_type_shader_meta,      // handle = sksc_shader_meta_t*, one reference is released
 } skr_destroy_type_;
 
 typedef struct {
@@ -114,6 +117,15 @@ static void _skr_destroy_list_destroy(uint64_t handle, skr_destroy_type_ type) {
 			uint32_t count = (uint32_t)(handle & 0xFFFFFFFF);
 			_skr_bind_pool_free(start, count);
 		} break;
+		case skr_destroy_type_bindless_slot: {
+			_skr_bindless_free((handle >> 32) != 0, (uint32_t)(handle & 0xFFFFFFFF));
+		} break;
+		case skr_destroy_type_material_set: {
+			_skr_material_sets_release((VkDescriptorSet)handle);
+		} break;
+		case skr_destroy_type_shader_meta: {
+			sksc_shader_meta_release((sksc_shader_meta_t*)(uintptr_t)handle);
+		} break;
 	}
 }
 
@@ -122,7 +134,7 @@ void _skr_cmd_destroy_##name(skr_destroy_list_t* opt_ref_list, vk_type handle) {
 	if (handle == VK_NULL_HANDLE) return; \
 	if (opt_ref_list == NULL) { _skr_vk_thread_t* thr = _skr_cmd_get_thread(); if (thr) { _skr_cmd_ring_slot_t* active = thr->active_cmd; opt_ref_list = active ? &active->destroy_list : NULL; } } \
 	if (opt_ref_list == NULL) { _skr_cmd_ring_slot_t* active = _skr_vk.thread_pools[0].active_cmd; opt_ref_list = active ? &active->destroy_list : NULL; } \
-	if (opt_ref_list == NULL) { _skr_cmd_ring_slot_t* active = _skr_vk.thread_pools[0].last_submitted; opt_ref_list = active ? &active->destroy_list : NULL; } \
+	if (opt_ref_list == NULL) { _skr_cmd_ring_slot_t* active = _skr_vk.thread_pools[0].graphics.last_submitted; opt_ref_list = active ? &active->destroy_list : NULL; } \
 	if (opt_ref_list == NULL) { _skr_destroy_list_destroy(              (uint64_t)handle, skr_destroy_type_##name); } \
 	else                      { _skr_destroy_list_add    (opt_ref_list, (uint64_t)handle, skr_destroy_type_##name); } \
 }
@@ -133,13 +145,40 @@ FOREACH_DESTROY_TYPE(MAKE_ADD_FUNCTION)
 void _skr_cmd_destroy_bind_pool_slots(skr_destroy_list_t* opt_ref_list, int32_t start, uint32_t count) {
 	if (start < 0 || count == 0) return;
 	if (opt_ref_list == NULL) { _skr_vk_thread_t* thr = _skr_cmd_get_thread(); if (thr) { _skr_cmd_ring_slot_t* active = thr->active_cmd; opt_ref_list = active ? &active->destroy_list : NULL; } }
-	if (opt_ref_list == NULL) { _skr_cmd_ring_slot_t* active = _skr_vk.thread_pools[0].active_cmd;         opt_ref_list = active ? &active->destroy_list : NULL; }
-	if (opt_ref_list == NULL) { _skr_cmd_ring_slot_t* active = _skr_vk.thread_pools[0].last_submitted;     opt_ref_list = active ? &active->destroy_list : NULL; }
+	if (opt_ref_list == NULL) { _skr_cmd_ring_slot_t* active = _skr_vk.thread_pools[0].active_cmd;              opt_ref_list = active ? &active->destroy_list : NULL; }
+	if (opt_ref_list == NULL) { _skr_cmd_ring_slot_t* active = _skr_vk.thread_pools[0].graphics.last_submitted; opt_ref_list = active ? &active->destroy_list : NULL; }
 	uint64_t packed = ((uint64_t)(uint32_t)start << 32) | (uint64_t)count;
 	if (opt_ref_list == NULL) { _skr_destroy_list_destroy(              packed, skr_destroy_type_bind_pool_slots); }
 	else                      { _skr_destroy_list_add    (opt_ref_list, packed, skr_destroy_type_bind_pool_slots); }
 }
 
+void _skr_cmd_destroy_bindless_slot(skr_destroy_list_t* opt_ref_list, bool is_buffer, uint32_t index) {
+	if (opt_ref_list == NULL) { _skr_vk_thread_t* thr = _skr_cmd_get_thread(); if (thr) { _skr_cmd_ring_slot_t* active = thr->active_cmd; opt_ref_list = active ? &active->destroy_list : NULL; } }
+	if (opt_ref_list == NULL) { _skr_cmd_ring_slot_t* active = _skr_vk.thread_pools[0].active_cmd;              opt_ref_list = active ? &active->destroy_list : NULL; }
+	if (opt_ref_list == NULL) { _skr_cmd_ring_slot_t* active = _skr_vk.thread_pools[0].graphics.last_submitted; opt_ref_list = active ? &active->destroy_list : NULL; }
+	uint64_t packed = ((uint64_t)(is_buffer ? 1 : 0) << 32) | (uint64_t)index;
+	if (opt_ref_list == NULL) { _skr_destroy_list_destroy(              packed, skr_destroy_type_bindless_slot); }
+	else                      { _skr_destroy_list_add    (opt_ref_list, packed, skr_destroy_type_bindless_slot); }
+}
+
+void _skr_cmd_destroy_material_set(skr_destroy_list_t* opt_ref_list, VkDescriptorSet set) {
+	if (set == VK_NULL_HANDLE) return;
+	if (opt_ref_list == NULL) { _skr_vk_thread_t* thr = _skr_cmd_get_thread(); if (thr) { _skr_cmd_ring_slot_t* active = thr->active_cmd; opt_ref_list = active ? &active->destroy_list : NULL; } }
+	if (opt_ref_list == NULL) { _skr_cmd_ring_slot_t* active = _skr_vk.thread_pools[0].active_cmd;              opt_ref_list = active ? &active->destroy_list : NULL; }
+	if (opt_ref_list == NULL) { _skr_cmd_ring_slot_t* active = _skr_vk.thread_pools[0].graphics.last_submitted; opt_ref_list = active ? &active->destroy_list : NULL; }
+	if (opt_ref_list == NULL) { _skr_destroy_list_destroy(              (uint64_t)set, skr_destroy_type_material_set); }
+	else                      { _skr_destroy_list_add    (opt_ref_list, (uint64_t)set, skr_destroy_type_material_set); }
+}
+
+void _skr_cmd_destroy_shader_meta(skr_destroy_list_t* opt_ref_list, sksc_shader_meta_t* meta) {
+	if (meta == NULL) return;
+	if (opt_ref_list == NULL) { _skr_vk_thread_t* thr = _skr_cmd_get_thread(); if (thr) { _skr_cmd_ring_slot_t* active = thr->active_cmd; opt_ref_list = active ? &active->destroy_list : NULL; } }
+	if (opt_ref_list == NULL) { _skr_cmd_ring_slot_t* active = _skr_vk.thread_pools[0].active_cmd;              opt_ref_list = active ? &active->destroy_list : NULL; }
+	if (opt_ref_list == NULL) { _skr_cmd_ring_slot_t* active = _skr_vk.thread_pools[0].graphics.last_submitted; opt_ref_list = active ? &active->destroy_list : NULL; }
+	if (opt_ref_list == NULL) { _skr_destroy_list_destroy(              (uint64_t)(uintptr_t)meta, skr_destroy_type_shader_meta); }
+	else                      { _skr_destroy_list_add    (opt_ref_list, (uint64_t)(uintptr_t)meta, skr_destroy_type_shader_meta); }
+}
+
 void _skr_destroy_list_execute(skr_destroy_list_t* ref_list) {
 	mtx_lock(&ref_list->mutex);
 
@@ -0,0 +1,666 @@
+// SPDX-License-Identifier: MIT
+// The authors below grant copyright rights under the MIT license:
+// Copyright (c) 2025 Nick Klingensmith
+// Copyright (c) 2025 Qualcomm Technologies, Inc.
+
+#include "sk_renderer.h"
+#include "_sk_renderer.h"
+
+#include "skr_vulkan.h"
+
+#include <assert.h>
+#include <stdlib.h>
+#include <string.h>
+
+///////////////////////////////////////////////////////////////////////////////
+// Render graph
+//
+// Layered over the immediate API: the graph is described every frame, then
+// skr_graph_execute compiles it and records each pass with the regular
+// skr_renderer_begin_pass/end_pass and compute calls.
+//
+// Compiling is cheap and happens on every execute:
+// - Culling walks passes backwards from imported resources (the only ones
+//   visible outside the graph) and keeps passes whose writes are needed.
+// - Ordering is a topological sort over the declared read/write conflicts,
+//   preferring consumers right after their producers so transient lifetimes
+//   stay short.
+// - Transient textures are placed in shared memory wherever their lifetimes
+//   don't overlap. This is the only expensive part, so it's redone only when
+//   the transient descriptions or lifetimes change.
+//
+// Barriers come from declared uses: every texture a pass reads is
+// transitioned before the pass begins, batched into the single barrier that
+// goes out with it, and transient attachments skip the eager shader-read
+// transition at end_pass since the graph knows who reads them next.
+///////////////////////////////////////////////////////////////////////////////
+
+// Attachments are stored as uses too, following the public skr_graph_use_
+typedef enum {
+	_skr_graph_access_read     = skr_graph_use_read,
+	_skr_graph_access_storage  = skr_graph_use_storage,
+	_skr_graph_access_indirect = skr_graph_use_indirect,
+	_skr_graph_access_color,
+	_skr_graph_access_depth,
+	_skr_graph_access_resolve,
+} _skr_graph_access_;
+
+struct _skr_graph_res_t {
+	skr_tex_t*        tex;         // Imported, or the physical texture once compiled
+	skr_buffer_t*     buffer;
+	bool              imported;
+
+	// Transient texture description
+	const char*       name;
+	skr_tex_fmt_      format;
+	skr_tex_flags_    flags;
+	skr_tex_sampler_t sampler;
+	skr_vec3i_t       size;
+	int32_t           multisample;
+	int32_t           mip_count;
+
+	// Compile and execute state
+	bool              needed;      // Culling: a later live pass depends on the contents
+	bool              written;     // Execute: contents were produced earlier this frame
+	int32_t           first;       // Lifetime as positions in the compiled order, -1 = unused
+	int32_t           last;
+	int32_t           physical;    // Index into graph->physical for live transients, -1 otherwise
+};
+
+struct _skr_graph_pass_t {
+	skr_graph_pass_info_t info;
+	int32_t               first_use;   // Head of this pass's use list, -1 = none
+	bool                  alive;
+	uint32_t              waiting;     // Ordering: unscheduled passes this one depends on
+	int32_t               position;    // Ordering: index in graph->order, -1 = not scheduled
+};
+
+struct _skr_graph_use_t {
+	uint32_t res;                      // Index into graph->resources
+	uint8_t  access;                   // _skr_graph_access_
+	int32_t  next;                     // Next use of the same pass, -1 = end
+};
+
+struct _skr_graph_phys_t {
+	skr_tex_t    tex;
+	VkDeviceSize offset;
+	VkDeviceSize size;
+	VkDeviceSize alignment;
+	uint32_t     heap;
+	uint32_t     memory_type;
+	int32_t      first, last;          // Lifetime this was placed for
+	bool         aliased;              // Shares memory with another transient
+};
+
+struct _skr_graph_heap_t {
+	VkDeviceMemory memory;
+	VkDeviceSize   size;
+	uint32_t       memory_type;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+
+static bool _skr_graph_grow(void** ref_data, uint32_t* ref_capacity, uint32_t count, size_t item_size) {
+	if (count < *ref_capacity) return true;
+
+	uint32_t new_capacity = *ref_capacity == 0 ? 16 : *ref_capacity * 2;
+	void*    new_data     = _skr_realloc(*ref_data, item_size * new_capacity);
+	if (!new_data) {
+		skr_log(skr_log_critical, "Failed to grow render graph");
+		return false;
+	}
+	*ref_data     = new_data;
+	*ref_capacity = new_capacity;
+	return true;
+}
+
+static bool _skr_graph_access_writes(uint8_t access) {
+	return access != _skr_graph_access_read && access != _skr_graph_access_indirect;
+}
+
+// Whether the use depends on contents from before the pass. Attachments that
+// aren't cleared are loaded, storage is read-modify-write.
+static bool _skr_graph_access_reads(const _skr_graph_pass_t* pass, uint8_t access) {
+	switch (access) {
+	case _skr_graph_access_color:   return !(pass->info.clear & skr_clear_color);
+	case _skr_graph_access_depth:   return !(pass->info.clear & skr_clear_depth);
+	case _skr_graph_access_resolve: return false;
+	default:                        return true;
+	}
+}
+
+static void _skr_graph_add_use(skr_graph_t* ref_graph, uint32_t pass, skr_graph_res_t res, uint8_t access) {
+	if (res == 0 || res > ref_graph->resource_count) {
+		skr_log(skr_log_warning, "skr_graph: invalid resource %u on pass '%s'", res, ref_graph->passes[pass].info.name ? ref_graph->passes[pass].info.name : "");
+		return;
+	}
+	if (!_skr_graph_grow((void**)&ref_graph->uses, &ref_graph->use_capacity, ref_graph->use_count, sizeof(_skr_graph_use_t))) return;
+
+	_skr_graph_pass_t* p = &ref_graph->passes[pass];
+	ref_graph->uses[ref_graph->use_count] = (_skr_graph_use_t){
+		.res    = res - 1,
+		.access = access,
+		.next   = p->first_use,
+	};
+	p->first_use = (int32_t)ref_graph->use_count;
+	ref_graph->use_count++;
+}
+
+static void _skr_graph_release_memory(skr_graph_t* ref_graph) {
+	// Textures that never got memory have no view or sampler to release yet
+	for (uint32_t i = 0; i < ref_graph->physical_count; i++) {
+		skr_tex_t* tex = &ref_graph->physical[i].tex;
+		if (tex->view) skr_tex_destroy(tex);
+		else           _skr_cmd_destroy_image(NULL, tex->image);
+	}
+	for (uint32_t i = 0; i < ref_graph->heap_count; i++)
+		_skr_cmd_destroy_memory(NULL, ref_graph->heaps[i].memory);
+
+	_skr_free(ref_graph->physical);
+	_skr_free(ref_graph->heaps);
+	ref_graph->physical       = NULL;
+	ref_graph->physical_count = 0;
+	ref_graph->heaps          = NULL;
+	ref_graph->heap_count     = 0;
+	ref_graph->layout_hash    = 0;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+skr_err_ skr_graph_create(skr_graph_t* out_graph) {
+	if (!out_graph) return skr_err_invalid_parameter;
+
+	*out_graph = (skr_graph_t){0};
+	return skr_err_success;
+}
+
+void skr_graph_destroy(skr_graph_t* ref_graph) {
+	if (!ref_graph) return;
+
+	_skr_graph_release_memory(ref_graph);
+	_skr_free(ref_graph->resources);
+	_skr_free(ref_graph->passes);
+	_skr_free(ref_graph->uses);
+	_skr_free(ref_graph->order);
+	*ref_graph = (skr_graph_t){0};
+}
+
+void skr_graph_clear(skr_graph_t* ref_graph) {
+	if (!ref_graph) return;
+
+	ref_graph->resource_count = 0;
+	ref_graph->pass_count     = 0;
+	ref_graph->use_count      = 0;
+	ref_graph->order_count    = 0;
+}
+
+skr_graph_res_t skr_graph_import_tex(skr_graph_t* ref_graph, skr_tex_t* tex) {
+	if (!ref_graph || !skr_tex_is_valid(tex)) return 0;
+	if (!_skr_graph_grow((void**)&ref_graph->resources, &ref_graph->resource_capacity, ref_graph->resource_count, sizeof(_skr_graph_res_t))) return 0;
+
+	ref_graph->resources[ref_graph->resource_count] = (_skr_graph_res_t){ .tex = tex, .imported = true, .physical = -1 };
+	return ++ref_graph->resource_count;
+}
+
+skr_graph_res_t skr_graph_import_buffer(skr_graph_t* ref_graph, skr_buffer_t* buffer) {
+	if (!ref_graph || !skr_buffer_is_valid(buffer)) return 0;
+	if (!_skr_graph_grow((void**)&ref_graph->resources, &ref_graph->resource_capacity, ref_graph->resource_count, sizeof(_skr_graph_res_t))) return 0;
+
+	ref_graph->resources[ref_graph->resource_count] = (_skr_graph_res_t){ .buffer = buffer, .imported = true, .physical = -1 };
+	return ++ref_graph->resource_count;
+}
+
+skr_graph_res_t skr_graph_create_tex(skr_graph_t* ref_graph, const char* name, skr_tex_fmt_ format, skr_tex_flags_ flags, skr_tex_sampler_t sampler, skr_vec3i_t size, int32_t multisample, int32_t mip_count) {
+	if (!ref_graph) return 0;
+	if (size.x <= 0 || size.y <= 0 || size.z <= 0) {
+		skr_log(skr_log_warning, "skr_graph_create_tex: invalid size for '%s'", name ? name : "");
+		return 0;
+	}
+	if (!_skr_graph_grow((void**)&ref_graph->resources, &ref_graph->resource_capacity, ref_graph->resource_count, sizeof(_skr_graph_res_t))) return 0;
+
+	ref_graph->resources[ref_graph->resource_count] = (_skr_graph_res_t){
+		.name        = name,
+		.format      = format,
+		.flags       = flags,
+		.sampler     = sampler,
+		.size        = size,
+		.multisample = multisample < 1 ? 1 : multisample,
+		.mip_count   = mip_count   < 1 ? 1 : mip_count,
+		.physical    = -1,
+	};
+	return ++ref_graph->resource_count;
+}
+
+uint32_t skr_graph_add_pass(skr_graph_t* ref_graph, skr_graph_pass_info_t info) {
+	if (!ref_graph) return 0;
+	if (!_skr_graph_grow((void**)&ref_graph->passes, &ref_graph->pass_capacity, ref_graph->pass_count, sizeof(_skr_graph_pass_t))) return 0;
+
+	uint32_t pass = ref_graph->pass_count++;
+	ref_graph->passes[pass] = (_skr_graph_pass_t){ .info = info, .first_use = -1, .position = -1 };
+
+	if (info.color  ) _skr_graph_add_use(ref_graph, pass, info.color,   _skr_graph_access_color);
+	if (info.depth  ) _skr_graph_add_use(ref_graph, pass, info.depth,   _skr_graph_access_depth);
+	if (info.resolve) _skr_graph_add_use(ref_graph, pass, info.resolve, _skr_graph_access_resolve);
+	return pass;
+}
+
+void skr_graph_pass_use(skr_graph_t* ref_graph, uint32_t pass, skr_graph_res_t res, skr_graph_use_ use) {
+	if (!ref_graph || pass >= ref_graph->pass_count) return;
+	_skr_graph_add_use(ref_graph, pass, res, (uint8_t)use);
+}
+
+skr_tex_t* skr_graph_get_tex(const skr_graph_t* graph, skr_graph_res_t res) {
+	if (!graph || res == 0 || res > graph->resource_count) return NULL;
+	return graph->resources[res - 1].tex;
+}
+
+skr_buffer_t* skr_graph_get_buffer(const skr_graph_t* graph, skr_graph_res_t res) {
+	if (!graph || res == 0 || res > graph->resource_count) return NULL;
+	return graph->resources[res - 1].buffer;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Compile
+///////////////////////////////////////////////////////////////////////////////
+
+static void _skr_graph_cull(skr_graph_t* ref_graph) {
+	for (uint32_t r = 0; r < ref_graph->resource_count; r++)
+		ref_graph->resources[r].needed = ref_graph->resources[r].imported;
+
+	for (int32_t p = (int32_t)ref_graph->pass_count - 1; p >= 0; p--) {
+		_skr_graph_pass_t* pass = &ref_graph->passes[p];
+
+		pass->alive = pass->info.keep;
+		for (int32_t u = pass->first_use; u >= 0 && !pass->alive; u = ref_graph->uses[u].next) {
+			const _skr_graph_use_t* use = &ref_graph->uses[u];
+			if (_skr_graph_access_writes(use->access) && ref_graph->resources[use->res].needed)
+				pass->alive = true;
+		}
+		if (!pass->alive) continue;
+
+		// Anything this pass fully overwrites isn't needed from earlier passes,
+		// unless it also reads it
+		for (int32_t u = pass->first_use; u >= 0; u = ref_graph->uses[u].next) {
+			const _skr_graph_use_t* use = &ref_graph->uses[u];
+			if (_skr_graph_access_writes(use->access) && !_skr_graph_access_reads(pass, use->access))
+				ref_graph->resources[use->res].needed = false;
+		}
+		for (int32_t u = pass->first_use; u >= 0; u = ref_graph->uses[u].next) {
+			const _skr_graph_use_t* use = &ref_graph->uses[u];
+			if (_skr_graph_access_reads(pass, use->access))
+				ref_graph->resources[use->res].needed = true;
+		}
+	}
+}
+
+// True if 'later' has to run after 'earlier' (both alive, earlier declared
+// first): they share a resource and at least one of them writes it.
+static bool _skr_graph_depends(const skr_graph_t* graph, uint32_t earlier, uint32_t later) {
+	const _skr_graph_pass_t* a = &graph->passes[earlier];
+	const _skr_graph_pass_t* b = &graph->passes[later];
+	for (int32_t ua = a->first_use; ua >= 0; ua = graph->uses[ua].next) {
+		for (int32_t ub = b->first_use; ub >= 0; ub = graph->uses[ub].next) {
+			if (graph->uses[ua].res != graph->uses[ub].res) continue;
+			if (_skr_graph_access_writes(graph->uses[ua].access) || _skr_graph_access_writes(graph->uses[ub].access))
+				return true;
+		}
+	}
+	return false;
+}
+
+static bool _skr_graph_sort(skr_graph_t* ref_graph) {
+	if (ref_graph->pass_count > 0) {
+		uint32_t* order = _skr_realloc(ref_graph->order, sizeof(uint32_t) * ref_graph->pass_capacity);
+		if (!order) {
+			skr_log(skr_log_critical, "Failed to grow render graph");
+			return false;
+		}
+		ref_graph->order = order;
+	}
+	ref_graph->order_count = 0;
+
+	uint32_t alive_count = 0;
+	for (uint32_t p = 0; p < ref_graph->pass_count; p++) {
+		_skr_graph_pass_t* pass = &ref_graph->passes[p];
+		pass->position = -1;
+		pass->waiting  = 0;
+		if (!pass->alive) continue;
+		alive_count++;
+		for (uint32_t q = 0; q < p; q++) {
+			if (ref_graph->passes[q].alive && _skr_graph_depends(ref_graph, q, p)) pass->waiting++;
+		}
+	}
+
+	// Kahn's algorithm. Among ready passes, take the one whose latest
+	// dependency ran most recently, so consumers follow their producers and
+	// transient textures can be retired (and their memory reused) sooner.
+	while (ref_graph->order_count < alive_count) {
+		int32_t best       = -1;
+		int32_t best_score = -2;
+		for (uint32_t p = 0; p < ref_graph->pass_count; p++) {
+			const _skr_graph_pass_t* pass = &ref_graph->passes[p];
+			if (!pass->alive || pass->position >= 0 || pass->waiting > 0) continue;
+
+			int32_t score = -1;
+			for (uint32_t q = 0; q < p; q++) {
+				const _skr_graph_pass_t* dep = &ref_graph->passes[q];
+				if (dep->position > score && _skr_graph_depends(ref_graph, q, p)) score = dep->position;
+			}
+			if (score > best_score) {
+				best       = (int32_t)p;
+				best_score = score;
+			}
+		}
+		// Dependencies only point from earlier to later declarations, so there
+		// is always a ready pass
+		assert(best >= 0);
+
+		ref_graph->passes[best].position           = (int32_t)ref_graph->order_count;
+		ref_graph->order[ref_graph->order_count++] = (uint32_t)best;
+		for (uint32_t p = (uint32_t)best + 1; p < ref_graph->pass_count; p++) {
+			_skr_graph_pass_t* pass = &ref_graph->passes[p];
+			if (pass->alive && _skr_graph_depends(ref_graph, (uint32_t)best, p)) pass->waiting--;
+		}
+	}
+	return true;
+}
+
+static void _skr_graph_lifetimes(skr_graph_t* ref_graph) {
+	for (uint32_t r = 0; r < ref_graph->resource_count; r++) {
+		ref_graph->resources[r].first   = -1;
+		ref_graph->resources[r].last    = -1;
+		ref_graph->resources[r].written = false;
+	}
+	for (uint32_t i = 0; i < ref_graph->order_count; i++) {
+		const _skr_graph_pass_t* pass = &ref_graph->passes[ref_graph->order[i]];
+		for (int32_t u = pass->first_use; u >= 0; u = ref_graph->uses[u].next) {
+			_skr_graph_res_t* res = &ref_graph->resources[ref_graph->uses[u].res];
+			if (res->first < 0) res->first = (int32_t)i;
+			res->last = (int32_t)i;
+		}
+	}
+}
+
+static uint64_t _skr_graph_hash(uint64_t hash, const void* data, size_t size) {
+	const uint8_t* bytes = (const uint8_t*)data;
+	for (size_t i = 0; i < size; i++) {
+		hash ^= bytes[i];
+		hash *= 1099511628211ULL;
+	}
+	return hash;
+}
+
+static uint64_t _skr_graph_layout_hash(const skr_graph_t* graph) {
+	uint64_t hash = 14695981039346656037ULL;
+	for (uint32_t r = 0; r < graph->resource_count; r++) {
+		const _skr_graph_res_t* res = &graph->resources[r];
+		if (res->imported || res->first < 0) continue;
+		hash = _skr_graph_hash(hash, &res->format,      sizeof(res->format));
+		hash = _skr_graph_hash(hash, &res->flags,       sizeof(res->flags));
+		hash = _skr_graph_hash(hash, &res->sampler,     sizeof(res->sampler));
+		hash = _skr_graph_hash(hash, &res->size,        sizeof(res->size));
+		hash = _skr_graph_hash(hash, &res->multisample, sizeof(res->multisample));
+		hash = _skr_graph_hash(hash, &res->mip_count,   sizeof(res->mip_count));
+		hash = _skr_graph_hash(hash, &res->first,       sizeof(res->first));
+		hash = _skr_graph_hash(hash, &res->last,        sizeof(res->last));
+	}
+	return hash;
+}
+
+static bool _skr_graph_overlaps(int32_t a_first, int32_t a_last, int32_t b_first, int32_t b_last) {
+	return a_first <= b_last && b_first <= a_last;
+}
+
+// Creates a texture for every live transient and packs them into one heap per
+// memory type, first-fit by descending size. Textures whose lifetimes don't
+// overlap may share the same range of memory.
+static skr_err_ _skr_graph_build_memory(skr_graph_t* ref_graph) {
+	_skr_graph_release_memory(ref_graph);
+
+	uint32_t count = 0;
+	for (uint32_t r = 0; r < ref_graph->resource_count; r++) {
+		if (!ref_graph->resources[r].imported && ref_graph->resources[r].first >= 0) count++;
+	}
+	if (count == 0) return skr_err_success;
+
+	ref_graph->physical = _skr_calloc(count, sizeof(_skr_graph_phys_t));
+	ref_graph->heaps    = _skr_calloc(count, sizeof(_skr_graph_heap_t));
+	uint32_t* by_size   = _skr_malloc(count * sizeof(uint32_t));
+	if (!ref_graph->physical || !ref_graph->heaps || !by_size) {
+		_skr_free(by_size);
+		_skr_graph_release_memory(ref_graph);
+		return skr_err_out_of_memory;
+	}
+
+	// Create the images, memory comes later
+	skr_err_ err = skr_err_success;
+	for (uint32_t r = 0; r < ref_graph->resource_count && err == skr_err_success; r++) {
+		_skr_graph_res_t* res = &ref_graph->resources[r];
+		if (res->imported || res->first < 0) continue;
+
+		_skr_graph_phys_t* phys = &ref_graph->physical[ref_graph->physical_count];
+		bool lazy, host_upload;
+		err = _skr_tex_create_unbound(res->format, res->flags, res->sampler, res->size, res->multisample, res->mip_count, false, &phys->tex, &lazy, &host_upload);
+		if (err != skr_err_success) break;
+		ref_graph->physical_count++;
+
+		VkMemoryRequirements requirements;
+		vkGetImageMemoryRequirements(_skr_vk.device, phys->tex.image, &requirements);
+		phys->size        = requirements.size;
+		phys->alignment   = requirements.alignment;
+		phys->memory_type = _skr_tex_find_memory_type(requirements, lazy);
+		phys->first       = res->first;
+		phys->last        = res->last;
+		if (phys->memory_type == UINT32_MAX) err = skr_err_unsupported;
+	}
+
+	// Place, largest first
+	for (uint32_t i = 0; i < ref_graph->physical_count; i++) by_size[i] = i;
+	for (uint32_t i = 1; i < ref_graph->physical_count; i++) {
+		uint32_t idx = by_size[i];
+		int32_t  j   = (int32_t)i - 1;
+		while (j >= 0 && ref_graph->physical[by_size[j]].size < ref_graph->physical[idx].size) {
+			by_size[j + 1] = by_size[j];
+			j--;
+		}
+		by_size[j + 1] = idx;
+	}
+	for (uint32_t i = 0; i < ref_graph->physical_count && err == skr_err_success; i++) {
+		_skr_graph_phys_t* phys = &ref_graph->physical[by_size[i]];
+
+		uint32_t heap = 0;
+		while (heap < ref_graph->heap_count && ref_graph->heaps[heap].memory_type != phys->memory_type) heap++;
+		if (heap == ref_graph->heap_count) ref_graph->heaps[ref_graph->heap_count++].memory_type = phys->memory_type;
+		phys->heap = heap;
+
+		// Slide past anything placed that's alive at the same time
+		VkDeviceSize offset = 0;
+		for (bool moved = true; moved; ) {
+			moved = false;
+			for (uint32_t k = 0; k < i; k++) {
+				const _skr_graph_phys_t* other = &ref_graph->physical[by_size[k]];
+				if (other->heap != heap || !_skr_graph_overlaps(phys->first, phys->last, other->first, other->last)) continue;
+				if (offset < other->offset + other->size && other->offset < offset + phys->size) {
+					offset = (other->offset + other->size + phys->alignment - 1) / phys->alignment * phys->alignment;
+					moved  = true;
+				}
+			}
+		}
+		phys->offset = offset;
+		if (ref_graph->heaps[heap].size < offset + phys->size) ref_graph->heaps[heap].size = offset + phys->size;
+
+		for (uint32_t k = 0; k < i; k++) {
+			_skr_graph_phys_t* other = &ref_graph->physical[by_size[k]];
+			if (other->heap == heap && offset < other->offset + other->size && other->offset < offset + phys->size) {
+				phys ->aliased = true;
+				other->aliased = true;
+			}
+		}
+	}
+	_skr_free(by_size);
+
+	for (uint32_t h = 0; h < ref_graph->heap_count && err == skr_err_success; h++) {
+		VkResult vr = vkAllocateMemory(_skr_vk.device, &(VkMemoryAllocateInfo){
+			.sType           = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO,
+			.allocationSize  = ref_graph->heaps[h].size,
+			.memoryTypeIndex = ref_graph->heaps[h].memory_type,
+		}, NULL, &ref_graph->heaps[h].memory);
+		if (vr != VK_SUCCESS) {
+			skr_log(skr_log_critical, "skr_graph: failed to allocate %llu bytes of transient memory", (unsigned long long)ref_graph->heaps[h].size);
+			err = skr_err_out_of_memory;
+		}
+	}
+
+	uint32_t phys_idx = 0;
+	for (uint32_t r = 0; r < ref_graph->resource_count && err == skr_err_success; r++) {
+		_skr_graph_res_t* res = &ref_graph->resources[r];
+		if (res->imported || res->first < 0) continue;
+
+		_skr_graph_phys_t* phys = &ref_graph->physical[phys_idx++];
+		err = _skr_tex_bind_memory(&phys->tex, ref_graph->heaps[phys->heap].memory, phys->offset);
+		if (err == skr_err_success && res->name) skr_tex_set_name(&phys->tex, res->name);
+	}
+
+	if (err != skr_err_success) {
+		_skr_graph_release_memory(ref_graph);
+		return err;
+	}
+	return skr_err_success;
+}
+
+static skr_err_ _skr_graph_compile(skr_graph_t* ref_graph) {
+	_skr_graph_cull(ref_graph);
+	if (!_skr_graph_sort(ref_graph)) return skr_err_out_of_memory;
+	_skr_graph_lifetimes(ref_graph);
+
+	uint64_t hash = _skr_graph_layout_hash(ref_graph);
+	if (hash != ref_graph->layout_hash || ref_graph->physical == NULL) {
+		skr_err_ err = _skr_graph_build_memory(ref_graph);
+		if (err != skr_err_success) return err;
+		ref_graph->layout_hash = hash;
+	}
+
+	// Hand the physical textures to their resources, in the same order they
+	// were created
+	uint32_t phys_idx = 0;
+	for (uint32_t r = 0; r < ref_graph->resource_count; r++) {
+		_skr_graph_res_t* res = &ref_graph->resources[r];
+		if (res->imported) continue;
+		res->physical = res->first >= 0 ? (int32_t)phys_idx++ : -1;
+		res->tex      = res->first >= 0 ? &ref_graph->physical[res->physical].tex : NULL;
+	}
+	return skr_err_success;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Execute
+///////////////////////////////////////////////////////////////////////////////
+
+// Stages and accesses any transient may have been written or read with
+#define SKR_GRAPH_ALIAS_STAGES (VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT | VK_PIPELINE_STAGE_EARLY_FRAGMENT_TESTS_BIT | VK_PIPELINE_STAGE_LATE_FRAGMENT_TESTS_BIT | \
+                                VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT | VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT | VK_PIPELINE_STAGE_TRANSFER_BIT)
+#define SKR_GRAPH_ALIAS_WRITES (VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT | VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT | VK_ACCESS_SHADER_WRITE_BIT | VK_ACCESS_TRANSFER_WRITE_BIT)
+
+static void _skr_graph_prepare_pass(skr_graph_t* ref_graph, VkCommandBuffer cmd, uint32_t position, const _skr_graph_pass_t* pass, bool is_render) {
+	VkPipelineStageFlags read_stage = is_render
+		? VK_PIPELINE_STAGE_VERTEX_SHADER_BIT | VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT
+		: VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT;
+
+	for (int32_t u = pass->first_use; u >= 0; u = ref_graph->uses[u].next) {
+		const _skr_graph_use_t* use = &ref_graph->uses[u];
+		_skr_graph_res_t*       res = &ref_graph->resources[use->res];
+
+		// A transient's lifetime starts here, its old contents are garbage. If
+		// the memory was used by another transient, wait for that one first.
+		if (!res->imported && res->first == (int32_t)position && !res->written) {
+			if (ref_graph->physical[res->physical].aliased) {
+				_skr_barrier_memory(cmd, SKR_GRAPH_ALIAS_STAGES, SKR_GRAPH_ALIAS_STAGES, SKR_GRAPH_ALIAS_WRITES,
+					SKR_GRAPH_ALIAS_WRITES | VK_ACCESS_COLOR_ATTACHMENT_READ_BIT | VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_READ_BIT | VK_ACCESS_SHADER_READ_BIT | VK_ACCESS_TRANSFER_READ_BIT);
+			}
+			res->tex->current_layout = VK_IMAGE_LAYOUT_UNDEFINED;
+			res->tex->hazard         = (skr_hazard_t){0};
+		}
+
+		switch (use->access) {
+		case _skr_graph_access_read:
+			if (res->tex) _skr_tex_transition_for_shader_read(cmd, res->tex, read_stage);
+			else          _skr_hazard_access(cmd, &res->buffer->_hazard, read_stage, VK_ACCESS_SHADER_READ_BIT | VK_ACCESS_UNIFORM_READ_BIT, false);
+			break;
+		case _skr_graph_access_storage:
+			// Dispatches track their own storage access, textures just need GENERAL
+			if (res->tex) _skr_tex_transition_for_storage(cmd, res->tex);
+			break;
+		case _skr_graph_access_indirect:
+			if (res->buffer) _skr_hazard_access(cmd, &res->buffer->_hazard, VK_PIPELINE_STAGE_DRAW_INDIRECT_BIT, VK_ACCESS_INDIRECT_COMMAND_READ_BIT, false);
+			break;
+		default: break; // Attachments are handled by the render pass
+		}
+	}
+}
+
+skr_err_ skr_graph_execute(skr_graph_t* ref_graph) {
+	if (!ref_graph) return skr_err_invalid_parameter;
+
+	skr_err_ err = _skr_graph_compile(ref_graph);
+	if (err != skr_err_success) {
+		skr_log(skr_log_critical, "skr_graph: compile failed, skipping %u passes", ref_graph->pass_count);
+		return err;
+	}
+
+	// One command buffer batch for the whole graph, passes acquire it again
+	_skr_cmd_ctx_t ctx = _skr_cmd_acquire();
+
+	for (uint32_t i = 0; i < ref_graph->order_count; i++) {
+		_skr_graph_pass_t*    pass    = &ref_graph->passes[ref_graph->order[i]];
+		skr_graph_pass_info_t info    = pass->info;
+		skr_tex_t*            color   = info.color   ? ref_graph->resources[info.color   - 1].tex : NULL;
+		skr_tex_t*            depth   = info.depth   ? ref_graph->resources[info.depth   - 1].tex : NULL;
+		skr_tex_t*            resolve = info.resolve ? ref_graph->resources[info.resolve - 1].tex : NULL;
+		bool                  render  = color || depth;
+
+		if (info.name && vkCmdBeginDebugUtilsLabelEXT) {
+			vkCmdBeginDebugUtilsLabelEXT(ctx.cmd, &(VkDebugUtilsLabelEXT){
+				.sType      = VK_STRUCTURE_TYPE_DEBUG_UTILS_LABEL_EXT,
+				.pLabelName = info.name,
+			});
+		}
+
+		_skr_graph_prepare_pass(ref_graph, ctx.cmd, i, pass, render);
+
+		if (render) {
+			// Load only what an earlier pass (or the world outside the graph)
+			// produced, store depth only if someone looks at it afterwards
+			const _skr_graph_res_t* color_res = color ? &ref_graph->resources[info.color - 1] : NULL;
+			const _skr_graph_res_t* depth_res = depth ? &ref_graph->resources[info.depth - 1] : NULL;
+			bool color_has_data = color_res && !color->is_transient_discard && (color_res->imported || color_res->written);
+			bool depth_has_data = depth_res && !depth->is_transient_discard && (depth_res->imported || depth_res->written);
+			VkAttachmentLoadOp color_load =
+				(info.clear & skr_clear_color)                       ? VK_ATTACHMENT_LOAD_OP_CLEAR :
+				color_has_data                                       ? VK_ATTACHMENT_LOAD_OP_LOAD  : VK_ATTACHMENT_LOAD_OP_DONT_CARE;
+			VkAttachmentLoadOp depth_load =
+				(info.clear & (skr_clear_depth | skr_clear_stencil)) ? VK_ATTACHMENT_LOAD_OP_CLEAR :
+				depth_has_data                                       ? VK_ATTACHMENT_LOAD_OP_LOAD  : VK_ATTACHMENT_LOAD_OP_DONT_CARE;
+			VkAttachmentStoreOp depth_store = depth_res && !depth->is_transient_discard && (depth_res->imported || depth_res->last > (int32_t)i)
+				? VK_ATTACHMENT_STORE_OP_STORE
+				: VK_ATTACHMENT_STORE_OP_DONT_CARE;
+
+			_skr_renderer_begin_pass(color, depth, resolve, info.clear, info.clear_color, info.clear_depth, info.clear_stencil, color_load, depth_load, depth_store);
+			if (info.execute) info.execute(ref_graph, info.user_data);
+			// Imported attachments end up readable like any other pass would
+			// leave them, transient ones wait for the pass that reads them
+			_skr_renderer_end_pass((color_res && color_res->imported) || (depth_res && depth_res->imported));
+		} else if (info.execute) {
+			info.execute(ref_graph, info.user_data);
+		}
+
+		for (int32_t u = pass->first_use; u >= 0; u = ref_graph->uses[u].next) {
+			if (_skr_graph_access_writes(ref_graph->uses[u].access))
+				ref_graph->resources[ref_graph->uses[u].res].written = true;
+		}
+
+		if (info.name && vkCmdEndDebugUtilsLabelEXT) vkCmdEndDebugUtilsLabelEXT(ctx.cmd);
+	}
+
+	_skr_cmd_release(ctx.cmd);
+	return skr_err_success;
+}
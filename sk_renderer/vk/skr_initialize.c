@@ -128,6 +128,12 @@ bool skr_init(skr_settings_t settings) {
 
 	_skr_bind_pool_init();
 	_skr_sampler_cache_init();
+	_skr_bump_pool_init();
+	_skr_readback_pool_init();
+	_skr_vk.bump_shrink_frames = settings.bump_shrink_frames;
+	_skr_vk.frames_in_flight   = SKR_MAX_FRAMES_IN_FLIGHT;
+	_skr_vk.low_latency        = settings.low_latency;
+	if (settings.frames_in_flight != 0) skr_renderer_set_frames_in_flight(settings.frames_in_flight);
 
 	// Set up bind slot configuration (use defaults if not provided)
 	if (settings.bind_settings) {
@@ -161,6 +167,7 @@ bool skr_init(skr_settings_t settings) {
 	// Device extensions
 	const char* required_device_exts[] = {
 		VK_KHR_SWAPCHAIN_EXTENSION_NAME,
+		VK_KHR_TIMELINE_SEMAPHORE_EXTENSION_NAME, // Backs skr_future_t
 	};
 	const char* optional_device_exts[] = {
 #ifndef __ANDROID__
@@ -181,20 +188,34 @@ bool skr_init(skr_settings_t settings) {
 		VK_EXT_EXTERNAL_MEMORY_DMA_BUF_EXTENSION_NAME,
 		VK_EXT_IMAGE_DRM_FORMAT_MODIFIER_EXTENSION_NAME,
 		VK_KHR_IMAGE_FORMAT_LIST_EXTENSION_NAME,
+		// Lets batched barriers keep per-barrier stage masks
+		VK_KHR_SYNCHRONIZATION_2_EXTENSION_NAME,
+		// Global texture/buffer tables for bindless shaders
+		VK_EXT_DESCRIPTOR_INDEXING_EXTENSION_NAME,
 	};
 	const uint32_t required_device_ext_count = sizeof(required_device_exts) / sizeof(required_device_exts[0]);
 	const uint32_t optional_device_ext_count = sizeof(optional_device_exts) / sizeof(optional_device_exts[0]);
 
-	// Video decode extensions (all required together for video support)
+	// Video decode extensions (all required together for video support, and
+	// with synchronization2 from the optional list)
 	const char* video_device_exts[] = {
-		VK_KHR_SYNCHRONIZATION_2_EXTENSION_NAME,
-		VK_KHR_TIMELINE_SEMAPHORE_EXTENSION_NAME,
 		VK_KHR_VIDEO_QUEUE_EXTENSION_NAME,
 		VK_KHR_VIDEO_DECODE_QUEUE_EXTENSION_NAME,
 		VK_KHR_VIDEO_DECODE_H264_EXTENSION_NAME,
 	};
 	const uint32_t video_device_ext_count = sizeof(video_device_exts) / sizeof(video_device_exts[0]);
 
+#ifdef VK_EXT_HOST_IMAGE_COPY_EXTENSION_NAME
+	// Host image copy extensions (all required together), lets unified
+	// memory devices upload textures without a staging buffer.
+	const char* host_copy_device_exts[] = {
+		VK_EXT_HOST_IMAGE_COPY_EXTENSION_NAME,
+		VK_KHR_COPY_COMMANDS_2_EXTENSION_NAME,
+		VK_KHR_FORMAT_FEATURE_FLAGS_2_EXTENSION_NAME,
+	};
+	const uint32_t host_copy_device_ext_count = sizeof(host_copy_device_exts) / sizeof(host_copy_device_exts[0]);
+#endif
+
 	///////////////////////////////////////////////////////////////////////////
 	// Instance creation
 	///////////////////////////////////////////////////////////////////////////
@@ -444,6 +465,26 @@ bool skr_init(skr_settings_t settings) {
 	_skr_vk.timestamp_period      = device_props.limits.timestampPeriod;
 	_skr_vk.min_ubo_offset_align  = (uint32_t)device_props.limits.minUniformBufferOffsetAlignment;
 	_skr_vk.min_ssbo_offset_align = (uint32_t)device_props.limits.minStorageBufferOffsetAlignment;
+	_skr_vk.non_coherent_atom_size = (uint32_t)device_props.limits.nonCoherentAtomSize;
+	_skr_vk.max_push_constants     = device_props.limits.maxPushConstantsSize;
+
+	// Find device local memory the CPU can write directly. Integrated GPUs
+	// and mobile SoCs (UMA) expose this for all their memory, discrete GPUs
+	// only with resizable BAR. The classic 256MB BAR window is too small to
+	// put static assets in, so only larger heaps count.
+	VkPhysicalDeviceMemoryProperties mem_props;
+	vkGetPhysicalDeviceMemoryProperties(_skr_vk.physical_device, &mem_props);
+	const VkMemoryPropertyFlags unified_flags = VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT | VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT;
+	_skr_vk.unified_memory_types = 0;
+	for (uint32_t i = 0; i < mem_props.memoryTypeCount; i++) {
+		if ((mem_props.memoryTypes[i].propertyFlags & unified_flags) == unified_flags &&
+		    mem_props.memoryHeaps[mem_props.memoryTypes[i].heapIndex].size > 256ull * 1024 * 1024) {
+			_skr_vk.unified_memory_types |= 1u << i;
+		}
+	}
+	if (_skr_vk.unified_memory_types != 0) {
+		skr_log(skr_log_info, "Unified device memory available, skipping staging for static uploads");
+	}
 
 	// Calculate maximum supported MSAA sample count (intersection of color + depth)
 	VkSampleCountFlags supported_samples =
@@ -506,9 +547,28 @@ bool skr_init(skr_settings_t settings) {
 		}
 	}
 
+	// Find dedicated async compute queue (COMPUTE but not GRAPHICS), opt-in
+	// since resources then need concurrent sharing between the two families
+	_skr_vk.compute_queue_family = UINT32_MAX;
+	_skr_vk.has_async_compute    = false;
+	if (settings.enable_async_compute) {
+		for (uint32_t i = 0; i < queue_family_count; i++) {
+			if ((queue_families[i].queueFlags & VK_QUEUE_COMPUTE_BIT) &&
+				!(queue_families[i].queueFlags & VK_QUEUE_GRAPHICS_BIT)) {
+				_skr_vk.compute_queue_family = i;
+				_skr_vk.has_async_compute    = true;
+				break;
+			}
+		}
+		if (!_skr_vk.has_async_compute)
+			skr_log(skr_log_info, "No dedicated compute queue, async compute runs on the graphics queue");
+	}
+	_skr_vk.async_queue_families[0] = _skr_vk.graphics_queue_family;
+	_skr_vk.async_queue_families[1] = _skr_vk.compute_queue_family;
+
 	// Create queue create infos
 	float queue_priority = 1.0f;
-	VkDeviceQueueCreateInfo queue_infos[3];
+	VkDeviceQueueCreateInfo queue_infos[4];
 	uint32_t queue_info_count = 0;
 
 	// Always create graphics queue
@@ -542,6 +602,19 @@ bool skr_init(skr_settings_t settings) {
 		};
 	}
 
+	// Compute queue, unless it's the family we already picked for transfers
+	bool need_compute_queue = _skr_vk.has_async_compute &&
+	                          _skr_vk.compute_queue_family != _skr_vk.transfer_queue_family &&
+	                          _skr_vk.compute_queue_family != _skr_vk.video_decode_queue_family;
+	if (need_compute_queue) {
+		queue_infos[queue_info_count++] = (VkDeviceQueueCreateInfo){
+			.sType            = VK_STRUCTURE_TYPE_DEVICE_QUEUE_CREATE_INFO,
+			.queueFamilyIndex = _skr_vk.compute_queue_family,
+			.queueCount       = 1,
+			.pQueuePriorities = &queue_priority,
+		};
+	}
+
 	///////////////////////////////////////////////////////////////////////////
 	// Device creation
 	///////////////////////////////////////////////////////////////////////////
@@ -585,6 +658,8 @@ bool skr_init(skr_settings_t settings) {
 	_skr_vk.has_android_hardware_buffer = false;
 	_skr_vk.has_external_memory_dma_buf = false;
 	_skr_vk.has_drm_format_modifier     = false;
+	_skr_vk.has_synchronization2        = false;
+	_skr_vk.has_descriptor_indexing     = false;
 	bool has_viewport_layer             = false;
 	bool has_image_format_list          = false;
 	for (uint32_t i = 0; i < optional_device_ext_count && device_ext_count < 64; i++) {
@@ -602,12 +677,14 @@ bool skr_init(skr_settings_t settings) {
 			if (strcmp(optional_device_exts[i], VK_EXT_EXTERNAL_MEMORY_DMA_BUF_EXTENSION_NAME    ) == 0) _skr_vk.has_external_memory_dma_buf  = true;
 			if (strcmp(optional_device_exts[i], VK_EXT_IMAGE_DRM_FORMAT_MODIFIER_EXTENSION_NAME   ) == 0) _skr_vk.has_drm_format_modifier      = true;
 			if (strcmp(optional_device_exts[i], VK_KHR_IMAGE_FORMAT_LIST_EXTENSION_NAME           ) == 0) has_image_format_list                 = true;
+			if (strcmp(optional_device_exts[i], VK_KHR_SYNCHRONIZATION_2_EXTENSION_NAME           ) == 0) _skr_vk.has_synchronization2         = true;
+			if (strcmp(optional_device_exts[i], VK_EXT_DESCRIPTOR_INDEXING_EXTENSION_NAME         ) == 0) _skr_vk.has_descriptor_indexing      = settings.enable_bindless;
 		}
 	}
 
 	// Add video decode extensions if all are available (they're all-or-nothing)
 	_skr_vk.has_video_decode = false;
-	if (_skr_vk.video_decode_queue_family != UINT32_MAX) {
+	if (_skr_vk.video_decode_queue_family != UINT32_MAX && _skr_vk.has_synchronization2) {
 		uint32_t video_found = 0;
 		for (uint32_t v = 0; v < video_device_ext_count; v++) {
 			if (_skr_ext_available(video_device_exts[v], available_device_exts, available_device_ext_count))
@@ -621,6 +698,58 @@ bool skr_init(skr_settings_t settings) {
 		}
 	}
 
+	// Add host image copy extensions if all are available, and the feature
+	// is supported. Only worth it when device memory is CPU writable.
+	_skr_vk.has_host_image_copy    = false;
+	_skr_vk.host_image_copy_layout = VK_IMAGE_LAYOUT_GENERAL;
+#ifdef VK_EXT_HOST_IMAGE_COPY_EXTENSION_NAME
+	VkPhysicalDeviceHostImageCopyFeaturesEXT host_copy_features = {
+		.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_HOST_IMAGE_COPY_FEATURES_EXT,
+	};
+	if (_skr_vk.unified_memory_types != 0) {
+		uint32_t host_copy_found = 0;
+		for (uint32_t h = 0; h < host_copy_device_ext_count; h++) {
+			if (_skr_ext_available(host_copy_device_exts[h], available_device_exts, available_device_ext_count))
+				host_copy_found++;
+		}
+		if (host_copy_found == host_copy_device_ext_count) {
+			vkGetPhysicalDeviceFeatures2(_skr_vk.physical_device, &(VkPhysicalDeviceFeatures2){
+				.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FEATURES_2,
+				.pNext = &host_copy_features,
+			});
+		}
+		if (host_copy_features.hostImageCopy) {
+			for (uint32_t h = 0; h < host_copy_device_ext_count; h++) {
+				// Skip any the app already asked for
+				bool present = false;
+				for (uint32_t e = 0; e < device_ext_count; e++) present = present || strcmp(device_exts[e], host_copy_device_exts[h]) == 0;
+				if (!present && device_ext_count < 64) device_exts[device_ext_count++] = host_copy_device_exts[h];
+			}
+			_skr_vk.has_host_image_copy = true;
+
+			// Prefer copying straight into the sampling layout
+			VkImageLayout dst_layouts[32];
+			VkPhysicalDeviceHostImageCopyPropertiesEXT host_copy_props = {
+				.sType               = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_HOST_IMAGE_COPY_PROPERTIES_EXT,
+				.copyDstLayoutCount  = sizeof(dst_layouts) / sizeof(dst_layouts[0]),
+				.pCopyDstLayouts     = dst_layouts,
+			};
+			vkGetPhysicalDeviceProperties2(_skr_vk.physical_device, &(VkPhysicalDeviceProperties2){
+				.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PROPERTIES_2,
+				.pNext = &host_copy_props,
+			});
+			for (uint32_t l = 0; l < host_copy_props.copyDstLayoutCount; l++) {
+				if (dst_layouts[l] == VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL) _skr_vk.host_image_copy_layout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+			}
+			skr_log(skr_log_info, "Host image copy enabled for texture uploads");
+		}
+	}
+	host_copy_features = (VkPhysicalDeviceHostImageCopyFeaturesEXT){
+		.sType         = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_HOST_IMAGE_COPY_FEATURES_EXT,
+		.hostImageCopy = _skr_vk.has_host_image_copy,
+	};
+#endif
+
 	_skr_free(available_device_exts);
 
 	// Log optional extension status
@@ -652,7 +781,20 @@ bool skr_init(skr_settings_t settings) {
 		.samplerYcbcrConversion = VK_TRUE,
 	};
 
-	// Chain video decode feature structs if enabled
+	// Timeline semaphores back command futures, and there's no fallback
+	// without them, so the extension alone isn't enough. Chain
+	// synchronization2 on top when available.
+	VkPhysicalDeviceTimelineSemaphoreFeatures timeline_supported = {
+		.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_TIMELINE_SEMAPHORE_FEATURES,
+	};
+	vkGetPhysicalDeviceFeatures2(_skr_vk.physical_device, &(VkPhysicalDeviceFeatures2){
+		.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FEATURES_2,
+		.pNext = &timeline_supported,
+	});
+	if (!timeline_supported.timelineSemaphore) {
+		skr_log(skr_log_critical, "Device doesn't support timeline semaphores, which sk_renderer requires");
+		return false;
+	}
 	VkPhysicalDeviceTimelineSemaphoreFeatures timeline_features = {
 		.sType            = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_TIMELINE_SEMAPHORE_FEATURES,
 		.pNext            = &ycbcr_features,
@@ -664,9 +806,53 @@ bool skr_init(skr_settings_t settings) {
 		.synchronization2 = VK_TRUE,
 	};
 
+	void* feature_chain = _skr_vk.has_synchronization2 ? (void*)&sync2_features : (void*)&timeline_features;
+
+	// Bindless tables need non-uniform indexing into partially bound,
+	// update-after-bind arrays of sampled images and storage buffers
+	VkPhysicalDeviceDescriptorIndexingFeaturesEXT indexing_features = {
+		.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_INDEXING_FEATURES_EXT,
+	};
+	if (_skr_vk.has_descriptor_indexing) {
+		vkGetPhysicalDeviceFeatures2(_skr_vk.physical_device, &(VkPhysicalDeviceFeatures2){
+			.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FEATURES_2,
+			.pNext = &indexing_features,
+		});
+		_skr_vk.has_descriptor_indexing =
+			indexing_features.runtimeDescriptorArray                        &&
+			indexing_features.descriptorBindingPartiallyBound               &&
+			indexing_features.descriptorBindingUpdateUnusedWhilePending     &&
+			indexing_features.descriptorBindingSampledImageUpdateAfterBind  &&
+			indexing_features.descriptorBindingStorageBufferUpdateAfterBind &&
+			indexing_features.shaderSampledImageArrayNonUniformIndexing     &&
+			indexing_features.shaderStorageBufferArrayNonUniformIndexing;
+		if (!_skr_vk.has_descriptor_indexing)
+			skr_log(skr_log_info, "Descriptor indexing is missing features, bindless shaders unavailable");
+	}
+	if (_skr_vk.has_descriptor_indexing) {
+		indexing_features = (VkPhysicalDeviceDescriptorIndexingFeaturesEXT){
+			.sType                                         = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_INDEXING_FEATURES_EXT,
+			.pNext                                         = feature_chain,
+			.runtimeDescriptorArray                        = VK_TRUE,
+			.descriptorBindingPartiallyBound               = VK_TRUE,
+			.descriptorBindingUpdateUnusedWhilePending     = VK_TRUE,
+			.descriptorBindingSampledImageUpdateAfterBind  = VK_TRUE,
+			.descriptorBindingStorageBufferUpdateAfterBind = VK_TRUE,
+			.shaderSampledImageArrayNonUniformIndexing     = VK_TRUE,
+			.shaderStorageBufferArrayNonUniformIndexing    = VK_TRUE,
+		};
+		feature_chain = &indexing_features;
+	}
+#ifdef VK_EXT_HOST_IMAGE_COPY_EXTENSION_NAME
+	if (_skr_vk.has_host_image_copy) {
+		host_copy_features.pNext = feature_chain;
+		feature_chain            = &host_copy_features;
+	}
+#endif
+
 	VkDeviceCreateInfo device_info = {
 		.sType                   = VK_STRUCTURE_TYPE_DEVICE_CREATE_INFO,
-		.pNext                   = _skr_vk.has_video_decode ? (void*)&sync2_features : (void*)&ycbcr_features,
+		.pNext                   = feature_chain,
 		.queueCreateInfoCount    = queue_info_count,
 		.pQueueCreateInfos       = queue_infos,
 		.enabledExtensionCount   = device_ext_count,
@@ -732,6 +918,17 @@ bool skr_init(skr_settings_t settings) {
 		_skr_vk.video_decode_queue_mutex = &_skr_vk.queue_mutexes[3];
 	}
 
+	// Compute: shares queue 0 (and its mutex) when the family was already
+	// created for transfer or video decode
+	if (!_skr_vk.has_async_compute) {
+		_skr_vk.compute_queue_mutex = NULL;
+	} else {
+		vkGetDeviceQueue(_skr_vk.device, _skr_vk.compute_queue_family, 0, &_skr_vk.compute_queue);
+		if      (_skr_vk.compute_queue_family == _skr_vk.transfer_queue_family)     _skr_vk.compute_queue_mutex = _skr_vk.transfer_queue_mutex;
+		else if (_skr_vk.compute_queue_family == _skr_vk.video_decode_queue_family) _skr_vk.compute_queue_mutex = _skr_vk.video_decode_queue_mutex;
+		else                                                                         _skr_vk.compute_queue_mutex = &_skr_vk.queue_mutexes[4];
+	}
+
 	// Create command pool
 	VkCommandPoolCreateInfo pool_info = {
 		.sType            = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO,
@@ -801,6 +998,10 @@ bool skr_init(skr_settings_t settings) {
 	SKR_VK_CHECK_RET(vr, "vkCreateDescriptorPool", false);
 	_skr_cmd_destroy_descriptor_pool(&_skr_vk.destroy_list, _skr_vk.descriptor_pool);
 
+	if (!_skr_material_sets_init()) {
+		skr_log(skr_log_warning, "Failed to create material set pool, descriptors will be written per draw");
+	}
+
 	_skr_pipeline_init();
 
 	if (!_skr_cmd_init()) {
@@ -811,12 +1012,20 @@ bool skr_init(skr_settings_t settings) {
 	// Initialize main thread
 	skr_thread_init();
 
+	// Before the default textures, so white claims bindless index 0
+	if (_skr_vk.has_descriptor_indexing && !_skr_bindless_init()) {
+		skr_log(skr_log_warning, "Failed to create bindless tables, bindless shaders unavailable");
+		_skr_bindless_shutdown();
+		_skr_vk.has_descriptor_indexing = false;
+	}
+
 	const skr_tex_sampler_t sampler = {
 		.sample  = skr_tex_sample_linear,
 		.address = skr_tex_address_clamp
 	};
 	uint32_t color = 0xFFFFFFFF;
 	skr_tex_create( skr_tex_fmt_rgba32_linear, skr_tex_flags_readable, sampler, (skr_vec3i_t){1, 1, 1}, 1, 1, &(skr_tex_data_t){.data = &color, .mip_count = 1, .layer_count = 1}, &_skr_vk.default_tex_white);
+	_skr_bindless_tex_index(&_skr_vk.default_tex_white);
 	color = 0xFF808080;
 	skr_tex_create( skr_tex_fmt_rgba32_linear, skr_tex_flags_readable, sampler, (skr_vec3i_t){1, 1, 1}, 1, 1, &(skr_tex_data_t){.data = &color, .mip_count = 1, .layer_count = 1}, &_skr_vk.default_tex_gray);
 	color = 0xFF000000;
@@ -828,6 +1037,8 @@ bool skr_init(skr_settings_t settings) {
 	_skr_vk.capabilities[skr_capability_external_ahb] = _skr_vk.has_android_hardware_buffer;
 	_skr_vk.capabilities[skr_capability_external_dma] = _skr_vk.has_external_memory_dma_buf && _skr_vk.has_drm_format_modifier && has_image_format_list;
 	_skr_vk.capabilities[skr_capability_vk_video]    = _skr_vk.has_video_decode;
+	_skr_vk.capabilities[skr_capability_async_compute] = _skr_vk.has_async_compute;
+	_skr_vk.capabilities[skr_capability_bindless]      = _skr_bindless_available();
 
 	_skr_vk.initialized = true;
 	return true;
@@ -836,6 +1047,7 @@ bool skr_init(skr_settings_t settings) {
 void skr_shutdown(void) {
 	if (!_skr_vk.initialized) return;
 
+	_skr_cmd_submit_pending();
 	vkDeviceWaitIdle(_skr_vk.device);
 
 	skr_tex_destroy(&_skr_vk.default_tex_white);
@@ -843,12 +1055,20 @@ void skr_shutdown(void) {
 	skr_tex_destroy(&_skr_vk.default_tex_black);
 
 	_skr_cmd_shutdown      ();  // Executes per-command destroy lists (may free bind pool slots)
+	_skr_bump_pool_shutdown();  // Bump allocators have all returned their pages by now
+	_skr_readback_pool_shutdown();
 	_skr_pipeline_shutdown ();
 
+	for (uint32_t i = 0; i < _skr_vk.retired_count; i++) {  // Swapchain leftovers, if a surface outlived shutdown
+		_skr_destroy_list_execute(&_skr_vk.retired[i].list);
+		_skr_destroy_list_free   (&_skr_vk.retired[i].list);
+	}
+	_skr_free(_skr_vk.retired);
 	_skr_destroy_list_execute(&_skr_vk.destroy_list);  // Execute global destroy list
 	_skr_destroy_list_free   (&_skr_vk.destroy_list);
 
 	_skr_bind_pool_shutdown();     // Free bind pool after all deferred destroys are done
+	_skr_bindless_shutdown();      // Likewise for bindless slots
 	_skr_sampler_cache_shutdown(); // Destroy cached samplers after GPU is idle
 
 	// Free dynamic arrays
@@ -895,11 +1115,16 @@ uint32_t skr_get_vk_video_decode_queue_family(void) {
 	return _skr_vk.video_decode_queue_family;
 }
 
+uint32_t skr_get_vk_compute_queue_family(void) {
+	return _skr_vk.compute_queue_family;
+}
+
 void skr_vk_queue_lock(uint32_t queue_family) {
 	mtx_t *m = NULL;
 	if      (queue_family == _skr_vk.graphics_queue_family)      m = _skr_vk.graphics_queue_mutex;
 	else if (queue_family == _skr_vk.transfer_queue_family)      m = _skr_vk.transfer_queue_mutex;
 	else if (queue_family == _skr_vk.video_decode_queue_family)  m = _skr_vk.video_decode_queue_mutex;
+	else if (queue_family == _skr_vk.compute_queue_family)       m = _skr_vk.compute_queue_mutex;
 	if (m) mtx_lock(m);
 }
 
@@ -908,6 +1133,7 @@ void skr_vk_queue_unlock(uint32_t queue_family) {
 	if      (queue_family == _skr_vk.graphics_queue_family)      m = _skr_vk.graphics_queue_mutex;
 	else if (queue_family == _skr_vk.transfer_queue_family)      m = _skr_vk.transfer_queue_mutex;
 	else if (queue_family == _skr_vk.video_decode_queue_family)  m = _skr_vk.video_decode_queue_mutex;
+	else if (queue_family == _skr_vk.compute_queue_family)       m = _skr_vk.compute_queue_mutex;
 	if (m) mtx_unlock(m);
 }
 
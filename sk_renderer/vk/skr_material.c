@@ -18,22 +18,10 @@
 // Bind pool implementation
 ///////////////////////////////////////////////////////////////////////////////
 
-#define SKR_BIND_POOL_INITIAL_CAPACITY 256
-#define SKR_BIND_POOL_FREE_INITIAL     16
+#define SKR_BIND_POOL_FREE_INITIAL 16
 
 void _skr_bind_pool_init(void) {
-	_skr_bind_pool_t* pool = &_skr_vk.bind_pool;
-
-	mtx_init(&pool->mutex, mtx_plain);
-
-	pool->capacity            = SKR_BIND_POOL_INITIAL_CAPACITY;
-	pool->binds               = (_skr_calloc(pool->capacity, sizeof(skr_material_bind_t)));
-	pool->free_range_capacity = SKR_BIND_POOL_FREE_INITIAL;
-	pool->free_range_count    = 1;
-	pool->free_ranges         = (_skr_malloc(pool->free_range_capacity * sizeof(_skr_bind_range_t)));
-
-	// Initially all slots are free as one contiguous range
-	pool->free_ranges[0] = (_skr_bind_range_t){ .start = 0, .count = pool->capacity };
+	mtx_init(&_skr_vk.bind_pool.mutex, mtx_plain);
 }
 
 void _skr_bind_pool_shutdown(void) {
@@ -41,168 +29,585 @@ void _skr_bind_pool_shutdown(void) {
 
 	mtx_destroy(&pool->mutex);
 
-	_skr_free(pool->binds);
-	_skr_free(pool->free_ranges);
+	// The set pool itself went with the global destroy list, only the
+	// bookkeeping is left.
+	for (uint32_t i = 0; i < pool->set_capacity; i++) {
+		if (pool->sets[i] == NULL) continue;
+		for (uint32_t e = 0; e < SKR_MATERIAL_SET_CACHE; e++) _skr_free(pool->sets[i]->entries[e].writes);
+		_skr_free(pool->sets[i]);
+	}
+	_skr_free(pool->sets);
+	_skr_free(pool->set_handles);
+	for (uint32_t i = 0; i < pool->chunk_count;     i++) { _skr_free(pool->chunks[i]); _skr_free(pool->refs[i]); }
+	for (uint32_t i = 0; i < SKR_BIND_POOL_CLASSES; i++) _skr_free(pool->free_lists[i].starts);
 	*pool = (_skr_bind_pool_t){0};
 }
 
+static uint32_t _skr_bind_pool_class(uint32_t count) {
+	uint32_t size_class = 0;
+	while ((1u << size_class) < count) size_class++;
+	return size_class;
+}
+
+// Caller holds the pool lock
+static void _skr_bind_pool_push_free(_skr_bind_pool_t* pool, uint32_t size_class, uint32_t start) {
+	_skr_bind_free_list_t* list = &pool->free_lists[size_class];
+	if (list->count >= list->capacity) {
+		uint32_t  new_capacity = list->capacity ? list->capacity * 2 : SKR_BIND_POOL_FREE_INITIAL;
+		uint32_t* new_starts   = _skr_realloc(list->starts, new_capacity * sizeof(uint32_t));
+		if (!new_starts) {
+			skr_log(skr_log_warning, "Failed to grow bind pool free list");
+			return;  // Not fatal, the range just isn't reused
+		}
+		list->starts   = new_starts;
+		list->capacity = new_capacity;
+	}
+	list->starts[list->count++] = start;
+}
+
 int32_t _skr_bind_pool_alloc(uint32_t count) {
 	if (count == 0) return -1;
+	if (count > SKR_BIND_POOL_CHUNK_SIZE) {
+		skr_log(skr_log_critical, "Bind pool ranges are limited to %u slots, %u requested", SKR_BIND_POOL_CHUNK_SIZE, count);
+		return -1;
+	}
 
-	_skr_bind_pool_t* pool = &_skr_vk.bind_pool;
-	int32_t result = -1;
+	_skr_bind_pool_t* pool       = &_skr_vk.bind_pool;
+	uint32_t          size_class = _skr_bind_pool_class(count);
+	uint32_t          size       = 1u << size_class;
+	int32_t           result     = -1;
 
 	mtx_lock(&pool->mutex);
 
-	// First-fit search through free ranges
-	for (uint32_t i = 0; i < pool->free_range_count; i++) {
-		if (pool->free_ranges[i].count >= count) {
-			uint32_t start = pool->free_ranges[i].start;
-
-			// Shrink or remove this range
-			if (pool->free_ranges[i].count == count) {
-				// Remove range by swapping with last
-				pool->free_ranges[i] = pool->free_ranges[--pool->free_range_count];
-			} else {
-				// Shrink range
-				pool->free_ranges[i].start += count;
-				pool->free_ranges[i].count -= count;
-			}
+	// Reuse a freed range of the same size, those were cleared on free
+	_skr_bind_free_list_t* list = &pool->free_lists[size_class];
+	if (list->count > 0) {
+		result = (int32_t)list->starts[--list->count];
+		goto done;
+	}
 
-			// Zero out the allocated slots
-			memset(&pool->binds[start], 0, count * sizeof(skr_material_bind_t));
-			result = (int32_t)start;
+	// Otherwise carve it off the end of the newest chunk. When it doesn't
+	// fit, the chunk's tail goes to the free lists and a new chunk starts.
+	uint32_t chunk_end = pool->chunk_count << SKR_BIND_POOL_CHUNK_SHIFT;
+	if (pool->top + size > chunk_end) {
+		if (pool->chunk_count >= SKR_BIND_POOL_MAX_CHUNKS) {
+			skr_log(skr_log_critical, "Bind pool is full");
+			goto done;
+		}
+		skr_material_bind_t* chunk = _skr_calloc(SKR_BIND_POOL_CHUNK_SIZE, sizeof(skr_material_bind_t));
+		uint32_t*            refs  = _skr_calloc(SKR_BIND_POOL_CHUNK_SIZE, sizeof(uint32_t));
+		if (!chunk || !refs) {
+			skr_log(skr_log_critical, "Failed to grow bind pool");
+			_skr_free(chunk);
+			_skr_free(refs);
 			goto done;
 		}
+		while (pool->top < chunk_end) {
+			uint32_t piece = _skr_bind_pool_class(chunk_end - pool->top + 1) - 1;
+			_skr_bind_pool_push_free(pool, piece, pool->top);
+			pool->top += 1u << piece;
+		}
+		pool->refs  [pool->chunk_count  ] = refs;
+		pool->chunks[pool->chunk_count++] = chunk;
 	}
+	result     = (int32_t)pool->top;
+	pool->top += size;
+
+done:
+	if (result >= 0) pool->refs[(uint32_t)result >> SKR_BIND_POOL_CHUNK_SHIFT][(uint32_t)result & (SKR_BIND_POOL_CHUNK_SIZE - 1)] = 1;
+	mtx_unlock(&pool->mutex);
+	return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Handles written into persistent sets, all called with the pool lock held
+///////////////////////////////////////////////////////////////////////////////
 
-	// No suitable range found, grow the pool
-	uint32_t old_capacity = pool->capacity;
-	uint32_t new_capacity = pool->capacity * 2;
-	while (new_capacity - old_capacity < count) {
-		new_capacity *= 2;
+static uint32_t _skr_set_handles_home(uint64_t handle, uint32_t capacity) {
+	return (uint32_t)(((handle ^ (handle >> 29)) * 1099511628211ULL) >> 16) & (capacity - 1);
+}
+
+// Returns the matching slot, or the empty one it would go in
+static _skr_material_set_handle_t* _skr_set_handles_slot(_skr_material_set_handle_t* handles, uint32_t capacity, uint64_t handle) {
+	for (uint32_t at = _skr_set_handles_home(handle, capacity); ; at = (at + 1) & (capacity - 1)) {
+		if (handles[at].handle == 0 || handles[at].handle == handle) return &handles[at];
 	}
+}
 
-	skr_material_bind_t* new_binds = _skr_realloc(pool->binds, new_capacity * sizeof(skr_material_bind_t));
-	if (!new_binds) {
-		skr_log(skr_log_critical, "Failed to grow bind pool");
-		goto done;
+static bool _skr_set_handles_grow(_skr_bind_pool_t* ref_pool) {
+	uint32_t                    capacity = ref_pool->set_handle_capacity ? ref_pool->set_handle_capacity * 2 : 256;
+	_skr_material_set_handle_t* handles  = _skr_calloc(capacity, sizeof(_skr_material_set_handle_t));
+	if (!handles) return false;
+
+	for (uint32_t i = 0; i < ref_pool->set_handle_capacity; i++) {
+		if (ref_pool->set_handles[i].handle != 0)
+			*_skr_set_handles_slot(handles, capacity, ref_pool->set_handles[i].handle) = ref_pool->set_handles[i];
 	}
-	pool->binds    = new_binds;
-	pool->capacity = new_capacity;
-
-	// Zero new memory
-	memset(&pool->binds[old_capacity], 0, (new_capacity - old_capacity) * sizeof(skr_material_bind_t));
-
-	// Add the new free space (minus what we're about to allocate)
-	uint32_t remaining = (new_capacity - old_capacity) - count;
-	if (remaining > 0) {
-		// Grow free range array if needed
-		if (pool->free_range_count >= pool->free_range_capacity) {
-			uint32_t new_range_capacity = pool->free_range_capacity * 2;
-			_skr_bind_range_t* new_ranges = _skr_realloc(pool->free_ranges, new_range_capacity * sizeof(_skr_bind_range_t));
-			if (!new_ranges) {
-				skr_log(skr_log_warning, "Failed to grow bind pool free range array");
-				// Not fatal - we just can't track this free space
-			} else {
-				pool->free_ranges         = new_ranges;
-				pool->free_range_capacity = new_range_capacity;
-				pool->free_ranges[pool->free_range_count++] = (_skr_bind_range_t){
-					.start = old_capacity + count,
-					.count = remaining
-				};
+	_skr_free(ref_pool->set_handles);
+	ref_pool->set_handles         = handles;
+	ref_pool->set_handle_capacity = capacity;
+	return true;
+}
+
+static uint32_t _skr_set_handles_uses(const _skr_bind_pool_t* pool, uint64_t handle) {
+	if (handle == 0 || pool->set_handle_count == 0) return 0;
+	return _skr_set_handles_slot(pool->set_handles, pool->set_handle_capacity, handle)->uses;
+}
+
+// Adds or removes every handle an entry's writes reference
+static void _skr_set_handles_track(_skr_bind_pool_t* ref_pool, const _skr_material_set_entry_t* entry, bool add) {
+	for (uint32_t w = 0; w < entry->write_count; w++) {
+		uint64_t handle = entry->writes[w].handle;
+		if (handle == 0) continue;
+
+		if (add) {
+			if ((ref_pool->set_handle_count + 1) * 4 > ref_pool->set_handle_capacity * 3 && !_skr_set_handles_grow(ref_pool)) {
+				ref_pool->set_handles_lost = true;
+				continue;
 			}
-		} else {
-			pool->free_ranges[pool->free_range_count++] = (_skr_bind_range_t){
-				.start = old_capacity + count,
-				.count = remaining
-			};
+			_skr_material_set_handle_t* slot = _skr_set_handles_slot(ref_pool->set_handles, ref_pool->set_handle_capacity, handle);
+			if (slot->handle == 0) { slot->handle = handle; ref_pool->set_handle_count++; }
+			slot->uses++;
+			continue;
 		}
+
+		if (ref_pool->set_handle_count == 0) continue;
+		_skr_material_set_handle_t* slot = _skr_set_handles_slot(ref_pool->set_handles, ref_pool->set_handle_capacity, handle);
+		if (slot->handle == 0 || --slot->uses > 0) continue;
+
+		// Last use, shift later entries of the probe run back over the gap
+		uint32_t mask = ref_pool->set_handle_capacity - 1;
+		uint32_t gap  = (uint32_t)(slot - ref_pool->set_handles);
+		for (uint32_t i = (gap + 1) & mask; ref_pool->set_handles[i].handle != 0; i = (i + 1) & mask) {
+			uint32_t home = _skr_set_handles_home(ref_pool->set_handles[i].handle, ref_pool->set_handle_capacity);
+			// Move it if its home isn't between the gap and where it sits now
+			if (((i - home) & mask) >= ((i - gap) & mask)) {
+				ref_pool->set_handles[gap] = ref_pool->set_handles[i];
+				gap = i;
+			}
+		}
+		ref_pool->set_handles[gap] = (_skr_material_set_handle_t){0};
+		ref_pool->set_handle_count--;
 	}
+}
 
-	result = (int32_t)old_capacity;
+void _skr_bind_pool_free(int32_t start, uint32_t count) {
+	if (start < 0 || count == 0 || count > SKR_BIND_POOL_CHUNK_SIZE) return;
+
+	_skr_bind_pool_t* pool       = &_skr_vk.bind_pool;
+	uint32_t          size_class = _skr_bind_pool_class(count);
+
+	skr_material_bind_t* binds = _skr_bind_pool_get(start);
+	if (!binds) return;
+
+	mtx_lock(&pool->mutex);
+
+	// Ranges shared by material variants stay until the last one lets go
+	uint32_t* ref = &pool->refs[(uint32_t)start >> SKR_BIND_POOL_CHUNK_SHIFT][(uint32_t)start & (SKR_BIND_POOL_CHUNK_SIZE - 1)];
+	if (*ref > 1) {
+		*ref -= 1;
+		mtx_unlock(&pool->mutex);
+		return;
+	}
+	*ref = 0;
+
+	// Clear the freed slots (helps catch use-after-free), alloc relies on it
+	memset(binds, 0, ((size_t)1 << size_class) * sizeof(skr_material_bind_t));
+
+	// Slots are freed once the GPU is done with them, so the material's
+	// persistent sets can go right away.
+	if ((uint32_t)start < pool->set_capacity && pool->sets[start]) {
+		_skr_material_sets_t* sets = pool->sets[start];
+		for (uint32_t i = 0; i < SKR_MATERIAL_SET_CACHE; i++) {
+			if (sets->entries[i].set != VK_NULL_HANDLE && pool->set_pool != VK_NULL_HANDLE)
+				vkFreeDescriptorSets(_skr_vk.device, pool->set_pool, 1, &sets->entries[i].set);
+			_skr_set_handles_track(pool, &sets->entries[i], false);
+			_skr_free(sets->entries[i].writes);
+		}
+		_skr_free(sets);
+		pool->sets[start] = NULL;
+	}
+
+	_skr_bind_pool_push_free(pool, size_class, (uint32_t)start);
 
-done:
 	mtx_unlock(&pool->mutex);
-	return result;
 }
 
-void _skr_bind_pool_free(int32_t start, uint32_t count) {
-	if (start < 0 || count == 0) return;
+void _skr_bind_pool_ref(int32_t start) {
+	if (!_skr_bind_pool_get(start)) return;
 
 	_skr_bind_pool_t* pool = &_skr_vk.bind_pool;
+	mtx_lock(&pool->mutex);
+	pool->refs[(uint32_t)start >> SKR_BIND_POOL_CHUNK_SHIFT][(uint32_t)start & (SKR_BIND_POOL_CHUNK_SIZE - 1)] += 1;
+	mtx_unlock(&pool->mutex);
+}
+
+bool _skr_bind_pool_shared(int32_t start) {
+	if (!_skr_bind_pool_get(start)) return false;
 
+	_skr_bind_pool_t* pool = &_skr_vk.bind_pool;
 	mtx_lock(&pool->mutex);
+	bool result = pool->refs[(uint32_t)start >> SKR_BIND_POOL_CHUNK_SHIFT][(uint32_t)start & (SKR_BIND_POOL_CHUNK_SIZE - 1)] > 1;
+	mtx_unlock(&pool->mutex);
+	return result;
+}
 
-	// Clear the freed slots (helps catch use-after-free)
-	memset(&pool->binds[start], 0, count * sizeof(skr_material_bind_t));
+skr_material_bind_t* _skr_bind_pool_get(int32_t start) {
+	// Chunks never move or go away before shutdown, so no lock is needed.
+	// Ranges come from _skr_bind_pool_alloc and never straddle a chunk.
+	if (start < 0) return NULL;
+	uint32_t chunk = (uint32_t)start >> SKR_BIND_POOL_CHUNK_SHIFT;
+	if (chunk >= SKR_BIND_POOL_MAX_CHUNKS || _skr_vk.bind_pool.chunks[chunk] == NULL) return NULL;
+	return &_skr_vk.bind_pool.chunks[chunk][(uint32_t)start & (SKR_BIND_POOL_CHUNK_SIZE - 1)];
+}
 
-	// Try to coalesce with adjacent ranges
-	uint32_t freed_start = (uint32_t)start;
-	uint32_t freed_end   = freed_start + count;
+///////////////////////////////////////////////////////////////////////////////
+// Persistent material descriptor sets
+//
+// Without push descriptors, every draw used to allocate and write a fresh set
+// from the command ring's pool. Instead, each material keeps a few sets of its
+// own, keyed on the resolved handles they were written with. The per-draw
+// buffers (material params, system data, instance data) live in bump pages
+// that move every draw, so those bindings are dynamic and their offsets are
+// supplied at bind time rather than baked into the set.
+///////////////////////////////////////////////////////////////////////////////
 
-	for (uint32_t i = 0; i < pool->free_range_count; i++) {
-		uint32_t range_end = pool->free_ranges[i].start + pool->free_ranges[i].count;
+#define SKR_MATERIAL_SET_POOL_SIZE 4096
 
-		// Check if this range is immediately before the freed region
-		if (range_end == freed_start) {
-			pool->free_ranges[i].count += count;
+bool _skr_material_sets_init(void) {
+	if (_skr_vk.has_push_descriptors) return true;
 
-			// Check if we can also merge with a range after
-			for (uint32_t j = 0; j < pool->free_range_count; j++) {
-				if (j != i && pool->free_ranges[j].start == freed_end) {
-					pool->free_ranges[i].count += pool->free_ranges[j].count;
-					pool->free_ranges[j] = pool->free_ranges[--pool->free_range_count];
-					break;
-				}
+	VkDescriptorPoolSize pool_sizes[] = {
+		{ .type = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER,         .descriptorCount = SKR_MATERIAL_SET_POOL_SIZE * 2 },
+		{ .type = VK_DESCRIPTOR_TYPE_STORAGE_IMAGE,          .descriptorCount = SKR_MATERIAL_SET_POOL_SIZE     },
+		{ .type = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER, .descriptorCount = SKR_MATERIAL_SET_POOL_SIZE * 4 },
+		{ .type = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER,         .descriptorCount = SKR_MATERIAL_SET_POOL_SIZE     },
+		{ .type = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC, .descriptorCount = SKR_MATERIAL_SET_POOL_SIZE * 2 },
+		{ .type = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER_DYNAMIC, .descriptorCount = SKR_MATERIAL_SET_POOL_SIZE     },
+	};
+	VkResult vr = vkCreateDescriptorPool(_skr_vk.device, &(VkDescriptorPoolCreateInfo){
+		.sType         = VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO,
+		.flags         = VK_DESCRIPTOR_POOL_CREATE_FREE_DESCRIPTOR_SET_BIT,
+		.maxSets       = SKR_MATERIAL_SET_POOL_SIZE,
+		.poolSizeCount = sizeof(pool_sizes) / sizeof(pool_sizes[0]),
+		.pPoolSizes    = pool_sizes,
+	}, NULL, &_skr_vk.bind_pool.set_pool);
+	SKR_VK_CHECK_RET(vr, "vkCreateDescriptorPool", false);
+	_skr_cmd_destroy_descriptor_pool(&_skr_vk.destroy_list, _skr_vk.bind_pool.set_pool);
+	_skr_set_debug_name(_skr_vk.device, VK_OBJECT_TYPE_DESCRIPTOR_POOL, (uint64_t)_skr_vk.bind_pool.set_pool, "MaterialSetPool");
+	return true;
+}
+
+void _skr_material_sets_invalidate(const uint64_t* handles, uint32_t count) {
+	if (_skr_vk.has_push_descriptors || count == 0) return;
+
+	// Handles can be recycled by the driver, so a set written with one of
+	// these must not match anything created later. Sets that don't reference
+	// them stay cached. Most destroyed handles (transient buffers, textures
+	// only drawn through push or ring sets) were never written into a
+	// persistent set, and skip the scan entirely.
+	_skr_bind_pool_t* pool          = &_skr_vk.bind_pool;
+	VkDescriptorSet*  dropped       = NULL;
+	uint32_t          dropped_count = 0;
+	uint32_t          dropped_cap   = 0;
+
+	mtx_lock(&pool->mutex);
+	uint32_t remaining = 0;
+	for (uint32_t h = 0; h < count; h++) remaining += _skr_set_handles_uses(pool, handles[h]);
+
+	for (uint32_t start = 0; start < pool->set_capacity && (remaining > 0 || pool->set_handles_lost); start++) {
+		_skr_material_sets_t* sets = pool->sets[start];
+		if (sets == NULL) continue;
+
+		for (uint32_t e = 0; e < SKR_MATERIAL_SET_CACHE; e++) {
+			_skr_material_set_entry_t* entry = &sets->entries[e];
+			if (entry->set == VK_NULL_HANDLE) continue;
+
+			uint32_t uses = 0;
+			for (uint32_t w = 0; w < entry->write_count; w++) {
+				for (uint32_t h = 0; h < count; h++)
+					if (handles[h] != 0 && entry->writes[w].handle == handles[h]) uses++;
 			}
-			goto done;
+			if (uses == 0) continue;
+			remaining = remaining > uses ? remaining - uses : 0;
+			_skr_set_handles_track(pool, entry, false);
+
+			if (dropped_count >= dropped_cap) {
+				uint32_t         new_cap = dropped_cap ? dropped_cap * 2 : 16;
+				VkDescriptorSet* grown   = _skr_realloc(dropped, new_cap * sizeof(VkDescriptorSet));
+				if (grown) { dropped = grown; dropped_cap = new_cap; }
+			}
+			// Without room to defer it, the set is freed at shutdown with the pool
+			if (dropped_count < dropped_cap) dropped[dropped_count++] = entry->set;
+			_skr_free(entry->writes);
+			*entry = (_skr_material_set_entry_t){0};
 		}
+	}
+	mtx_unlock(&pool->mutex);
 
-		// Check if this range is immediately after the freed region
-		if (pool->free_ranges[i].start == freed_end) {
-			pool->free_ranges[i].start  = freed_start;
-			pool->free_ranges[i].count += count;
-			goto done;
+	// Recorded work may still bind them
+	for (uint32_t i = 0; i < dropped_count; i++) _skr_cmd_destroy_material_set(NULL, dropped[i]);
+	_skr_free(dropped);
+}
+
+void _skr_material_sets_release(VkDescriptorSet set) {
+	_skr_bind_pool_t* pool = &_skr_vk.bind_pool;
+	mtx_lock(&pool->mutex);
+	if (pool->set_pool != VK_NULL_HANDLE)
+		vkFreeDescriptorSets(_skr_vk.device, pool->set_pool, 1, &set);
+	mtx_unlock(&pool->mutex);
+}
+
+VkDescriptorType _skr_material_dynamic_type(uint32_t binding, VkDescriptorType type) {
+	if (type == VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER && (
+		binding == SKR_BIND_SHIFT_BUFFER + _skr_vk.bind_settings.material_slot ||
+		binding == SKR_BIND_SHIFT_BUFFER + _skr_vk.bind_settings.system_slot))
+		return VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC;
+	if (type == VK_DESCRIPTOR_TYPE_STORAGE_BUFFER &&
+		binding == SKR_BIND_SHIFT_TEXTURE + _skr_vk.bind_settings.instance_slot)
+		return VK_DESCRIPTOR_TYPE_STORAGE_BUFFER_DYNAMIC;
+	return type;
+}
+
+static uint64_t _skr_material_set_hash(uint64_t hash, const void* data, size_t size) {
+	const uint8_t* bytes = (const uint8_t*)data;
+	for (size_t i = 0; i < size; i++) {
+		hash ^= bytes[i];
+		hash *= 1099511628211ULL;
+	}
+	return hash;
+}
+
+static _skr_material_set_write_t _skr_material_set_write(const VkWriteDescriptorSet* write) {
+	_skr_material_set_write_t result = { .binding = write->dstBinding, .type = write->descriptorType };
+	if (write->pBufferInfo) {
+		result.handle = (uint64_t)write->pBufferInfo->buffer;
+		result.offset = write->pBufferInfo->offset;
+		result.range  = write->pBufferInfo->range;
+	}
+	if (write->pImageInfo) {
+		result.handle  = (uint64_t)write->pImageInfo->imageView;
+		result.sampler = (uint64_t)write->pImageInfo->sampler;
+		result.layout  = write->pImageInfo->imageLayout;
+	}
+	return result;
+}
+
+static bool _skr_material_set_matches(const _skr_material_set_entry_t* entry, VkDescriptorSetLayout layout, const VkWriteDescriptorSet* writes, uint32_t write_count) {
+	if (entry->layout != layout || entry->write_count != write_count) return false;
+	for (uint32_t i = 0; i < write_count; i++) {
+		_skr_material_set_write_t a = _skr_material_set_write(&writes[i]);
+		_skr_material_set_write_t b = entry->writes[i];
+		if (a.handle  != b.handle  || a.sampler != b.sampler || a.offset != b.offset || a.range  != b.range ||
+		    a.binding != b.binding || a.type    != b.type    || a.layout != b.layout) return false;
+	}
+	return true;
+}
+
+// Caller holds the bind pool lock
+static _skr_material_sets_t* _skr_material_sets_get(_skr_bind_pool_t* pool, int32_t bind_start) {
+	uint32_t capacity = pool->chunk_count << SKR_BIND_POOL_CHUNK_SHIFT;
+	if (bind_start < 0 || (uint32_t)bind_start >= capacity) return NULL;
+
+	if ((uint32_t)bind_start >= pool->set_capacity) {
+		_skr_material_sets_t** new_sets = _skr_realloc(pool->sets, capacity * sizeof(_skr_material_sets_t*));
+		if (!new_sets) return NULL;
+		memset(&new_sets[pool->set_capacity], 0, (capacity - pool->set_capacity) * sizeof(_skr_material_sets_t*));
+		pool->sets         = new_sets;
+		pool->set_capacity = capacity;
+	}
+	if (pool->sets[bind_start] == NULL)
+		pool->sets[bind_start] = _skr_calloc(1, sizeof(_skr_material_sets_t));
+	return pool->sets[bind_start];
+}
+
+void _skr_bind_material_descriptors(VkCommandBuffer cmd, VkDescriptorPool pool, VkPipelineBindPoint bind_point, int32_t pipeline_material_idx, int32_t bind_start, VkWriteDescriptorSet* writes, uint32_t write_count) {
+	VkPipelineLayout      layout      = _skr_pipeline_get_layout           (pipeline_material_idx);
+	VkDescriptorSetLayout desc_layout = _skr_pipeline_get_descriptor_layout(pipeline_material_idx);
+
+	if (_skr_vk.has_push_descriptors) {
+		_skr_bind_descriptors(cmd, pool, bind_point, layout, desc_layout, writes, write_count);
+		return;
+	}
+	if (write_count == 0 || desc_layout == VK_NULL_HANDLE) return;
+
+	// Pull per-draw offsets out of the writes. Bindings the layout expects
+	// but nobody wrote still need an offset, so they stay at zero.
+	uint32_t dyn_bindings[SKR_MAX_DYNAMIC_BINDINGS];
+	uint32_t dyn_offsets [SKR_MAX_DYNAMIC_BINDINGS] = {0};
+	uint32_t dyn_count = _skr_pipeline_get_dynamic_bindings(pipeline_material_idx, dyn_bindings);
+
+	uint64_t key = _skr_material_set_hash(14695981039346656037ULL, &desc_layout, sizeof(desc_layout));
+	for (uint32_t i = 0; i < write_count; i++) {
+		VkWriteDescriptorSet* write = &writes[i];
+		VkDescriptorType      type  = _skr_material_dynamic_type(write->dstBinding, write->descriptorType);
+		if (type != write->descriptorType) {
+			// The infos belong to the caller's scratch arrays, so it's safe
+			// to rebase them here.
+			VkDescriptorBufferInfo* info = (VkDescriptorBufferInfo*)write->pBufferInfo;
+			for (uint32_t d = 0; d < dyn_count; d++) {
+				if (dyn_bindings[d] == write->dstBinding) dyn_offsets[d] = (uint32_t)info->offset;
+			}
+			info->offset          = 0;
+			write->descriptorType = type;
+			// Instance ranges change with every batch size, and would churn the
+			// cache. Dynamic storage buffers measure VK_WHOLE_SIZE from the
+			// dynamic offset, so the range can stay out of the key.
+			if (type == VK_DESCRIPTOR_TYPE_STORAGE_BUFFER_DYNAMIC) info->range = VK_WHOLE_SIZE;
+		}
+
+		key = _skr_material_set_hash(key, &write->dstBinding,     sizeof(write->dstBinding));
+		key = _skr_material_set_hash(key, &write->descriptorType, sizeof(write->descriptorType));
+		if (write->pBufferInfo) key = _skr_material_set_hash(key, write->pBufferInfo, sizeof(VkDescriptorBufferInfo));
+		if (write->pImageInfo ) {  // Hashed by field, the struct has tail padding
+			key = _skr_material_set_hash(key, &write->pImageInfo->sampler,     sizeof(VkSampler));
+			key = _skr_material_set_hash(key, &write->pImageInfo->imageView,   sizeof(VkImageView));
+			key = _skr_material_set_hash(key, &write->pImageInfo->imageLayout, sizeof(VkImageLayout));
 		}
 	}
 
-	// No adjacent range found, add new range
-	if (pool->free_range_count >= pool->free_range_capacity) {
-		uint32_t new_capacity = pool->free_range_capacity * 2;
-		_skr_bind_range_t* new_ranges = _skr_realloc(pool->free_ranges, new_capacity * sizeof(_skr_bind_range_t));
-		if (!new_ranges) {
-			skr_log(skr_log_warning, "Failed to grow bind pool free range array during free");
-			goto done;  // Can't track this free space, but memory is cleared
+	VkDescriptorSet   set     = VK_NULL_HANDLE;
+	VkDescriptorSet   evicted = VK_NULL_HANDLE;
+	_skr_bind_pool_t* bp      = &_skr_vk.bind_pool;
+
+	mtx_lock(&bp->mutex);
+	_skr_material_sets_t* sets = bp->set_pool != VK_NULL_HANDLE
+		? _skr_material_sets_get(bp, bind_start)
+		: NULL;
+	if (sets) {
+		_skr_material_set_entry_t* oldest = &sets->entries[0];
+		for (uint32_t i = 0; i < SKR_MATERIAL_SET_CACHE; i++) {
+			_skr_material_set_entry_t* entry = &sets->entries[i];
+			if (entry->set != VK_NULL_HANDLE && entry->key == key && _skr_material_set_matches(entry, desc_layout, writes, write_count)) {
+				entry->last_use = ++bp->set_clock;
+				set = entry->set;
+				break;
+			}
+			if (entry->set == VK_NULL_HANDLE || (oldest->set != VK_NULL_HANDLE && entry->last_use < oldest->last_use))
+				oldest = entry;
+		}
+
+		// Miss, write a new set into the least recently used entry. This
+		// happens under the lock so nobody can bind it half-written. Without
+		// room to remember the writes, this draw goes through the ring pool.
+		_skr_material_set_write_t* recorded = set == VK_NULL_HANDLE
+			? _skr_malloc(write_count * sizeof(_skr_material_set_write_t))
+			: NULL;
+		if (recorded) {
+			VkResult vr = vkAllocateDescriptorSets(_skr_vk.device, &(VkDescriptorSetAllocateInfo){
+				.sType              = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO,
+				.descriptorPool     = bp->set_pool,
+				.descriptorSetCount = 1,
+				.pSetLayouts        = &desc_layout,
+			}, &set);
+			if (vr == VK_SUCCESS) {
+				for (uint32_t i = 0; i < write_count; i++) {
+					writes[i].dstSet = set;
+					recorded[i]      = _skr_material_set_write(&writes[i]);
+				}
+				vkUpdateDescriptorSets(_skr_vk.device, write_count, writes, 0, NULL);
+
+				evicted = oldest->set;
+				_skr_set_handles_track(bp, oldest, false);
+				_skr_free(oldest->writes);
+				*oldest = (_skr_material_set_entry_t){ .key = key, .set = set, .layout = desc_layout, .last_use = ++bp->set_clock, .write_count = write_count, .writes = recorded };
+				_skr_set_handles_track(bp, oldest, true);
+			} else {
+				set = VK_NULL_HANDLE;  // Pool is full, this draw goes through the ring pool
+				_skr_free(recorded);
+			}
 		}
-		pool->free_ranges         = new_ranges;
-		pool->free_range_capacity = new_capacity;
 	}
-	pool->free_ranges[pool->free_range_count++] = (_skr_bind_range_t){
-		.start = freed_start,
-		.count = count
-	};
+	mtx_unlock(&bp->mutex);
+
+	// The evicted set may still be referenced by in-flight work
+	if (evicted != VK_NULL_HANDLE) _skr_cmd_destroy_material_set(NULL, evicted);
+
+	if (set == VK_NULL_HANDLE) {
+		VkResult vr = vkAllocateDescriptorSets(_skr_vk.device, &(VkDescriptorSetAllocateInfo){
+			.sType              = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO,
+			.descriptorPool     = pool,
+			.descriptorSetCount = 1,
+			.pSetLayouts        = &desc_layout,
+		}, &set);
+		if (vr != VK_SUCCESS) return;
+		for (uint32_t i = 0; i < write_count; i++) writes[i].dstSet = set;
+		vkUpdateDescriptorSets(_skr_vk.device, write_count, writes, 0, NULL);
+	}
 
-done:
-	mtx_unlock(&pool->mutex);
+	vkCmdBindDescriptorSets(cmd, bind_point, layout, 0, 1, &set, dyn_count, dyn_offsets);
 }
 
-skr_material_bind_t* _skr_bind_pool_get(int32_t start) {
-	// NOTE: Caller should hold the pool lock via _skr_bind_pool_lock() if there's
-	// any chance of concurrent _skr_bind_pool_alloc() calls that might grow the pool.
-	if (start < 0 || (uint32_t)start >= _skr_vk.bind_pool.capacity) return NULL;
-	return &_skr_vk.bind_pool.binds[start];
-}
+///////////////////////////////////////////////////////////////////////////////
 
-void _skr_bind_pool_lock(void) {
+// Serial in the high bits keeps generations unique even when a new
+// material's param_buffer lands on a freed one's address
+static uint64_t _skr_material_first_generation(void) {
 	mtx_lock(&_skr_vk.bind_pool.mutex);
+	uint64_t result = (uint64_t)(++_skr_vk.bind_pool.material_serial) << 32;
+	mtx_unlock(&_skr_vk.bind_pool.mutex);
+	return result;
 }
 
-void _skr_bind_pool_unlock(void) {
-	mtx_unlock(&_skr_vk.bind_pool.mutex);
+// Sampler to bake into the layout for a texture bound to meta->resources[idx],
+// VK_NULL_HANDLE leaves it to the descriptor write
+static VkSampler _skr_material_immutable_sampler(const skr_material_t* material, int32_t idx, const skr_tex_t* texture) {
+	if (!texture) return VK_NULL_HANDLE;
+	if (texture->ycbcr_sampler != VK_NULL_HANDLE) return texture->ycbcr_sampler;
+	return material->immutable_samplers && material->key.shader->meta->resources[idx].bind.register_type == skr_register_texture
+		? texture->sampler
+		: VK_NULL_HANDLE;
 }
 
-///////////////////////////////////////////////////////////////////////////////
+// Updates the key's immutable sampler for one slot, keeping entries sorted by
+// slot for a deterministic memcmp. Returns true if the key changed. Samplers
+// that aren't required (non-YCbCr) are skipped quietly once the key is full,
+// the descriptor write still carries them.
+static bool _skr_material_key_set_sampler(_skr_pipeline_material_key_t* ref_key, int32_t slot, VkSampler sampler, bool required) {
+	int32_t found = -1;
+	for (int32_t i = 0; i < ref_key->immutable_sampler_count; i++) {
+		if (ref_key->immutable_sampler_slots[i] == slot) { found = i; break; }
+	}
+
+	if (sampler != VK_NULL_HANDLE) {
+		if (found >= 0) {
+			// Update existing entry
+			if (ref_key->immutable_samplers[found] == sampler) return false;
+			ref_key->immutable_samplers[found] = sampler;
+			return true;
+		}
+		if (ref_key->immutable_sampler_count >= SKR_MAX_IMMUTABLE_SAMPLERS) {
+			if (required) skr_log(skr_log_warning, "skr_material_set_tex: too many YCbCr textures (max %d)", SKR_MAX_IMMUTABLE_SAMPLERS);
+			return false;
+		}
+		// Insert new entry, keep sorted by slot
+		int32_t insert = ref_key->immutable_sampler_count;
+		for (int32_t i = 0; i < ref_key->immutable_sampler_count; i++) {
+			if (slot < ref_key->immutable_sampler_slots[i]) { insert = i; break; }
+		}
+		// Shift entries after insert point
+		for (int32_t i = ref_key->immutable_sampler_count; i > insert; i--) {
+			ref_key->immutable_samplers[i]      = ref_key->immutable_samplers[i - 1];
+			ref_key->immutable_sampler_slots[i] = ref_key->immutable_sampler_slots[i - 1];
+		}
+		ref_key->immutable_samplers[insert]      = sampler;
+		ref_key->immutable_sampler_slots[insert] = slot;
+		ref_key->immutable_sampler_count++;
+		return true;
+	}
+
+	if (found < 0) return false;
+
+	// Remove entry for this slot
+	for (int32_t i = found; i < ref_key->immutable_sampler_count - 1; i++) {
+		ref_key->immutable_samplers[i]      = ref_key->immutable_samplers[i + 1];
+		ref_key->immutable_sampler_slots[i] = ref_key->immutable_sampler_slots[i + 1];
+	}
+	ref_key->immutable_sampler_count--;
+	ref_key->immutable_samplers     [ref_key->immutable_sampler_count] = VK_NULL_HANDLE;
+	ref_key->immutable_sampler_slots[ref_key->immutable_sampler_count] = 0;
+	return true;
+}
 
 skr_err_ skr_material_create(skr_material_info_t info, skr_material_t* out_material) {
 	if (!out_material) return skr_err_invalid_parameter;
@@ -214,6 +619,10 @@ skr_err_ skr_material_create(skr_material_info_t info, skr_material_t* out_mater
 		skr_log(skr_log_warning, "Cannot create material with invalid shader");
 		return skr_err_invalid_parameter;
 	}
+	if (info.shader->bindless && !_skr_bindless_available()) {
+		skr_log(skr_log_warning, "Shader '%s' needs bindless, which isn't available", info.shader->meta ? info.shader->meta->name : "unknown");
+		return skr_err_unsupported;
+	}
 
 	// Store pipeline-affecting state in key, queue_offset separately
 	out_material->key = (_skr_pipeline_material_key_t){
@@ -227,10 +636,14 @@ skr_err_ skr_material_create(skr_material_info_t info, skr_material_t* out_mater
 		.stencil_front     = info.stencil_front,
 		.stencil_back      = info.stencil_back,
 	};
-	out_material->queue_offset = info.queue_offset;
+	out_material->queue_offset       = info.queue_offset;
+	out_material->immutable_samplers = info.immutable_samplers;
 
-	const sksc_shader_meta_t* meta = out_material->key.shader->meta;
-	sksc_shader_meta_reference(out_material->key.shader->meta);
+	// Released against this same meta, a reload may have given the shader
+	// a new one by then
+	out_material->meta = out_material->key.shader->meta;
+	sksc_shader_meta_reference(out_material->meta);
+	const sksc_shader_meta_t* meta = out_material->meta;
 
 	// Allocate material parameter buffer if shader has $Global buffer
 	if (meta->global_buffer_id >= 0) {
@@ -240,8 +653,8 @@ skr_err_ skr_material_create(skr_material_info_t info, skr_material_t* out_mater
 
 		if (!out_material->param_buffer) {
 			skr_log(skr_log_critical, "Failed to allocate material parameter buffer");
-			if (out_material->key.shader->meta) {
-				sksc_shader_meta_release(out_material->key.shader->meta);
+			if (out_material->meta) {
+				sksc_shader_meta_release(out_material->meta);
 			}
 			*out_material = (skr_material_t){0};
 			return skr_err_out_of_memory;
@@ -253,6 +666,8 @@ skr_err_ skr_material_create(skr_material_info_t info, skr_material_t* out_mater
 		} else {
 			memset(out_material->param_buffer, 0, out_material->param_buffer_size);
 		}
+
+		out_material->param_generation = _skr_material_first_generation();
 	}
 
 	// Allocate bindings from global pool
@@ -261,8 +676,8 @@ skr_err_ skr_material_create(skr_material_info_t info, skr_material_t* out_mater
 	if (out_material->bind_start < 0 && out_material->bind_count > 0) {
 		skr_log(skr_log_critical, "Failed to allocate material bindings from pool");
 		_skr_free(out_material->param_buffer);
-		if (out_material->key.shader->meta) {
-			sksc_shader_meta_release(out_material->key.shader->meta);
+		if (out_material->meta) {
+			sksc_shader_meta_release(out_material->meta);
 		}
 		*out_material = (skr_material_t){0};
 		return skr_err_out_of_memory;
@@ -289,6 +704,26 @@ skr_err_ skr_material_create(skr_material_info_t info, skr_material_t* out_mater
 		}
 	}
 
+	// A uint atlas_layer param can ride along in instance data, so draws that
+	// only differ by atlas layer still merge. See skr_render_list_add_indexed.
+	out_material->atlas_layer_offset = -1;
+	int32_t layer_var = out_material->instance_buffer_stride >= sizeof(uint32_t) ? sksc_shader_meta_get_var_index(meta, "atlas_layer") : -1;
+	const sksc_shader_var_t* layer_info = layer_var >= 0 ? sksc_shader_meta_get_var_info(meta, layer_var) : NULL;
+	if (layer_info && (layer_info->type == sksc_shader_var_uint || layer_info->type == sksc_shader_var_int) && layer_info->type_count == 1 &&
+	    layer_info->offset + sizeof(uint32_t) <= out_material->param_buffer_size && layer_info->offset < SKR_NO_ATLAS_LAYER)
+		out_material->atlas_layer_offset = (int32_t)layer_info->offset;
+
+	// Fill out default textures before registering, so their samplers are in
+	// the key and the first registration is the only one
+	for (uint32_t i = 0; i < meta->resource_count; i++) {
+		skr_tex_t* tex = &_skr_vk.default_tex_white;
+		if      (strcmp(meta->resources[i].value, "black") == 0) tex = &_skr_vk.default_tex_black;
+		else if (strcmp(meta->resources[i].value, "gray" ) == 0) tex = &_skr_vk.default_tex_gray;
+		else if (strcmp(meta->resources[i].value, "grey" ) == 0) tex = &_skr_vk.default_tex_gray;
+		binds[meta->buffer_count + i].texture = tex;
+		_skr_material_key_set_sampler(&out_material->key, meta->resources[i].bind.slot, _skr_material_immutable_sampler(out_material, (int32_t)i, tex), false);
+	}
+
 	// Register material with pipeline system
 	out_material->pipeline_material_idx = _skr_pipeline_register_material(&out_material->key);
 
@@ -296,22 +731,13 @@ skr_err_ skr_material_create(skr_material_info_t info, skr_material_t* out_mater
 		skr_log(skr_log_critical, "Failed to register material with pipeline system");
 		_skr_bind_pool_free(out_material->bind_start, out_material->bind_count);
 		_skr_free(out_material->param_buffer);
-		if (out_material->key.shader->meta) {
-			sksc_shader_meta_release(out_material->key.shader->meta);
+		if (out_material->meta) {
+			sksc_shader_meta_release(out_material->meta);
 		}
 		*out_material = (skr_material_t){0};
 		return skr_err_device_error;
 	}
 
-	// Fill out default textures
-	for (uint32_t i = 0; i < meta->resource_count; i++) {
-		skr_tex_t* tex = &_skr_vk.default_tex_white;
-		if      (strcmp(meta->resources[i].value, "black") == 0) tex = &_skr_vk.default_tex_black;
-		else if (strcmp(meta->resources[i].value, "gray" ) == 0) tex = &_skr_vk.default_tex_gray;
-		else if (strcmp(meta->resources[i].value, "grey" ) == 0) tex = &_skr_vk.default_tex_gray;
-		skr_material_set_tex(out_material, meta->resources[i].name, tex);
-	}
-
 	return skr_err_success;
 }
 
@@ -319,6 +745,41 @@ bool skr_material_is_valid(const skr_material_t* material) {
 	return material && material->pipeline_material_idx >= 0;
 }
 
+skr_err_ skr_material_create_variant(const skr_material_t* parent, skr_material_t* out_material) {
+	if (!out_material) return skr_err_invalid_parameter;
+
+	// Zero out immediately
+	*out_material = (skr_material_t){0};
+
+	if (!skr_material_is_valid(parent) || !parent->key.shader) {
+		skr_log(skr_log_warning, "Cannot create variant of an invalid material");
+		return skr_err_invalid_parameter;
+	}
+
+	// Params are small and change per variant, so those get copied now
+	void* param_buffer = NULL;
+	if (parent->param_buffer_size > 0) {
+		param_buffer = _skr_malloc(parent->param_buffer_size);
+		if (!param_buffer) {
+			skr_log(skr_log_critical, "Failed to allocate material parameter buffer");
+			return skr_err_out_of_memory;
+		}
+		memcpy(param_buffer, parent->param_buffer, parent->param_buffer_size);
+	}
+
+	// Same pipeline slot and bind range as the parent, without another key
+	// lookup or bind copy. Binds are copied once either side changes one.
+	*out_material = *parent;
+	out_material->param_buffer     = param_buffer;
+	out_material->param_generation = param_buffer ? _skr_material_first_generation() : 0;
+
+	sksc_shader_meta_reference(out_material->meta);
+	_skr_pipeline_ref_material(out_material->pipeline_material_idx);
+	_skr_bind_pool_ref        (out_material->bind_start);
+
+	return skr_err_success;
+}
+
 void skr_material_destroy(skr_material_t* ref_material) {
 	if (!ref_material || !ref_material->key.shader) return;
 
@@ -333,13 +794,75 @@ void skr_material_destroy(skr_material_t* ref_material) {
 	// Defer bind pool slot release until GPU is done with this material
 	_skr_cmd_destroy_bind_pool_slots(NULL, ref_material->bind_start, ref_material->bind_count);
 
-	if (ref_material->key.shader->meta) {
-		sksc_shader_meta_release(ref_material->key.shader->meta);
+	if (ref_material->meta) {
+		sksc_shader_meta_release(ref_material->meta);
 	}
 
 	*ref_material = (skr_material_t){0};
 }
 
+// Bindless shaders take resources as table indices in a uint param of the
+// same name. Returns NULL if the shader has no such param, callers write
+// through the result so the param generation is bumped here.
+static uint32_t* _skr_material_bindless_param(skr_material_t* ref_material, const char* name) {
+	if (!ref_material->key.shader->bindless || !ref_material->param_buffer) return NULL;
+
+	int32_t var_index = sksc_shader_meta_get_var_index(ref_material->key.shader->meta, name);
+	if (var_index < 0) return NULL;
+	const sksc_shader_var_t* var = sksc_shader_meta_get_var_info(ref_material->key.shader->meta, var_index);
+	if (!var || var->type != sksc_shader_var_uint || var->offset + sizeof(uint32_t) > ref_material->param_buffer_size) return NULL;
+
+	ref_material->param_generation++;
+	return (uint32_t*)((uint8_t*)ref_material->param_buffer + var->offset);
+}
+
+// Variants share a bind range with their parent until either side changes a
+// bind, which then gets a copy of its own. Returns NULL if that copy can't
+// be allocated.
+static skr_material_bind_t* _skr_material_own_binds(skr_material_t* ref_material) {
+	if (!_skr_bind_pool_shared(ref_material->bind_start)) return _skr_bind_pool_get(ref_material->bind_start);
+
+	int32_t start = _skr_bind_pool_alloc(ref_material->bind_count);
+	if (start < 0) {
+		skr_log(skr_log_warning, "Failed to allocate bindings for material variant");
+		return NULL;
+	}
+	skr_material_bind_t* binds = _skr_bind_pool_get(start);
+	memcpy(binds, _skr_bind_pool_get(ref_material->bind_start), ref_material->bind_count * sizeof(skr_material_bind_t));
+
+	// Render lists may still point at the shared range, so let go of it
+	// the same way a destroyed material does
+	_skr_cmd_destroy_bind_pool_slots(NULL, ref_material->bind_start, ref_material->bind_count);
+	ref_material->bind_start = start;
+	return binds;
+}
+
+static void _skr_material_set_bind_buffer(skr_material_t* ref_material, uint32_t bind_idx, skr_buffer_t* buffer) {
+	skr_material_bind_t* binds = _skr_material_own_binds(ref_material);
+	if (binds) binds[bind_idx].buffer = buffer;
+}
+
+// Binds a texture to meta->resources[idx], shared by the name and id setters
+static void _skr_material_set_tex_idx(skr_material_t* ref_material, int32_t idx, skr_tex_t* texture) {
+	const sksc_shader_meta_t *meta = ref_material->key.shader->meta;
+
+	skr_material_bind_t* binds = _skr_material_own_binds(ref_material);
+	if (!binds) return;
+	binds[meta->buffer_count + idx].texture = texture;
+
+	// YCbCr textures need their sampler baked into the descriptor set layout,
+	// and materials created with immutable_samplers bake every texture's.
+	VkSampler sampler = _skr_material_immutable_sampler(ref_material, idx, texture);
+	bool      ycbcr   = texture && texture->ycbcr_sampler != VK_NULL_HANDLE;
+
+	_skr_pipeline_material_key_t new_key = ref_material->key;
+	if (_skr_material_key_set_sampler(&new_key, meta->resources[idx].bind.slot, sampler, ycbcr)) {
+		_skr_pipeline_unregister_material(ref_material->pipeline_material_idx);
+		ref_material->key = new_key;
+		ref_material->pipeline_material_idx = _skr_pipeline_register_material(&ref_material->key);
+	}
+}
+
 void skr_material_set_tex(skr_material_t* ref_material, const char* name, skr_tex_t* texture) {
 	const sksc_shader_meta_t *meta = ref_material->key.shader->meta;
 
@@ -353,72 +876,13 @@ void skr_material_set_tex(skr_material_t* ref_material, const char* name, skr_te
 	}
 
 	if (idx == -1) {
-		skr_log(skr_log_warning, "Texture name '%s' not found", name);
+		uint32_t* index = _skr_material_bindless_param(ref_material, name);
+		if (index) *index = _skr_bindless_tex_index(texture);
+		else       skr_log(skr_log_warning, "Texture name '%s' not found", name);
 		return;
 	}
 
-	_skr_bind_pool_lock();
-	skr_material_bind_t* binds = _skr_bind_pool_get(ref_material->bind_start);
-	binds[meta->buffer_count + idx].texture = texture;
-	_skr_bind_pool_unlock();
-
-	// Auto-detect YCbCr immutable sampler: if the texture carries a ycbcr_sampler,
-	// bake it into the descriptor set layout for this binding slot. This is required
-	// by Vulkan for VkSamplerYcbcrConversion — the sampler must be specified at
-	// layout creation time, not at descriptor write time.
-	VkSampler new_ycbcr = texture ? texture->ycbcr_sampler : VK_NULL_HANDLE;
-	int32_t   slot      = meta->resources[idx].bind.slot;
-
-	// Build updated immutable sampler list: copy existing, update/add/remove for this slot
-	_skr_pipeline_material_key_t new_key = ref_material->key;
-	int32_t found = -1;
-	for (int32_t i = 0; i < new_key.immutable_sampler_count; i++) {
-		if (new_key.immutable_sampler_slots[i] == slot) { found = i; break; }
-	}
-
-	bool changed = false;
-	if (new_ycbcr != VK_NULL_HANDLE) {
-		if (found >= 0) {
-			// Update existing entry
-			if (new_key.immutable_samplers[found] != new_ycbcr) {
-				new_key.immutable_samplers[found] = new_ycbcr;
-				changed = true;
-			}
-		} else if (new_key.immutable_sampler_count < SKR_MAX_IMMUTABLE_SAMPLERS) {
-			// Insert new entry, keep sorted by slot
-			int32_t insert = new_key.immutable_sampler_count;
-			for (int32_t i = 0; i < new_key.immutable_sampler_count; i++) {
-				if (slot < new_key.immutable_sampler_slots[i]) { insert = i; break; }
-			}
-			// Shift entries after insert point
-			for (int32_t i = new_key.immutable_sampler_count; i > insert; i--) {
-				new_key.immutable_samplers[i]     = new_key.immutable_samplers[i - 1];
-				new_key.immutable_sampler_slots[i] = new_key.immutable_sampler_slots[i - 1];
-			}
-			new_key.immutable_samplers[insert]     = new_ycbcr;
-			new_key.immutable_sampler_slots[insert] = slot;
-			new_key.immutable_sampler_count++;
-			changed = true;
-		} else {
-			skr_log(skr_log_warning, "skr_material_set_tex: too many YCbCr textures (max %d)", SKR_MAX_IMMUTABLE_SAMPLERS);
-		}
-	} else if (found >= 0) {
-		// Remove entry for this slot
-		for (int32_t i = found; i < new_key.immutable_sampler_count - 1; i++) {
-			new_key.immutable_samplers[i]     = new_key.immutable_samplers[i + 1];
-			new_key.immutable_sampler_slots[i] = new_key.immutable_sampler_slots[i + 1];
-		}
-		new_key.immutable_sampler_count--;
-		new_key.immutable_samplers[new_key.immutable_sampler_count]     = VK_NULL_HANDLE;
-		new_key.immutable_sampler_slots[new_key.immutable_sampler_count] = 0;
-		changed = true;
-	}
-
-	if (changed) {
-		_skr_pipeline_unregister_material(ref_material->pipeline_material_idx);
-		ref_material->key = new_key;
-		ref_material->pipeline_material_idx = _skr_pipeline_register_material(&ref_material->key);
-	}
+	_skr_material_set_tex_idx(ref_material, idx, texture);
 }
 
 void skr_material_set_buffer(skr_material_t* ref_material, const char* name, skr_buffer_t* buffer) {
@@ -433,11 +897,8 @@ void skr_material_set_buffer(skr_material_t* ref_material, const char* name, skr
 		}
 	}
 
-	_skr_bind_pool_lock();
-	skr_material_bind_t* binds = _skr_bind_pool_get(ref_material->bind_start);
 	if (idx >= 0) {
-		binds[idx].buffer = buffer;
-		_skr_bind_pool_unlock();
+		_skr_material_set_bind_buffer(ref_material, idx, buffer);
 		return;
 	}
 
@@ -450,11 +911,13 @@ void skr_material_set_buffer(skr_material_t* ref_material, const char* name, skr
 	}
 
 	if (idx >= 0) {
-		binds[meta->buffer_count + idx].buffer = buffer;
-	} else {
-		skr_log(skr_log_warning, "Buffer name '%s' not found", name);
+		_skr_material_set_bind_buffer(ref_material, meta->buffer_count + idx, buffer);
+		return;
 	}
-	_skr_bind_pool_unlock();
+
+	uint32_t* index = _skr_material_bindless_param(ref_material, name);
+	if (index) *index = _skr_bindless_buffer_index(buffer);
+	else       skr_log(skr_log_warning, "Buffer name '%s' not found", name);
 }
 
 void skr_material_set_params(skr_material_t* ref_material, const void* data, uint32_t size) {
@@ -463,6 +926,7 @@ void skr_material_set_params(skr_material_t* ref_material, const void* data, uin
 		return;
 	}
 	memcpy(ref_material->param_buffer, data, size);
+	ref_material->param_generation++;
 }
 
 
@@ -511,6 +975,7 @@ void skr_material_set_param(skr_material_t* material, const char* name, sksc_sha
 	}
 
 	memcpy((uint8_t*)material->param_buffer + var->offset, data, copy_size);
+	material->param_generation++;
 }
 
 void skr_material_get_param(const skr_material_t* material, const char* name, sksc_shader_var_ type, uint32_t count, void* out_data) {
@@ -545,6 +1010,105 @@ void skr_material_get_param(const skr_material_t* material, const char* name, sk
 	memcpy(out_data, (uint8_t*)material->param_buffer + var->offset, copy_size);
 }
 
+///////////////////////////////////////////////////////////////////////////////
+// Precompiled id setters, no name hashing or meta searches
+///////////////////////////////////////////////////////////////////////////////
+
+static bool _skr_material_write_id(skr_material_t* ref_material, skr_param_id_t id, const void* data, uint32_t size) {
+	if (!ref_material->param_buffer || size == 0 || size > id.size || id.offset + size > ref_material->param_buffer_size) {
+		skr_log(skr_log_warning, "Material parameter id doesn't fit this material");
+		return false;
+	}
+	memcpy((uint8_t*)ref_material->param_buffer + id.offset, data, size);
+	return true;
+}
+
+static void _skr_material_set_typed_id(skr_material_t* ref_material, skr_param_id_t id, sksc_shader_var_ type, const void* data, uint32_t size) {
+	if (!ref_material) return;
+	if (id.type != type) {
+		skr_log(skr_log_warning, "Material parameter id type mismatch");
+		return;
+	}
+	if (_skr_material_write_id(ref_material, id, data, size))
+		ref_material->param_generation++;
+}
+
+void skr_material_set_tex_id(skr_material_t* ref_material, skr_param_id_t id, skr_tex_t* texture) {
+	if (!ref_material) return;
+	const sksc_shader_meta_t* meta = ref_material->key.shader->meta;
+
+	if (_skr_material_bind_is_tex(meta, id.bind_idx)) {
+		_skr_material_set_tex_idx(ref_material, id.bind_idx - (int32_t)meta->buffer_count, texture);
+	} else if (ref_material->key.shader->bindless && id.size > 0) {
+		uint32_t index = _skr_bindless_tex_index(texture);
+		_skr_material_set_typed_id(ref_material, id, sksc_shader_var_uint, &index, sizeof(index));
+	} else {
+		skr_log(skr_log_warning, "skr_material_set_tex_id: id isn't a texture");
+	}
+}
+
+void skr_material_set_buffer_id(skr_material_t* ref_material, skr_param_id_t id, skr_buffer_t* buffer) {
+	if (!ref_material) return;
+
+	if (_skr_material_bind_is_buffer(ref_material->key.shader->meta, id.bind_idx)) {
+		_skr_material_set_bind_buffer(ref_material, id.bind_idx, buffer);
+	} else if (ref_material->key.shader->bindless && id.size > 0) {
+		uint32_t index = _skr_bindless_buffer_index(buffer);
+		_skr_material_set_typed_id(ref_material, id, sksc_shader_var_uint, &index, sizeof(index));
+	} else {
+		skr_log(skr_log_warning, "skr_material_set_buffer_id: id isn't a buffer");
+	}
+}
+
+void skr_material_set_param_id(skr_material_t* ref_material, skr_param_id_t id, const void* data, uint32_t size) {
+	if (ref_material && _skr_material_write_id(ref_material, id, data, size))
+		ref_material->param_generation++;
+}
+
+void skr_material_set_float_id(skr_material_t* ref_material, skr_param_id_t id, float       value) { _skr_material_set_typed_id(ref_material, id, sksc_shader_var_float, &value, sizeof(value)); }
+void skr_material_set_vec2_id (skr_material_t* ref_material, skr_param_id_t id, skr_vec2_t  value) { _skr_material_set_typed_id(ref_material, id, sksc_shader_var_float, &value, sizeof(value)); }
+void skr_material_set_vec3_id (skr_material_t* ref_material, skr_param_id_t id, skr_vec3_t  value) { _skr_material_set_typed_id(ref_material, id, sksc_shader_var_float, &value, sizeof(value)); }
+void skr_material_set_vec4_id (skr_material_t* ref_material, skr_param_id_t id, skr_vec4_t  value) { _skr_material_set_typed_id(ref_material, id, sksc_shader_var_float, &value, sizeof(value)); }
+void skr_material_set_int_id  (skr_material_t* ref_material, skr_param_id_t id, int32_t     value) { _skr_material_set_typed_id(ref_material, id, sksc_shader_var_int,   &value, sizeof(value)); }
+void skr_material_set_uint_id (skr_material_t* ref_material, skr_param_id_t id, uint32_t    value) { _skr_material_set_typed_id(ref_material, id, sksc_shader_var_uint,  &value, sizeof(value)); }
+
+void skr_material_set_params_batch(skr_material_t* ref_material, const skr_param_write_t* writes, uint32_t count) {
+	if (!ref_material || !writes) return;
+
+	// Same checks as the single setters, one generation bump for the whole
+	// batch since render lists only see the result
+	bool written = false;
+	for (uint32_t i = 0; i < count; i++) {
+		const skr_param_write_t* write = &writes[i];
+		uint32_t                 elem  = _skr_shader_var_size((sksc_shader_var_)write->id.type);
+		if (write->type != sksc_shader_var_none && write->type != sksc_shader_var_uint8 && write->type != write->id.type) {
+			skr_log(skr_log_warning, "Material parameter id type mismatch");
+			continue;
+		}
+		if (write->type != sksc_shader_var_uint8 && elem > 0 && write->size % elem != 0) {
+			skr_log(skr_log_warning, "Material parameter write of %u bytes isn't whole elements", write->size);
+			continue;
+		}
+		written |= _skr_material_write_id(ref_material, write->id, write->data, write->size);
+	}
+	if (written) ref_material->param_generation++;
+}
+
+bool _skr_material_bind_is_tex(const sksc_shader_meta_t* meta, int32_t bind_idx) {
+	if (!meta || bind_idx < (int32_t)meta->buffer_count || bind_idx >= (int32_t)(meta->buffer_count + meta->resource_count)) return false;
+	uint8_t type = meta->resources[bind_idx - (int32_t)meta->buffer_count].bind.register_type;
+	return type == skr_register_texture || type == skr_register_readwrite_tex;
+}
+
+// cbuffers, and StructuredBuffers among the resources
+bool _skr_material_bind_is_buffer(const sksc_shader_meta_t* meta, int32_t bind_idx) {
+	if (!meta || bind_idx < 0) return false;
+	if (bind_idx < (int32_t)meta->buffer_count) return true;
+	if (bind_idx >= (int32_t)(meta->buffer_count + meta->resource_count)) return false;
+	uint8_t type = meta->resources[bind_idx - (int32_t)meta->buffer_count].bind.register_type;
+	return type == skr_register_read_buffer || type == skr_register_readwrite;
+}
+
 const char* _skr_material_bind_name(const sksc_shader_meta_t* meta, int32_t bind_idx) {
 	if (!meta || bind_idx < 0) return "unknown";
 	if ((uint32_t)bind_idx < meta->buffer_count) {
@@ -21,6 +21,8 @@ typedef struct {
 	_skr_pipeline_material_key_t     key;
 	VkPipelineLayout                 layout;
 	VkDescriptorSetLayout            descriptor_layout;
+	uint32_t                         dynamic_bindings[SKR_MAX_DYNAMIC_BINDINGS];  // Sorted, non-push-descriptor layouts only
+	uint32_t                         dynamic_count;
 	int32_t                          ref_count;
 } _skr_pipeline_material_slot_t;
 
@@ -60,7 +62,8 @@ static _skr_pipeline_cache_t _skr_pipeline_cache = {0};
 ///////////////////////////////////////////////////////////////////////////////
 
 static VkRenderPass     _skr_pipeline_create_renderpass(const skr_pipeline_renderpass_key_t* key);
-static VkPipelineLayout _skr_pipeline_create_layout    (VkDescriptorSetLayout descriptor_layout);
+static VkPipelineLayout _skr_pipeline_create_layout    (VkDescriptorSetLayout descriptor_layout, const skr_shader_t* shader);
+static uint32_t         _skr_pipeline_dynamic_bindings (const sksc_shader_meta_t* meta, uint32_t* out_bindings);
 static VkPipeline       _skr_pipeline_create           (int32_t material_idx, int32_t renderpass_idx, int32_t vertformat_idx);
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -219,7 +222,8 @@ int32_t _skr_pipeline_register_material(const _skr_pipeline_material_key_t* key)
 	// Register new material
 	_skr_pipeline_cache.materials[free_slot].key               = *key;
 	_skr_pipeline_cache.materials[free_slot].descriptor_layout = _skr_shader_make_layout    (_skr_vk.device, _skr_vk.has_push_descriptors, key->shader->meta, skr_stage_vertex | skr_stage_pixel | skr_stage_compute, key->immutable_samplers, key->immutable_sampler_slots, key->immutable_sampler_count);
-	_skr_pipeline_cache.materials[free_slot].layout            = _skr_pipeline_create_layout(_skr_pipeline_cache.materials[free_slot].descriptor_layout);
+	_skr_pipeline_cache.materials[free_slot].layout            = _skr_pipeline_create_layout(_skr_pipeline_cache.materials[free_slot].descriptor_layout, key->shader);
+	_skr_pipeline_cache.materials[free_slot].dynamic_count     = _skr_pipeline_dynamic_bindings(key->shader->meta, _skr_pipeline_cache.materials[free_slot].dynamic_bindings);
 	_skr_pipeline_cache.materials[free_slot].ref_count         = 1;
 
 	if (free_slot >= _skr_pipeline_cache.material_count) {
@@ -307,6 +311,13 @@ int32_t _skr_pipeline_register_renderpass(const skr_pipeline_renderpass_key_t* k
 	return result;
 }
 
+void _skr_pipeline_ref_material(int32_t material_idx) {
+	mtx_lock(&_skr_pipeline_cache.mutex);
+	if (material_idx >= 0 && material_idx < _skr_pipeline_cache.material_capacity && _skr_pipeline_cache.materials[material_idx].ref_count > 0)
+		_skr_pipeline_cache.materials[material_idx].ref_count++;
+	mtx_unlock(&_skr_pipeline_cache.mutex);
+}
+
 void _skr_pipeline_unregister_material(int32_t material_idx) {
 	mtx_lock(&_skr_pipeline_cache.mutex);
 
@@ -332,6 +343,23 @@ void _skr_pipeline_unregister_material(int32_t material_idx) {
 	mtx_unlock(&_skr_pipeline_cache.mutex);
 }
 
+// Unlocked version - caller must hold the mutex via _skr_pipeline_lock()
+// Only the cells built from this shader's modules go, layouts survive since
+// a reload can't change the shader's interface.
+void _skr_pipeline_invalidate_shader_unlocked(const skr_shader_t* shader) {
+	for (int32_t m = 0; m < _skr_pipeline_cache.material_capacity; m++) {
+		if (_skr_pipeline_cache.materials[m].ref_count <= 0 || _skr_pipeline_cache.materials[m].key.shader != shader) continue;
+
+		for (int32_t r = 0; r < _skr_pipeline_cache.renderpass_capacity; r++) {
+			for (int32_t v = 0; v < _skr_pipeline_cache.vertformat_capacity; v++) {
+				int32_t idx = _skr_pipeline_index_3d(m, r, v, _skr_pipeline_cache.renderpass_capacity, _skr_pipeline_cache.vertformat_capacity);
+				_skr_cmd_destroy_pipeline(NULL, _skr_pipeline_cache.pipelines[idx]);
+				_skr_pipeline_cache.pipelines[idx] = VK_NULL_HANDLE;
+			}
+		}
+	}
+}
+
 void _skr_pipeline_unregister_renderpass(int32_t renderpass_idx) {
 	mtx_lock(&_skr_pipeline_cache.mutex);
 
@@ -482,6 +510,29 @@ VkPipelineLayout _skr_pipeline_get_layout(int32_t material_idx) {
 	return _skr_pipeline_cache.materials[material_idx].layout;
 }
 
+bool _skr_pipeline_is_bindless(int32_t material_idx) {
+	if (material_idx < 0 || material_idx >= _skr_pipeline_cache.material_capacity) return false;
+	if (_skr_pipeline_cache.materials[material_idx].ref_count <= 0)                return false;
+
+	return _skr_pipeline_cache.materials[material_idx].key.shader->bindless;
+}
+
+uint32_t _skr_pipeline_get_dynamic_bindings(int32_t material_idx, uint32_t* out_bindings) {
+	if (material_idx < 0 || material_idx >= _skr_pipeline_cache.material_capacity) return 0;
+	if (_skr_pipeline_cache.materials[material_idx].ref_count <= 0)                return 0;
+
+	const _skr_pipeline_material_slot_t* slot = &_skr_pipeline_cache.materials[material_idx];
+	memcpy(out_bindings, slot->dynamic_bindings, slot->dynamic_count * sizeof(uint32_t));
+	return slot->dynamic_count;
+}
+
+VkShaderStageFlags _skr_pipeline_get_push_stages(int32_t material_idx) {
+	if (material_idx < 0 || material_idx >= _skr_pipeline_cache.material_capacity) return 0;
+	if (_skr_pipeline_cache.materials[material_idx].ref_count <= 0)                return 0;
+
+	return _skr_pipeline_cache.materials[material_idx].key.shader->push_range.stageFlags;
+}
+
 VkDescriptorSetLayout _skr_pipeline_get_descriptor_layout(int32_t material_idx) {
 	if (material_idx < 0 || material_idx >= _skr_pipeline_cache.material_capacity) return VK_NULL_HANDLE;
 	if (_skr_pipeline_cache.materials[material_idx].ref_count <= 0)                return VK_NULL_HANDLE;
@@ -517,7 +568,8 @@ static VkRenderPass _skr_pipeline_create_renderpass(const skr_pipeline_renderpas
 			.storeOp        = use_msaa ? VK_ATTACHMENT_STORE_OP_DONT_CARE : VK_ATTACHMENT_STORE_OP_STORE,
 			.stencilLoadOp  = VK_ATTACHMENT_LOAD_OP_DONT_CARE,
 			.stencilStoreOp = VK_ATTACHMENT_STORE_OP_DONT_CARE,
-			.initialLayout  = VK_IMAGE_LAYOUT_UNDEFINED,
+			// UNDEFINED discards, so only use it when the old contents aren't wanted
+			.initialLayout  = key->color_load_op == VK_ATTACHMENT_LOAD_OP_LOAD ? VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL : VK_IMAGE_LAYOUT_UNDEFINED,
 			.finalLayout    = VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL,
 		};
 
@@ -553,10 +605,10 @@ static VkRenderPass _skr_pipeline_create_renderpass(const skr_pipeline_renderpas
 		attachments[attachment_count] = (VkAttachmentDescription){
 			.format         = key->depth_format,
 			.samples        = key->samples,
-			.loadOp         = VK_ATTACHMENT_LOAD_OP_CLEAR,
+			.loadOp         = key->depth_load_op,
 			.storeOp        = key->depth_store_op,  // Use the store op from the key (based on readable flag)
-			.stencilLoadOp  = has_stencil ? VK_ATTACHMENT_LOAD_OP_CLEAR : VK_ATTACHMENT_LOAD_OP_DONT_CARE,
-			.stencilStoreOp = has_stencil ? VK_ATTACHMENT_STORE_OP_STORE : VK_ATTACHMENT_STORE_OP_DONT_CARE,
+			.stencilLoadOp  = has_stencil ? key->depth_load_op  : VK_ATTACHMENT_LOAD_OP_DONT_CARE,
+			.stencilStoreOp = has_stencil ? key->depth_store_op : VK_ATTACHMENT_STORE_OP_DONT_CARE,
 			.initialLayout  = VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL,  // Expect already transitioned
 			.finalLayout    = VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL,
 		};
@@ -618,11 +670,45 @@ static VkRenderPass _skr_pipeline_create_renderpass(const skr_pipeline_renderpas
 	return render_pass;
 }
 
-static VkPipelineLayout _skr_pipeline_create_layout(VkDescriptorSetLayout descriptor_layout) {
+// Mirrors the dynamic types _skr_shader_make_layout picks, in binding order,
+// since that's the order vkCmdBindDescriptorSets consumes dynamic offsets in.
+static uint32_t _skr_pipeline_dynamic_bindings(const sksc_shader_meta_t* meta, uint32_t* out_bindings) {
+	if (_skr_vk.has_push_descriptors || meta == NULL) return 0;
+
+	uint32_t count = 0;
+	for (uint32_t i = 0; i < meta->buffer_count + meta->resource_count; i++) {
+		skr_bind_t bind = i < meta->buffer_count
+			? meta->buffers  [i].bind
+			: meta->resources[i - meta->buffer_count].bind;
+		if (bind.stage_bits == 0) continue;
+
+		VkDescriptorType type =
+			bind.register_type == skr_register_constant    ? VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER :
+			bind.register_type == skr_register_read_buffer ? VK_DESCRIPTOR_TYPE_STORAGE_BUFFER :
+			                                                 VK_DESCRIPTOR_TYPE_MAX_ENUM;
+		if (type == VK_DESCRIPTOR_TYPE_MAX_ENUM || _skr_material_dynamic_type(bind.slot, type) == type) continue;
+		if (count >= SKR_MAX_DYNAMIC_BINDINGS) break;
+
+		uint32_t at = count++;
+		while (at > 0 && out_bindings[at-1] > bind.slot) {
+			out_bindings[at] = out_bindings[at-1];
+			at--;
+		}
+		out_bindings[at] = bind.slot;
+	}
+	return count;
+}
+
+static VkPipelineLayout _skr_pipeline_create_layout(VkDescriptorSetLayout descriptor_layout, const skr_shader_t* shader) {
+	// Bindless shaders add the global tables as a second set
+	if (shader->bindless) return _skr_bindless_create_layout(descriptor_layout, shader->push_range);
+
 	VkPipelineLayoutCreateInfo layout_info = {
-		.sType          = VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO,
-		.setLayoutCount = descriptor_layout != VK_NULL_HANDLE ? 1 : 0,
-		.pSetLayouts    = descriptor_layout != VK_NULL_HANDLE ? &descriptor_layout : NULL,
+		.sType                  = VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO,
+		.setLayoutCount         = descriptor_layout != VK_NULL_HANDLE ? 1 : 0,
+		.pSetLayouts            = descriptor_layout != VK_NULL_HANDLE ? &descriptor_layout : NULL,
+		.pushConstantRangeCount = shader->push_range.size > 0 ? 1 : 0,
+		.pPushConstantRanges    = shader->push_range.size > 0 ? &shader->push_range : NULL,
 	};
 
 	VkPipelineLayout layout;
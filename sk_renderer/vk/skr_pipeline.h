@@ -35,6 +35,7 @@ void                  _skr_pipeline_shutdown             (void);
 int32_t               _skr_pipeline_register_material    (const _skr_pipeline_material_key_t*  key);
 int32_t               _skr_pipeline_register_renderpass  (const skr_pipeline_renderpass_key_t* key);
 int32_t               _skr_pipeline_register_vertformat  (const skr_vert_type_t                vert_type);
+void                  _skr_pipeline_ref_material         (int32_t material_idx  );  // Another reference to a registered material, no key lookup
 void                  _skr_pipeline_unregister_material  (int32_t material_idx  );
 void                  _skr_pipeline_unregister_renderpass(int32_t renderpass_idx);
 void                  _skr_pipeline_unregister_vertformat(int32_t vertformat_idx);
@@ -42,6 +43,7 @@ void                  _skr_pipeline_unregister_vertformat(int32_t vertformat_idx
 // Unlocked versions - caller MUST hold the pipeline lock via _skr_pipeline_lock()
 int32_t               _skr_pipeline_register_renderpass_unlocked (const skr_pipeline_renderpass_key_t* key);
 int32_t               _skr_pipeline_register_vertformat_unlocked (const skr_vert_type_t                vert_type);
+void                  _skr_pipeline_invalidate_shader_unlocked   (const skr_shader_t*                  shader);  // Drops the shader's pipelines, they rebuild on next use
 
 // Get or create pipeline for a material/renderpass/vertformat triplet
 // NOTE: These get functions do NOT lock internally for performance. The caller
@@ -51,6 +53,9 @@ int32_t               _skr_pipeline_register_vertformat_unlocked (const skr_vert
 VkPipeline            _skr_pipeline_get                  (int32_t material_idx, int32_t renderpass_idx, int32_t vertformat_idx);
 VkPipelineLayout      _skr_pipeline_get_layout           (int32_t material_idx  );
 VkDescriptorSetLayout _skr_pipeline_get_descriptor_layout(int32_t material_idx  );
+bool                  _skr_pipeline_is_bindless          (int32_t material_idx  );  // Layout has the bindless tables at set SKSC_BINDLESS_SPACE
+VkShaderStageFlags    _skr_pipeline_get_push_stages      (int32_t material_idx  );  // Stages the param push constants reach, 0 if params are a UBO
+uint32_t              _skr_pipeline_get_dynamic_bindings (int32_t material_idx, uint32_t* out_bindings);  // Writes up to SKR_MAX_DYNAMIC_BINDINGS, returns count
 VkRenderPass          _skr_pipeline_get_renderpass       (int32_t renderpass_idx);
 
 // Thread safety: Lock the pipeline cache for a region of operations.
@@ -56,7 +56,44 @@ void skr_render_list_clear(skr_render_list_t* ref_list) {
 	ref_list->count = 0;
 	ref_list->instance_data_used = 0;
 	ref_list->material_data_used = 0;
+	ref_list->material_data_ubo  = false;
 	ref_list->needs_sort = false;
+	memset(ref_list->param_dedup, 0, sizeof(ref_list->param_dedup));
+}
+
+static uint64_t _skr_render_hash(uint64_t hash, const void* data, size_t size) {
+	const uint8_t* bytes = (const uint8_t*)data;
+	for (size_t i = 0; i < size; i++) {
+		hash ^= bytes[i];
+		hash *= 1099511628211ULL;
+	}
+	return hash;
+}
+
+// An atlas_layer param is left out, since it can travel in instance data
+// instead. skr_renderer_draw still compares it when it doesn't.
+static uint32_t _skr_render_param_hash(const skr_material_t* material) {
+	const uint8_t* params = (const uint8_t*)material->param_buffer;
+	if (material->atlas_layer_offset < 0)
+		return (uint32_t)_skr_render_hash(14695981039346656037ULL, params, material->param_buffer_size);
+
+	uint32_t after = (uint32_t)material->atlas_layer_offset + sizeof(uint32_t);
+	uint64_t hash  = _skr_render_hash(14695981039346656037ULL, params, (size_t)material->atlas_layer_offset);
+	return (uint32_t)_skr_render_hash(hash, params + after, material->param_buffer_size - after);
+}
+
+// Hashes what a draw binds rather than which material it came from, so
+// materials with the same resources and params (all sampling one texture
+// atlas, or variants that share binds) sort next to each other and merge
+// into one instanced draw. skr_renderer_draw compares the real contents.
+static uint32_t _skr_render_batch_hash(const skr_material_t* material, uint32_t param_hash) {
+	uint64_t                   hash  = 14695981039346656037ULL ^ param_hash;
+	const skr_material_bind_t* binds = material->bind_count > 0 ? _skr_bind_pool_get(material->bind_start) : NULL;
+	for (uint32_t i = 0; binds && i < material->bind_count; i++) {
+		uint64_t fields[] = { (uint64_t)(uintptr_t)binds[i].texture, binds[i].buffer_offset, binds[i].buffer_range };
+		hash = _skr_render_hash(hash, fields, sizeof(fields));
+	}
+	return (uint32_t)(hash ^ (hash >> 32));
 }
 
 // Sort key layout (64 bits, ascending sort):
@@ -112,16 +149,32 @@ void skr_render_list_add_indexed(skr_render_list_t* ref_list, skr_mesh_t* mesh,
 	item->pipeline_material_idx  = (uint16_t)material->pipeline_material_idx;
 	item->param_buffer_size      = (uint16_t)material->param_buffer_size;
 	item->has_system_buffer      = material->has_system_buffer ? 1 : 0;
+	item->push_params            = material->key.shader->push_range.size > 0 ? 1 : 0;
 	item->instance_buffer_stride = (uint16_t)material->instance_buffer_stride;
 	item->bind_start             = material->bind_start;
 	item->bind_count             = (uint8_t)material->bind_count;
 
 	// Copy material param_buffer data (so material can be destroyed after add)
-	// Align offset for uniform buffer access (minUniformBufferOffsetAlignment)
-	uint32_t ubo_align          = _skr_vk.min_ubo_offset_align;
+	// Align offset for uniform buffer access (minUniformBufferOffsetAlignment),
+	// push constants are read straight from here and only need 4 bytes
+	uint32_t ubo_align          = item->push_params ? 4 : _skr_vk.min_ubo_offset_align;
 	uint32_t aligned_mat_offset = (ref_list->material_data_used + ubo_align - 1) & ~(ubo_align - 1);
 	item->param_data_offset     = aligned_mat_offset;
+
+	// Items whose material params haven't changed since an earlier add share
+	// that add's copy, so each unique block is only copied and uploaded once
+	_skr_param_dedup_t* dedup      = NULL;
+	uint32_t            param_hash = 0;
 	if (material->param_buffer && material->param_buffer_size > 0) {
+		uint64_t hash = (((uint64_t)(uintptr_t)material->param_buffer >> 4) ^ material->param_generation) * 1099511628211ULL;
+		dedup = &ref_list->param_dedup[(hash >> 32) % SKR_PARAM_DEDUP_SLOTS];
+		if (dedup->params == material->param_buffer && dedup->generation == material->param_generation) {
+			item->param_data_offset = dedup->offset;
+			param_hash              = dedup->hash;
+			dedup                   = NULL;
+		}
+	}
+	if (dedup) {
 		uint32_t needed = aligned_mat_offset + material->param_buffer_size;
 		// Resize material data if needed
 		while (needed > ref_list->material_data_capacity) {
@@ -136,23 +189,41 @@ void skr_render_list_add_indexed(skr_render_list_t* ref_list, skr_mesh_t* mesh,
 		}
 		memcpy(&ref_list->material_data[aligned_mat_offset], material->param_buffer, material->param_buffer_size);
 		ref_list->material_data_used = aligned_mat_offset + material->param_buffer_size;
+		if (!item->push_params) ref_list->material_data_ubo = true;
+
+		param_hash = _skr_render_param_hash(material);
+		*dedup = (_skr_param_dedup_t){
+			.params     = material->param_buffer,
+			.generation = material->param_generation,
+			.offset     = aligned_mat_offset,
+			.hash       = param_hash,
+		};
 	}
+	item->batch_hash = _skr_render_batch_hash(material, param_hash);
 
 	// Render item data
 	// Align instance offset for storage buffer access (minStorageBufferOffsetAlignment)
 	uint32_t ssbo_align          = _skr_vk.min_ssbo_offset_align;
 	uint32_t aligned_inst_offset = (ref_list->instance_data_used + ssbo_align - 1) & ~(ssbo_align - 1);
 	item->sort_key               = _skr_render_sort_key(material, item->vertex_buffers[0]);
+
+	// When the shader's instance struct is one uint longer than the data
+	// given, that trailing uint gets the material's atlas_layer param. The
+	// layer is then per instance, and no longer keeps materials apart.
+	bool     route_layer = material->atlas_layer_offset >= 0 && material->instance_buffer_stride == single_instance_data_size + sizeof(uint32_t);
+	uint32_t inst_stride = route_layer ? material->instance_buffer_stride : single_instance_data_size;
+
 	item->instance_offset        = aligned_inst_offset;
-	item->instance_data_size     = (uint16_t)single_instance_data_size;
+	item->instance_data_size     = (uint16_t)inst_stride;
 	item->instance_count         = instance_count;
 	item->first_index            = first_index;
 	item->index_count            = index_count;
 	item->vertex_offset          = vertex_offset;
+	item->atlas_layer_offset     = route_layer ? (uint16_t)material->atlas_layer_offset : SKR_NO_ATLAS_LAYER;
 
 	// Copy instance data if provided
-	uint32_t total_size = single_instance_data_size * instance_count;
-	if (opt_instance_data && total_size > 0) {
+	uint32_t total_size = inst_stride * instance_count;
+	if ((opt_instance_data || route_layer) && total_size > 0) {
 		uint32_t needed = aligned_inst_offset + total_size;
 		// Resize instance data if needed
 		while (needed > ref_list->instance_data_capacity) {
@@ -165,7 +236,18 @@ void skr_render_list_add_indexed(skr_render_list_t* ref_list, skr_mesh_t* mesh,
 			ref_list->instance_data          = new_data;
 			ref_list->instance_data_capacity = new_capacity;
 		}
-		memcpy(&ref_list->instance_data[aligned_inst_offset], opt_instance_data, total_size);
+		if (route_layer) {
+			uint32_t layer;
+			memcpy(&layer, (const uint8_t*)material->param_buffer + material->atlas_layer_offset, sizeof(layer));
+			uint8_t* dst = &ref_list->instance_data[aligned_inst_offset];
+			for (uint32_t i = 0; i < instance_count; i++, dst += inst_stride) {
+				if (opt_instance_data) memcpy(dst, (const uint8_t*)opt_instance_data + i * single_instance_data_size, single_instance_data_size);
+				else                   memset(dst, 0, single_instance_data_size);
+				memcpy(dst + single_instance_data_size, &layer, sizeof(layer));
+			}
+		} else {
+			memcpy(&ref_list->instance_data[aligned_inst_offset], opt_instance_data, total_size);
+		}
 		ref_list->instance_data_used = aligned_inst_offset + total_size;
 	}
 
@@ -196,6 +278,10 @@ static int _skr_render_item_compare(const void* a, const void* b) {
 	if (item_a->vertex_offset < item_b->vertex_offset) return -1;
 	if (item_a->vertex_offset > item_b->vertex_offset) return  1;
 
+	// Last: keep items that can merge across materials together
+	if (item_a->batch_hash < item_b->batch_hash) return -1;
+	if (item_a->batch_hash > item_b->batch_hash) return  1;
+
 	return 0;
 }
 
@@ -77,15 +77,14 @@ static VkFramebuffer _skr_get_or_create_framebuffer(VkDevice device, skr_tex_t*
 void _skr_tex_transition_enqueue(skr_tex_t* ref_tex, uint8_t type) {
 	if (!ref_tex || !ref_tex->image) return;
 
-	// Check if already queued (avoid duplicates)
-	for (uint32_t i = 0; i < _skr_vk.pending_transition_count; i++) {
-		if (_skr_vk.pending_transitions[i] == ref_tex) {
-			// Update type if needed (storage takes priority over shader_read)
-			if (type > _skr_vk.pending_transition_types[i]) {
-				_skr_vk.pending_transition_types[i] = type;
-			}
-			return;
+	// Already queued? The texture knows its own queue slot, so no scan
+	if (ref_tex->pending_transition != 0) {
+		// Update type if needed (storage takes priority over shader_read)
+		uint32_t i = ref_tex->pending_transition - 1;
+		if (type > _skr_vk.pending_transition_types[i]) {
+			_skr_vk.pending_transition_types[i] = type;
 		}
+		return;
 	}
 
 	// Grow array if needed
@@ -100,13 +99,18 @@ void _skr_tex_transition_enqueue(skr_tex_t* ref_tex, uint8_t type) {
 	_skr_vk.pending_transitions     [_skr_vk.pending_transition_count] = ref_tex;
 	_skr_vk.pending_transition_types[_skr_vk.pending_transition_count] = type;
 	_skr_vk.pending_transition_count++;
+	ref_tex->pending_transition = _skr_vk.pending_transition_count;
 }
 
-// Flush all pending texture transitions (called before render pass begins)
+// Flush all pending texture transitions (called before render pass begins).
+// These only add to the command buffer's barrier batch, which goes out as one
+// barrier right before vkCmdBeginRenderPass.
 static void _skr_flush_texture_transitions(VkCommandBuffer cmd) {
 	for (uint32_t i = 0; i < _skr_vk.pending_transition_count; i++) {
 		skr_tex_t* tex  = _skr_vk.pending_transitions[i];
 		uint8_t    type = _skr_vk.pending_transition_types[i];
+		if (!tex) continue; // Destroyed while queued
+		tex->pending_transition = 0;
 
 		if (type == 1) {  // storage
 			_skr_tex_transition_for_storage(cmd, tex);
@@ -123,16 +127,59 @@ static void _skr_flush_texture_transitions(VkCommandBuffer cmd) {
 // Rendering
 ///////////////////////////////////////////////////////////////////////////////
 
+// Records when a frame's GPU work was seen finishing, and feeds the latency
+// prediction
+static void _skr_frame_complete(uint32_t flight, uint64_t now_ns) {
+	_skr_vk.gpu_complete_ns[flight] = now_ns;
+
+	uint64_t latency = now_ns > _skr_vk.cpu_frame_start_ns[flight] ? now_ns - _skr_vk.cpu_frame_start_ns[flight] : 0;
+	_skr_vk.predicted_latency_ns = _skr_vk.predicted_latency_ns == 0
+		? latency
+		: (_skr_vk.predicted_latency_ns * 7 + latency) / 8;
+}
+
+// Non-blocking check on a frame still in flight
+static void _skr_frame_poll(uint32_t flight) {
+	if (_skr_vk.gpu_complete_ns[flight] != 0 || !_skr_vk.frame_futures[flight].timeline) return;
+	if (skr_future_check(&_skr_vk.frame_futures[flight]))
+		_skr_frame_complete(flight, _skr_time_get_ns());
+}
+
+void skr_renderer_frame_wait() {
+	if (_skr_vk.frame_waited || _skr_vk.in_frame) return;
+	_skr_vk.frame_waited = true;
+
+	// Low latency keeps a single frame in flight by the time input is
+	// sampled, otherwise the CPU may be frames_in_flight ahead
+	uint32_t back = _skr_vk.low_latency ? 1 : _skr_vk.frames_in_flight;
+	if (_skr_vk.frame >= back) {
+		uint32_t flight = (_skr_vk.frame - back) % SKR_MAX_FRAMES_IN_FLIGHT;
+		if (_skr_vk.gpu_complete_ns[flight] == 0 && _skr_vk.frame_futures[flight].timeline) {
+			skr_future_wait(&_skr_vk.frame_futures[flight]);
+			_skr_frame_complete(flight, _skr_time_get_ns());
+		}
+	}
+	for (uint32_t i = 0; i < SKR_MAX_FRAMES_IN_FLIGHT; i++)
+		_skr_frame_poll(i);
+}
+
 void skr_renderer_frame_begin() {
+	skr_renderer_frame_wait();
 	_skr_vk.in_frame = true;
 
+	// The last frame to use this slot's bindless set is done by now
+	skr_future_wait(&_skr_vk.frame_futures[_skr_vk.flight_idx]);
+	_skr_bindless_frame_begin(_skr_vk.flight_idx);
+
 	// Start a command buffer batch for this frame
-	// NOTE: This may block waiting for an old frame's fence if all ring slots are in use
+	// NOTE: This may block waiting on the timeline for an old frame if all ring slots are in use
 	VkCommandBuffer cmd = _skr_cmd_begin().cmd;
 
 	// Record CPU start time AFTER acquiring command buffer (excludes pipeline stall wait)
 	_skr_vk.cpu_frame_start_ns[_skr_vk.flight_idx] = _skr_time_get_ns();
 	_skr_vk.cpu_frame_wait_ns [_skr_vk.flight_idx] = 0;  // Reset wait time accumulator
+	_skr_vk.gpu_complete_ns   [_skr_vk.flight_idx] = 0;
+	_skr_vk.frame_futures     [_skr_vk.flight_idx] = (skr_future_t){0};
 
 	// Reset and write start timestamp
 	uint32_t query_start = _skr_vk.flight_idx * SKR_QUERIES_PER_FRAME;
@@ -183,6 +230,7 @@ void skr_renderer_frame_end(skr_surface_t** opt_surfaces, uint32_t count) {
 	for (uint32_t i = 0; i < count; i++) {
 		opt_surfaces[i]->frame_future[opt_surfaces[i]->frame_idx] = future;
 	}
+	_skr_vk.frame_futures[_skr_vk.flight_idx] = future;
 
 	// Read timestamps from N-frames-ago (triple buffering delay)
 	if (_skr_vk.frame >= SKR_MAX_FRAMES_IN_FLIGHT) {
@@ -200,12 +248,24 @@ void skr_renderer_frame_end(skr_surface_t** opt_surfaces, uint32_t count) {
 		_skr_vk.cpu_timestamps_valid[prev_flight] = true;
 	}
 
-	_skr_vk.in_frame = false;
+	_skr_vk.in_frame     = false;
+	_skr_vk.frame_waited = false;
 	_skr_vk.frame++;
 	_skr_vk.flight_idx = _skr_vk.frame % SKR_MAX_FRAMES_IN_FLIGHT;
 }
 
 void skr_renderer_begin_pass(skr_tex_t* color, skr_tex_t* depth, skr_tex_t* opt_resolve, skr_clear_ clear, skr_vec4_t clear_color, float clear_depth, uint32_t clear_stencil) {
+	// Cleared attachments don't need their old contents, and transient ones
+	// (MSAA color, non-readable depth) never had any worth loading or storing.
+	bool color_discard = color && color->is_transient_discard;
+	bool depth_discard = depth && depth->is_transient_discard;
+	_skr_renderer_begin_pass(color, depth, opt_resolve, clear, clear_color, clear_depth, clear_stencil,
+		(clear & skr_clear_color)                       ? VK_ATTACHMENT_LOAD_OP_CLEAR : color_discard ? VK_ATTACHMENT_LOAD_OP_DONT_CARE : VK_ATTACHMENT_LOAD_OP_LOAD,
+		(clear & (skr_clear_depth | skr_clear_stencil)) ? VK_ATTACHMENT_LOAD_OP_CLEAR : depth_discard ? VK_ATTACHMENT_LOAD_OP_DONT_CARE : VK_ATTACHMENT_LOAD_OP_LOAD,
+		depth_discard ? VK_ATTACHMENT_STORE_OP_DONT_CARE : VK_ATTACHMENT_STORE_OP_STORE);
+}
+
+void _skr_renderer_begin_pass(skr_tex_t* color, skr_tex_t* depth, skr_tex_t* opt_resolve, skr_clear_ clear, skr_vec4_t clear_color, float clear_depth, uint32_t clear_stencil, VkAttachmentLoadOp color_load_op, VkAttachmentLoadOp depth_load_op, VkAttachmentStoreOp depth_store_op) {
 	// Require at least one attachment (color or depth)
 	if (!color && !depth) return;
 
@@ -226,8 +286,9 @@ void skr_renderer_begin_pass(skr_tex_t* color, skr_tex_t* depth, skr_tex_t* opt_
 		.depth_format    = depth                                           ? skr_tex_fmt_to_native(depth->format)         : VK_FORMAT_UNDEFINED,
 		.resolve_format  = (opt_resolve && color && color->samples > VK_SAMPLE_COUNT_1_BIT) ? skr_tex_fmt_to_native(opt_resolve->format) : VK_FORMAT_UNDEFINED,
 		.samples         = color ? color->samples : (depth ? depth->samples : VK_SAMPLE_COUNT_1_BIT),
-		.depth_store_op  = (depth && (depth->flags & skr_tex_flags_readable)) ? VK_ATTACHMENT_STORE_OP_STORE : VK_ATTACHMENT_STORE_OP_DONT_CARE,
-		.color_load_op   = (clear & skr_clear_color) ? VK_ATTACHMENT_LOAD_OP_CLEAR : VK_ATTACHMENT_LOAD_OP_LOAD,
+		.depth_store_op  = depth ? depth_store_op : VK_ATTACHMENT_STORE_OP_DONT_CARE,
+		.color_load_op   = color ? color_load_op  : VK_ATTACHMENT_LOAD_OP_DONT_CARE,
+		.depth_load_op   = depth ? depth_load_op  : VK_ATTACHMENT_LOAD_OP_DONT_CARE,
 	};
 	_skr_vk.current_renderpass_idx = _skr_pipeline_register_renderpass_unlocked(&rp_key);
 
@@ -260,8 +321,15 @@ void skr_renderer_begin_pass(skr_tex_t* color, skr_tex_t* depth, skr_tex_t* opt_
 			VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT | VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_READ_BIT);
 	}
 
-	// Note: Color attachments use render pass implicit transitions (initialLayout/finalLayout)
-	// We'll notify the system after vkCmdBeginRenderPass about the layout change
+	// Color attachments that don't load use the render pass's implicit
+	// transition from UNDEFINED. Loading needs the real layout, or the
+	// contents are lost.
+	if (color && rp_key.color_load_op == VK_ATTACHMENT_LOAD_OP_LOAD) {
+		_skr_tex_transition(cmd, color,
+			VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL,
+			VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT,
+			VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT | VK_ACCESS_COLOR_ATTACHMENT_READ_BIT);
+	}
 
 	// Setup clear values
 	// Need to match attachment count: [color], [resolve], [depth]
@@ -291,7 +359,10 @@ void skr_renderer_begin_pass(skr_tex_t* color, skr_tex_t* depth, skr_tex_t* opt_
 	uint32_t render_width  = color ? color->size.x : (depth ? depth->size.x : 0);
 	uint32_t render_height = color ? color->size.y : (depth ? depth->size.y : 0);
 
-	// Begin render pass
+	// Begin render pass, barriers can't be recorded inside it. Draws don't
+	// track their bindings, so resolve every pending compute write here.
+	_skr_hazard_resolve_all(cmd);
+	_skr_barrier_flush(cmd);
 	vkCmdBeginRenderPass(cmd, &(VkRenderPassBeginInfo){
 		.sType           = VK_STRUCTURE_TYPE_RENDER_PASS_BEGIN_INFO,
 		.renderPass      = render_pass,
@@ -325,12 +396,16 @@ void skr_renderer_begin_pass(skr_tex_t* color, skr_tex_t* depth, skr_tex_t* opt_
 }
 
 void skr_renderer_end_pass() {
+	_skr_renderer_end_pass(true);
+}
+
+void _skr_renderer_end_pass(bool to_shader_read) {
 	VkCommandBuffer cmd = _skr_cmd_acquire().cmd;
 	vkCmdEndRenderPass(cmd);
 
 	// Transition readable color attachments to shader-read layout for next use
 	// Automatic system handles this - tracks that color is currently in COLOR_ATTACHMENT_OPTIMAL
-	if (_skr_vk.current_color_texture && (_skr_vk.current_color_texture->flags & skr_tex_flags_readable)) {
+	if (to_shader_read && _skr_vk.current_color_texture && (_skr_vk.current_color_texture->flags & skr_tex_flags_readable)) {
 		_skr_tex_transition_for_shader_read(cmd, _skr_vk.current_color_texture,
 			VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT | VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT);
 	}
@@ -338,7 +413,7 @@ void skr_renderer_end_pass() {
 	// Transition readable depth texture to shader-read layout for next use (e.g., shadow maps)
 	// Automatic system handles this - tracks that depth is currently in DEPTH_STENCIL_ATTACHMENT_OPTIMAL
 	// NOTE: MSAA depth textures don't have SAMPLED_BIT and can't be transitioned to SHADER_READ_ONLY
-	if (_skr_vk.current_depth_texture && (_skr_vk.current_depth_texture->flags & skr_tex_flags_readable)) {
+	if (to_shader_read && _skr_vk.current_depth_texture && (_skr_vk.current_depth_texture->flags & skr_tex_flags_readable)) {
 		// Only transition to shader-read if not MSAA depth (MSAA depth doesn't have SAMPLED_BIT)
 		bool is_msaa_depth = _skr_vk.current_depth_texture->samples > VK_SAMPLE_COUNT_1_BIT &&
 		                     (_skr_vk.current_depth_texture->aspect_mask & VK_IMAGE_ASPECT_DEPTH_BIT);
@@ -438,6 +513,7 @@ void skr_renderer_blit(skr_material_t* material, skr_tex_t* to, skr_recti_t boun
 		.samples        = to->samples,
 		.depth_store_op = VK_ATTACHMENT_STORE_OP_DONT_CARE,  // No depth in blit
 		.color_load_op  = is_full_blit ? VK_ATTACHMENT_LOAD_OP_DONT_CARE : VK_ATTACHMENT_LOAD_OP_LOAD,
+		.depth_load_op  = VK_ATTACHMENT_LOAD_OP_DONT_CARE,
 	};
 	int32_t renderpass_idx = _skr_pipeline_register_renderpass_unlocked(&rp_key);
 	int32_t vert_idx       = _skr_pipeline_register_vertformat_unlocked((skr_vert_type_t){0});
@@ -460,7 +536,7 @@ void skr_renderer_blit(skr_material_t* material, skr_tex_t* to, skr_recti_t boun
 	uint32_t image_ct  = 0;
 
 	skr_bump_result_t param_bump = {0};
-	if (material->param_buffer_size > 0) {
+	if (material->param_buffer_size > 0 && material->key.shader->push_range.size == 0) {
 		param_bump = _skr_bump_alloc_write(ctx.const_bump, material->param_buffer, material->param_buffer_size);
 		if (param_bump.buffer) {
 			buffer_infos[buffer_ct] = (VkDescriptorBufferInfo){
@@ -482,7 +558,6 @@ void skr_renderer_blit(skr_material_t* material, skr_tex_t* to, skr_recti_t boun
 	const sksc_shader_meta_t* meta = material->key.shader->meta;
 	const int32_t ignore_slots[] = { SKR_BIND_SHIFT_BUFFER + _skr_vk.bind_settings.material_slot };
 
-	_skr_bind_pool_lock();
 	skr_material_bind_t* mat_binds = _skr_bind_pool_get(material->bind_start);
 	int32_t fail_idx = _skr_material_add_writes(mat_binds, material->bind_count, ignore_slots, sizeof(ignore_slots)/sizeof(ignore_slots[0]),
 		writes,       sizeof(writes      )/sizeof(writes      [0]),
@@ -490,7 +565,6 @@ void skr_renderer_blit(skr_material_t* material, skr_tex_t* to, skr_recti_t boun
 		image_infos,  sizeof(image_infos )/sizeof(image_infos [0]),
 		&write_ct, &buffer_ct, &image_ct);
 	if (fail_idx >= 0) {
-		_skr_bind_pool_unlock();
 		_skr_pipeline_unlock();
 		skr_log(skr_log_critical, "Blit missing binding '%s' in shader '%s'", _skr_material_bind_name(meta, fail_idx), meta->name);
 		return;
@@ -502,12 +576,11 @@ void skr_renderer_blit(skr_material_t* material, skr_tex_t* to, skr_recti_t boun
 		if (res->texture)
 			_skr_tex_transition_for_shader_read(ctx.cmd, res->texture, VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT);
 	}
-	_skr_bind_pool_unlock();
 
 	// Transition target texture to color attachment layout
 	_skr_tex_transition(ctx.cmd, to, VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL,
 		VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT,
-		VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT);
+		VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT | (is_full_blit ? 0 : VK_ACCESS_COLOR_ATTACHMENT_READ_BIT));
 
 	// Create framebuffer - layered for cubemaps/arrays, cached for 2D
 	VkFramebuffer framebuffer   = VK_NULL_HANDLE;
@@ -570,6 +643,8 @@ void skr_renderer_blit(skr_material_t* material, skr_tex_t* to, skr_recti_t boun
 	}
 
 	// Common rendering path for all texture types
+	_skr_hazard_resolve_all(ctx.cmd);
+	_skr_barrier_flush(ctx.cmd);
 	vkCmdBeginRenderPass(ctx.cmd, &(VkRenderPassBeginInfo){
 		.sType       = VK_STRUCTURE_TYPE_RENDER_PASS_BEGIN_INFO,
 		.renderPass  = render_pass,
@@ -580,13 +655,16 @@ void skr_renderer_blit(skr_material_t* material, skr_tex_t* to, skr_recti_t boun
 	VkPipeline pipeline = _skr_pipeline_get(material->pipeline_material_idx, renderpass_idx, vert_idx);
 	if (pipeline != VK_NULL_HANDLE) {
 		vkCmdBindPipeline(ctx.cmd, VK_PIPELINE_BIND_POINT_GRAPHICS, pipeline);
+		if (_skr_pipeline_is_bindless(material->pipeline_material_idx))
+			_skr_bindless_bind(ctx.cmd, VK_PIPELINE_BIND_POINT_GRAPHICS, _skr_pipeline_get_layout(material->pipeline_material_idx));
+		if (material->param_buffer_size > 0 && material->key.shader->push_range.size > 0)
+			vkCmdPushConstants(ctx.cmd, _skr_pipeline_get_layout(material->pipeline_material_idx), material->key.shader->push_range.stageFlags, 0, material->param_buffer_size, material->param_buffer);
 		vkCmdSetViewport (ctx.cmd, 0, 1, &(VkViewport){(float)bounds_px.x, (float)bounds_px.y, (float)width, (float)height, 0.0f, 1.0f});
 		vkCmdSetScissor  (ctx.cmd, 0, 1, &(VkRect2D  ){{bounds_px.x, bounds_px.y}, {width, height}});
 
-		_skr_bind_descriptors(ctx.cmd, ctx.descriptor_pool, VK_PIPELINE_BIND_POINT_GRAPHICS,
-		                      _skr_pipeline_get_layout(material->pipeline_material_idx),
-		                      _skr_pipeline_get_descriptor_layout(material->pipeline_material_idx),
-		                      writes, write_ct);
+		_skr_bind_material_descriptors(ctx.cmd, ctx.descriptor_pool, VK_PIPELINE_BIND_POINT_GRAPHICS,
+		                               material->pipeline_material_idx, material->bind_start,
+		                               writes, write_ct);
 
 		// Draw fullscreen triangle - instanced for cubemaps/arrays, single for 2D
 		vkCmdDraw(ctx.cmd, 3, draw_instances, 0, 0);
@@ -609,6 +687,38 @@ void skr_renderer_blit(skr_material_t* material, skr_tex_t* to, skr_recti_t boun
 	_skr_pipeline_unlock();
 }
 
+// Param blocks match, leaving out an atlas layer that moved into instance data
+static bool _skr_render_params_equal(const skr_render_list_t* list, const skr_render_item_t* a, const skr_render_item_t* b) {
+	const uint8_t* params_a = &list->material_data[a->param_data_offset];
+	const uint8_t* params_b = &list->material_data[b->param_data_offset];
+	if (a->atlas_layer_offset == SKR_NO_ATLAS_LAYER) return memcmp(params_a, params_b, a->param_buffer_size) == 0;
+
+	uint32_t after = a->atlas_layer_offset + sizeof(uint32_t);
+	return memcmp(params_a,         params_b,         a->atlas_layer_offset)          == 0 &&
+	       memcmp(params_a + after, params_b + after, a->param_buffer_size - after) == 0;
+}
+
+// Items from different materials still share a draw when they bind the same
+// resources and carry the same params, like materials packed into one
+// texture atlas. The pipeline was already compared, so the layouts match.
+static bool _skr_render_items_share_material(const skr_render_list_t* list, const skr_render_item_t* a, const skr_render_item_t* b) {
+	if (a->batch_hash != b->batch_hash || a->bind_count != b->bind_count || a->atlas_layer_offset != b->atlas_layer_offset) return false;
+	if (a->param_data_offset != b->param_data_offset && !_skr_render_params_equal(list, a, b)) return false;
+	if (a->bind_start == b->bind_start || a->bind_count == 0) return true;
+
+	const skr_material_bind_t* binds_a = _skr_bind_pool_get(a->bind_start);
+	const skr_material_bind_t* binds_b = _skr_bind_pool_get(b->bind_start);
+	if (!binds_a || !binds_b) return false;
+	for (uint32_t i = 0; i < a->bind_count; i++) {
+		// texture and buffer share storage, one compare covers both
+		if (binds_a[i].texture       != binds_b[i].texture       ||
+		    binds_a[i].buffer_offset != binds_b[i].buffer_offset ||
+		    binds_a[i].buffer_range  != binds_b[i].buffer_range)
+			return false;
+	}
+	return true;
+}
+
 void skr_renderer_draw(skr_render_list_t* list, const void* system_data, uint32_t system_data_size, int32_t instance_multiplier) {
 	if (!list || list->count == 0) return;
 	instance_multiplier = (instance_multiplier < 1) ? 1 : instance_multiplier;
@@ -617,7 +727,8 @@ void skr_renderer_draw(skr_render_list_t* list, const void* system_data, uint32_
 	VkCommandBuffer cmd = ctx.cmd;
 
 	_skr_render_list_sort(list);
-	// Material param data is already copied at add-time into list->material_data
+	// Material param data is already copied at add-time into list->material_data,
+	// one block per unique material param state
 
 	// Upload data to bump allocators from command context
 	skr_bump_result_t system_bump   = {0};
@@ -627,7 +738,7 @@ void skr_renderer_draw(skr_render_list_t* list, const void* system_data, uint32_
 	if (system_data && system_data_size > 0) {
 		system_bump = _skr_bump_alloc_write(ctx.const_bump, system_data, system_data_size);
 	}
-	if (list->material_data_used > 0) {
+	if (list->material_data_used > 0 && list->material_data_ubo) {
 		material_bump = _skr_bump_alloc_write(ctx.const_bump, list->material_data, list->material_data_used);
 	}
 	if (list->instance_data_used > 0) {
@@ -653,10 +764,10 @@ void skr_renderer_draw(skr_render_list_t* list, const void* system_data, uint32_
 			// Can only batch if mesh, material, AND draw parameters all match
 			if (next->vertex_buffers[0]      != item->vertex_buffers[0]      ||
 			    next->pipeline_material_idx  != item->pipeline_material_idx  ||
-			    next->bind_start             != item->bind_start             ||
 			    next->first_index            != item->first_index            ||
 			    next->index_count            != item->index_count            ||
-			    next->vertex_offset          != item->vertex_offset)
+			    next->vertex_offset          != item->vertex_offset          ||
+			    !_skr_render_items_share_material(list, item, next))
 				break;
 			total_instances += next->instance_count;
 			total_inst_data += next->instance_data_size * next->instance_count;
@@ -667,6 +778,9 @@ void skr_renderer_draw(skr_render_list_t* list, const void* system_data, uint32_
 		if (pipeline != bound_pipeline) {
 			vkCmdBindPipeline(cmd, VK_PIPELINE_BIND_POINT_GRAPHICS, pipeline);
 			bound_pipeline = pipeline;
+			// Each material has its own set 0 layout, which disturbs set 1
+			if (_skr_pipeline_is_bindless(item->pipeline_material_idx))
+				_skr_bindless_bind(cmd, VK_PIPELINE_BIND_POINT_GRAPHICS, _skr_pipeline_get_layout(item->pipeline_material_idx));
 		}
 
 		// Build per-draw descriptor writes
@@ -678,7 +792,10 @@ void skr_renderer_draw(skr_render_list_t* list, const void* system_data, uint32_
 		uint32_t image_ct  = 0;
 
 		// Material parameter buffer (using inlined param_buffer_size and param_data_offset)
-		if (item->param_buffer_size > 0 && material_bump.buffer) {
+		if (item->param_buffer_size > 0 && item->push_params) {
+			vkCmdPushConstants(cmd, _skr_pipeline_get_layout(item->pipeline_material_idx), _skr_pipeline_get_push_stages(item->pipeline_material_idx),
+			                   0, item->param_buffer_size, &list->material_data[item->param_data_offset]);
+		} else if (item->param_buffer_size > 0 && material_bump.buffer) {
 			buffer_infos[buffer_ct] = (VkDescriptorBufferInfo){
 				.buffer = material_bump.buffer->buffer,
 				.offset = material_bump.offset + item->param_data_offset,
@@ -734,8 +851,8 @@ void skr_renderer_draw(skr_render_list_t* list, const void* system_data, uint32_
 			SKR_BIND_SHIFT_BUFFER  + _skr_vk.bind_settings.material_slot,
 			SKR_BIND_SHIFT_BUFFER  + _skr_vk.bind_settings.system_slot };
 
-		// Material texture and buffer binds (using inlined bind_start/bind_count)
-		_skr_bind_pool_lock();
+		// Material texture and buffer binds (using inlined bind_start/bind_count),
+		// bind pool chunks are stable so this doesn't need the pool lock
 		const skr_material_bind_t* binds = _skr_bind_pool_get(item->bind_start);
 		int32_t fail_idx = _skr_material_add_writes(binds, item->bind_count, ignore_slots, sizeof(ignore_slots)/sizeof(ignore_slots[0]),
 			writes,       sizeof(writes      )/sizeof(writes      [0]),
@@ -757,17 +874,14 @@ void skr_renderer_draw(skr_render_list_t* list, const void* system_data, uint32_
 			default:                         reg_char = '?'; reg_num = slot;                          break;
 			}
 			skr_log(skr_log_critical, "Draw call missing binding for register(%c%d)", reg_char, reg_num);
-			_skr_bind_pool_unlock();
 			i += batch_count;
 			continue;
 		}
-		_skr_bind_pool_unlock();
 
 		// Push all descriptors at once (using inlined pipeline_material_idx)
-		_skr_bind_descriptors(cmd, ctx.descriptor_pool, VK_PIPELINE_BIND_POINT_GRAPHICS,
-		                      _skr_pipeline_get_layout(item->pipeline_material_idx),
-		                      _skr_pipeline_get_descriptor_layout(item->pipeline_material_idx),
-		                      writes, write_ct);
+		_skr_bind_material_descriptors(cmd, ctx.descriptor_pool, VK_PIPELINE_BIND_POINT_GRAPHICS,
+		                               item->pipeline_material_idx, item->bind_start,
+		                               writes, write_ct);
 
 		// Bind vertex buffers (using inlined VkBuffer handles)
 		if (item->vertex_buffer_count > 0) {
@@ -818,6 +932,10 @@ void skr_renderer_draw_mesh_immediate(skr_mesh_t* mesh, skr_material_t* material
 
 	// Bind pipeline
 	vkCmdBindPipeline(cmd, VK_PIPELINE_BIND_POINT_GRAPHICS, pipeline);
+	if (_skr_pipeline_is_bindless(material->pipeline_material_idx))
+		_skr_bindless_bind(cmd, VK_PIPELINE_BIND_POINT_GRAPHICS, _skr_pipeline_get_layout(material->pipeline_material_idx));
+	if (material->param_buffer_size > 0 && material->key.shader->push_range.size > 0)
+		vkCmdPushConstants(cmd, _skr_pipeline_get_layout(material->pipeline_material_idx), material->key.shader->push_range.stageFlags, 0, material->param_buffer_size, material->param_buffer);
 
 	// Build descriptor writes
 	VkWriteDescriptorSet   writes      [32];
@@ -829,7 +947,7 @@ void skr_renderer_draw_mesh_immediate(skr_mesh_t* mesh, skr_material_t* material
 
 	// Upload material parameters to bump allocator if needed
 	skr_bump_result_t material_bump = {0};
-	if (material->param_buffer_size > 0) {
+	if (material->param_buffer_size > 0 && material->key.shader->push_range.size == 0) {
 		material_bump = _skr_bump_alloc_write(ctx.const_bump, material->param_buffer, material->param_buffer_size);
 		if (material_bump.buffer) {
 			buffer_infos[buffer_ct] = (VkDescriptorBufferInfo){
@@ -856,13 +974,11 @@ void skr_renderer_draw_mesh_immediate(skr_mesh_t* mesh, skr_material_t* material
 	// Add material texture and buffer bindings
 	const sksc_shader_meta_t* meta = material->key.shader->meta;
 
-	_skr_bind_pool_lock();
 	int32_t fail_idx = _skr_material_add_writes(_skr_bind_pool_get(material->bind_start), material->bind_count, ignore_slots, sizeof(ignore_slots)/sizeof(ignore_slots[0]),
 		writes,       sizeof(writes      )/sizeof(writes      [0]),
 		buffer_infos, sizeof(buffer_infos)/sizeof(buffer_infos[0]),
 		image_infos,  sizeof(image_infos )/sizeof(image_infos [0]),
 		&write_ct, &buffer_ct, &image_ct);
-	_skr_bind_pool_unlock();
 
 	if (fail_idx >= 0) {
 		skr_log(skr_log_critical, "Immediate draw missing binding '%s' in shader '%s'", _skr_material_bind_name(meta, fail_idx), meta->name);
@@ -871,10 +987,9 @@ void skr_renderer_draw_mesh_immediate(skr_mesh_t* mesh, skr_material_t* material
 	}
 
 	// Bind descriptors
-	_skr_bind_descriptors(cmd, ctx.descriptor_pool, VK_PIPELINE_BIND_POINT_GRAPHICS,
-	                      _skr_pipeline_get_layout(material->pipeline_material_idx),
-	                      _skr_pipeline_get_descriptor_layout(material->pipeline_material_idx),
-	                      writes, write_ct);
+	_skr_bind_material_descriptors(cmd, ctx.descriptor_pool, VK_PIPELINE_BIND_POINT_GRAPHICS,
+	                               material->pipeline_material_idx, material->bind_start,
+	                               writes, write_ct);
 
 	// Bind vertex buffers
 	if (mesh->vertex_buffer_count > 0) {
@@ -948,3 +1063,47 @@ float skr_renderer_get_cpu_time_ms() {
 	// Convert nanoseconds to milliseconds, subtracting wait time
 	return (float)(total - wait) / 1000000.0f;
 }
+
+bool skr_renderer_get_frame_timing(skr_frame_timing_t* out_timing) {
+	*out_timing = (skr_frame_timing_t){0};
+
+	// The current frame's slot is the oldest, so stop short of it
+	for (uint32_t back = 1; back < SKR_MAX_FRAMES_IN_FLIGHT && back <= _skr_vk.frame; back++) {
+		uint32_t frame  = _skr_vk.frame - back;
+		uint32_t flight = frame % SKR_MAX_FRAMES_IN_FLIGHT;
+		_skr_frame_poll(flight);
+		if (_skr_vk.gpu_complete_ns[flight] == 0) continue;
+
+		// The frame is done, so its queries are too
+		uint64_t timestamps[SKR_QUERIES_PER_FRAME];
+		VkResult vr = vkGetQueryPoolResults(_skr_vk.device, _skr_vk.timestamp_pool, flight * SKR_QUERIES_PER_FRAME, SKR_QUERIES_PER_FRAME,
+			sizeof(timestamps), timestamps, sizeof(uint64_t), VK_QUERY_RESULT_64_BIT);
+
+		*out_timing = (skr_frame_timing_t){
+			.frame                = frame,
+			.cpu_begin_ns         = _skr_vk.cpu_frame_start_ns[flight],
+			.cpu_submit_ns        = _skr_vk.cpu_frame_end_ns  [flight],
+			.gpu_complete_ns      = _skr_vk.gpu_complete_ns   [flight],
+			.gpu_ms               = vr == VK_SUCCESS ? (float)(timestamps[1] - timestamps[0]) * _skr_vk.timestamp_period / 1000000.0f : 0.0f,
+			.predicted_latency_ns = _skr_vk.predicted_latency_ns,
+		};
+		return true;
+	}
+	return false;
+}
+
+void skr_renderer_set_frames_in_flight(uint32_t count) {
+	if (count < 1 || count > SKR_MAX_FRAMES_IN_FLIGHT) {
+		skr_log(skr_log_warning, "Frames in flight must be 1-%d, got %u", SKR_MAX_FRAMES_IN_FLIGHT, count);
+		count = count < 1 ? 1 : SKR_MAX_FRAMES_IN_FLIGHT;
+	}
+	_skr_vk.frames_in_flight = count;
+}
+
+uint32_t skr_renderer_get_frames_in_flight() {
+	return _skr_vk.frames_in_flight;
+}
+
+void skr_renderer_set_low_latency(bool enable) {
+	_skr_vk.low_latency = enable;
+}
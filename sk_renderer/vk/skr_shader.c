@@ -4,6 +4,7 @@
 // Copyright (c) 2025 Qualcomm Technologies, Inc.
 
 #include "_sk_renderer.h"
+#include "skr_pipeline.h"
 
 #include <stdio.h>
 #include <stdlib.h>
@@ -59,6 +60,17 @@ skr_shader_t _skr_shader_create_manual(sksc_shader_meta_t* meta, skr_shader_stag
 
 	if (meta) {
 		sksc_shader_meta_reference(meta);
+		shader.bindless = meta->bindless;
+
+		// A push constant block takes the place of $Global for params
+		if (meta->global_buffer_id >= 0 && meta->buffers[meta->global_buffer_id].bind.register_type == skr_register_push_constant) {
+			const sksc_shader_buffer_t* params = &meta->buffers[meta->global_buffer_id];
+			VkShaderStageFlags stages = 0;
+			if (params->bind.stage_bits & skr_stage_vertex ) stages |= VK_SHADER_STAGE_VERTEX_BIT;
+			if (params->bind.stage_bits & skr_stage_pixel  ) stages |= VK_SHADER_STAGE_FRAGMENT_BIT;
+			if (params->bind.stage_bits & skr_stage_compute) stages |= VK_SHADER_STAGE_COMPUTE_BIT;
+			shader.push_range = (VkPushConstantRange){ .stageFlags = stages, .offset = 0, .size = params->size };
+		}
 	}
 
 	return shader;
@@ -105,6 +117,98 @@ skr_err_ skr_shader_create(const void* shader_data, uint32_t data_size, skr_shad
 	}
 	_skr_free(file.stages);
 
+	if (out_shader->push_range.size > _skr_vk.max_push_constants) {
+		skr_log(skr_log_critical, "Shader '%s' has %u bytes of push constants, device supports %u", out_shader->meta->name, out_shader->push_range.size, _skr_vk.max_push_constants);
+		skr_shader_destroy(out_shader);
+		return skr_err_unsupported;
+	}
+
+	return skr_err_success;
+}
+
+// Materials and computes copied binds, param sizes and stage layout from the
+// shader when they were created, so a reload may change the code and the
+// defaults, but not anything those copies were made from.
+static bool _skr_shader_interface_matches(const skr_shader_t* a, const skr_shader_t* b) {
+	const sksc_shader_meta_t* meta_a = a->meta;
+	const sksc_shader_meta_t* meta_b = b->meta;
+	if (!meta_a || !meta_b) return meta_a == meta_b;
+
+	if ((a->vertex_stage .shader != VK_NULL_HANDLE) != (b->vertex_stage .shader != VK_NULL_HANDLE) ||
+	    (a->pixel_stage  .shader != VK_NULL_HANDLE) != (b->pixel_stage  .shader != VK_NULL_HANDLE) ||
+	    (a->compute_stage.shader != VK_NULL_HANDLE) != (b->compute_stage.shader != VK_NULL_HANDLE))
+		return false;
+	if (a->bindless != b->bindless || memcmp(&a->push_range, &b->push_range, sizeof(VkPushConstantRange)) != 0) return false;
+	if (meta_a->buffer_count     != meta_b->buffer_count   ||
+	    meta_a->resource_count   != meta_b->resource_count ||
+	    meta_a->global_buffer_id != meta_b->global_buffer_id)
+		return false;
+
+	for (uint32_t i = 0; i < meta_a->buffer_count; i++) {
+		const sksc_shader_buffer_t* buf_a = &meta_a->buffers[i];
+		const sksc_shader_buffer_t* buf_b = &meta_b->buffers[i];
+		if (buf_a->name_hash != buf_b->name_hash || buf_a->size != buf_b->size || buf_a->var_count != buf_b->var_count ||
+		    memcmp(&buf_a->bind, &buf_b->bind, sizeof(skr_bind_t)) != 0)
+			return false;
+		for (uint32_t v = 0; v < buf_a->var_count; v++) {
+			const sksc_shader_var_t* var_a = &buf_a->vars[v];
+			const sksc_shader_var_t* var_b = &buf_b->vars[v];
+			if (var_a->name_hash != var_b->name_hash || var_a->offset     != var_b->offset ||
+			    var_a->size      != var_b->size      || var_a->type       != var_b->type   ||
+			    var_a->type_count != var_b->type_count)
+				return false;
+		}
+	}
+	for (uint32_t i = 0; i < meta_a->resource_count; i++) {
+		const sksc_shader_resource_t* res_a = &meta_a->resources[i];
+		const sksc_shader_resource_t* res_b = &meta_b->resources[i];
+		if (res_a->name_hash != res_b->name_hash || res_a->element_size != res_b->element_size ||
+		    memcmp(&res_a->bind, &res_b->bind, sizeof(skr_bind_t)) != 0)
+			return false;
+	}
+	return true;
+}
+
+skr_err_ skr_shader_reload(skr_shader_t* ref_shader, const void* shader_data, uint32_t data_size) {
+	if (!ref_shader || !ref_shader->meta) return skr_err_invalid_parameter;
+
+	// Everything slow or fallible happens before the live shader is touched,
+	// a file that doesn't compile or load leaves it as it was
+	skr_shader_t fresh;
+	skr_err_ err = skr_shader_create(shader_data, data_size, &fresh);
+	if (err != skr_err_success) return err;
+
+	if (!_skr_shader_interface_matches(ref_shader, &fresh)) {
+		skr_log(skr_log_warning, "skr_shader_reload: '%s' changed its stages, resources or params, recreate it and its materials instead", ref_shader->meta->name);
+		skr_shader_destroy(&fresh);
+		return skr_err_unsupported;
+	}
+
+	_skr_pipeline_lock();
+
+	// Swap stages, fresh now holds the old ones
+	skr_shader_stage_t stage;
+	stage = ref_shader->vertex_stage;  ref_shader->vertex_stage  = fresh.vertex_stage;  fresh.vertex_stage  = stage;
+	stage = ref_shader->pixel_stage;   ref_shader->pixel_stage   = fresh.pixel_stage;   fresh.pixel_stage   = stage;
+	stage = ref_shader->compute_stage; ref_shader->compute_stage = fresh.compute_stage; fresh.compute_stage = stage;
+
+	// Publish the new meta with one pointer store, so setters running on
+	// other threads see either the old meta or the new one, never a mix.
+	// Materials release the meta they referenced themselves, and the
+	// shader's reference to the old one goes once frames in flight are done.
+	sksc_shader_meta_t* old_meta = ref_shader->meta;
+	ref_shader->meta             = fresh.meta;
+	fresh.meta                   = NULL;
+	_skr_cmd_destroy_shader_meta(NULL, old_meta);
+
+	ref_shader->reloads++;
+	_skr_pipeline_invalidate_shader_unlocked(ref_shader);
+
+	_skr_pipeline_unlock();
+
+	// Old modules go through the destroy list, pipelines already recorded
+	// with them stay alive until their frames retire
+	skr_shader_destroy(&fresh);
 	return skr_err_success;
 }
 
@@ -141,6 +245,34 @@ skr_bind_t skr_shader_get_bind(const skr_shader_t* shader, const char* bind_name
 	return sksc_shader_meta_get_bind(shader->meta, bind_name);
 }
 
+skr_param_id_t skr_shader_get_param_id(const skr_shader_t* shader, const char* name) {
+	skr_param_id_t result = { .bind_idx = -1 };
+	if (!shader || !shader->meta || !name) return result;
+
+	const sksc_shader_meta_t* meta = shader->meta;
+	uint64_t                  hash = skr_hash(name);
+
+	// Bind indices follow the material/compute bind layout, buffers then resources
+	for (uint32_t i = 0; i < meta->buffer_count && result.bind_idx < 0; i++) {
+		if (meta->buffers[i].name_hash == hash) result.bind_idx = (int32_t)i;
+	}
+	for (uint32_t i = 0; i < meta->resource_count && result.bind_idx < 0; i++) {
+		if (meta->resources[i].name_hash == hash) result.bind_idx = (int32_t)(meta->buffer_count + i);
+	}
+
+	// Bindless resources are also params, so a name can be both
+	const sksc_shader_var_t* var = sksc_shader_meta_get_var_info(meta, sksc_shader_meta_get_var_index_h(meta, hash));
+	if (var) {
+		result.offset = var->offset;
+		result.size   = (uint16_t)var->size;
+		result.type   = var->type;
+	}
+
+	if (result.bind_idx < 0 && !var)
+		skr_log(skr_log_warning, "Shader param '%s' not found", name);
+	return result;
+}
+
 void skr_shader_set_name(skr_shader_t* ref_shader, const char* name) {
 	if (!ref_shader) return;
 
@@ -181,7 +313,7 @@ VkDescriptorSetLayout _skr_shader_make_layout(VkDevice device, bool has_push_des
 	for (uint32_t i = 0; i < meta->buffer_count; i++) {
 		skr_bind_t bind = meta->buffers[i].bind;
 		bind.stage_bits = bind.stage_bits & stage_mask;
-		if (!bind.stage_bits) continue;
+		if (!bind.stage_bits || bind.register_type == skr_register_push_constant) continue;
 
 		// Determine descriptor type based on register type
 		VkDescriptorType desc_type = VK_DESCRIPTOR_TYPE_MAX_ENUM;
@@ -193,6 +325,8 @@ VkDescriptorSetLayout _skr_shader_make_layout(VkDevice device, bool has_push_des
 			case skr_register_readwrite_tex: desc_type = VK_DESCRIPTOR_TYPE_STORAGE_IMAGE;          break; // (RWTexture)
 			default:                         desc_type = VK_DESCRIPTOR_TYPE_MAX_ENUM; break;
 		}
+		// Per-draw data goes through dynamic offsets when sets are persistent
+		if (!has_push_descriptors) desc_type = _skr_material_dynamic_type(bind.slot, desc_type);
 
 		VkShaderStageFlags stages = 0;
 		if (bind.stage_bits & skr_stage_vertex ) stages |= VK_SHADER_STAGE_VERTEX_BIT;
@@ -224,6 +358,8 @@ VkDescriptorSetLayout _skr_shader_make_layout(VkDevice device, bool has_push_des
 			case skr_register_readwrite_tex: desc_type = VK_DESCRIPTOR_TYPE_STORAGE_IMAGE;          break; // (RWTexture)
 			default:                         desc_type = VK_DESCRIPTOR_TYPE_MAX_ENUM; break;
 		}
+		// Per-draw data goes through dynamic offsets when sets are persistent
+		if (!has_push_descriptors) desc_type = _skr_material_dynamic_type(bind.slot, desc_type);
 
 		VkShaderStageFlags stages = 0;
 		if (bind.stage_bits & skr_stage_vertex ) stages |= VK_SHADER_STAGE_VERTEX_BIT;
@@ -240,6 +376,9 @@ VkDescriptorSetLayout _skr_shader_make_layout(VkDevice device, bool has_push_des
 		};
 	}
 
+	// Only a push constant block, nothing for a descriptor set
+	if (binding_count == 0) return VK_NULL_HANDLE;
+
 	VkDescriptorSetLayoutCreateInfo layout_info = {
 		.sType        = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO,
 		.flags        = has_push_descriptors ? VK_DESCRIPTOR_SET_LAYOUT_CREATE_PUSH_DESCRIPTOR_BIT_KHR : 0,
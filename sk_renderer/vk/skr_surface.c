@@ -26,6 +26,42 @@ static VkSurfaceFormatKHR _skr_find_surface_format(const VkSurfaceFormatKHR* for
 	return formats[0];
 }
 
+// Each retired swapchain waits on the latest submission at the time, which
+// covers every frame that rendered to it, and a few more frames for presents
+// still queued. Returns the record's destroy list, or NULL if it can't grow.
+static skr_destroy_list_t* _skr_surface_retire_begin(void) {
+	if (_skr_vk.retired_count >= _skr_vk.retired_capacity) {
+		uint32_t                  capacity = _skr_vk.retired_capacity == 0 ? 4 : _skr_vk.retired_capacity * 2;
+		_skr_retired_swapchain_t* retired  = _skr_realloc(_skr_vk.retired, capacity * sizeof(_skr_retired_swapchain_t));
+		if (!retired) return NULL;
+		_skr_vk.retired          = retired;
+		_skr_vk.retired_capacity = capacity;
+	}
+	_skr_retired_swapchain_t* record = &_skr_vk.retired[_skr_vk.retired_count++];
+	*record = (_skr_retired_swapchain_t){
+		.list  = _skr_destroy_list_create(),
+		.after = skr_future_get(),
+		.frame = _skr_vk.frame + SKR_MAX_FRAMES_IN_FLIGHT,
+	};
+	return &record->list;
+}
+
+void _skr_surface_collect_retired(bool wait) {
+	uint32_t kept = 0;
+	for (uint32_t i = 0; i < _skr_vk.retired_count; i++) {
+		_skr_retired_swapchain_t* record = &_skr_vk.retired[i];
+		if (wait) {
+			skr_future_wait(&record->after);
+		} else if (_skr_vk.frame < record->frame || !skr_future_check(&record->after)) {
+			_skr_vk.retired[kept++] = *record;
+			continue;
+		}
+		_skr_destroy_list_execute(&record->list);
+		_skr_destroy_list_free   (&record->list);
+	}
+	_skr_vk.retired_count = kept;
+}
+
 // Helper to create/recreate swapchain and allocate resources
 static bool _skr_surface_create_swapchain(VkDevice device, VkPhysicalDevice phys_device, uint32_t graphics_queue_family, skr_surface_t* ref_surface, VkSwapchainKHR old_swapchain) {
 	// Get surface capabilities
@@ -110,9 +146,24 @@ static bool _skr_surface_create_swapchain(VkDevice device, VkPhysicalDevice phys
 	VkResult vr = vkCreateSwapchainKHR(device, &swapchain_info, NULL, &swapchain);
 	SKR_VK_CHECK_RET(vr, "vkCreateSwapchainKHR", false);
 
-	// Destroy old swapchain if provided
+	// The old swapchain is retired now, but frames in flight and queued
+	// presents may still use it and its images. Hand everything to its own
+	// retirement record (LIFO, so the swapchain goes first and is destroyed
+	// last). If there's no room for a record, it waits for the GPU instead.
 	if (old_swapchain != VK_NULL_HANDLE) {
-		vkDestroySwapchainKHR(device, old_swapchain, NULL);
+		skr_destroy_list_t* retired = _skr_surface_retire_begin();
+		if (!retired) {
+			skr_log(skr_log_warning, "Failed to retire swapchain, waiting for the device instead");
+			vkDeviceWaitIdle(device);
+		}
+		_skr_cmd_destroy_swapchain(retired, old_swapchain);
+		for (uint32_t i = 0; i < ref_surface->image_count; i++) {
+			skr_tex_t* tex = &ref_surface->images[i];
+			_skr_cmd_destroy_framebuffer(retired, tex->framebuffer);
+			_skr_cmd_destroy_framebuffer(retired, tex->framebuffer_depth);
+			_skr_cmd_destroy_image_view (retired, tex->view);
+			_skr_cmd_destroy_semaphore  (retired, ref_surface->semaphore_submit[i]);
+		}
 	}
 	ref_surface->swapchain = swapchain;
 
@@ -123,26 +174,18 @@ static bool _skr_surface_create_swapchain(VkDevice device, VkPhysicalDevice phys
 
 	// Reallocate images array and per-image semaphores if count changed
 	if (image_count != ref_surface->image_count) {
-		// Destroy old per-image submit semaphores
-		if (ref_surface->semaphore_submit) {
-			for (uint32_t i = 0; i < ref_surface->image_count; i++) {
-				if (ref_surface->semaphore_submit[i]) vkDestroySemaphore(device, ref_surface->semaphore_submit[i], NULL);
-			}
-			_skr_free(ref_surface->semaphore_submit);
-		}
-
-		// Allocate new per-image submit semaphores for new image count
+		_skr_free(ref_surface->semaphore_submit);
+		_skr_free(ref_surface->images);
 		ref_surface->semaphore_submit = (VkSemaphore*)_skr_calloc(image_count, sizeof(VkSemaphore));
+		ref_surface->images           = (skr_tex_t*  )_skr_calloc(image_count, sizeof(skr_tex_t));
+		ref_surface->image_count      = image_count;
+	}
 
-		VkSemaphoreCreateInfo semaphore_info = { .sType = VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO };
-		for (uint32_t i = 0; i < image_count; i++) {
-			vkCreateSemaphore(device, &semaphore_info, NULL, &ref_surface->semaphore_submit[i]);
-		}
-
-		// Reallocate images array
-		if (ref_surface->images) _skr_free(ref_surface->images);
-		ref_surface->images      = (skr_tex_t*)_skr_calloc(image_count, sizeof(skr_tex_t));
-		ref_surface->image_count = image_count;
+	// Per-image submit semaphores, the old ones were retired with the old
+	// swapchain since a present may still be waiting on them
+	VkSemaphoreCreateInfo semaphore_info = { .sType = VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO };
+	for (uint32_t i = 0; i < image_count; i++) {
+		vkCreateSemaphore(device, &semaphore_info, NULL, &ref_surface->semaphore_submit[i]);
 	}
 
 	// Update size
@@ -232,7 +275,8 @@ skr_err_ skr_surface_create(void* vk_surface_khr, skr_surface_t* out_surface) {
 void skr_surface_destroy(skr_surface_t* ref_surface) {
 	if (!ref_surface) return;
 
-	//vkDeviceWaitIdle(_skr_vk.device);
+	// Retired swapchains have to go before the VkSurfaceKHR they came from
+	_skr_surface_collect_retired(true);
 
 	// Destroy per-frame synchronization objects
 	for (uint32_t i = 0; i < SKR_MAX_FRAMES_IN_FLIGHT; i++)
@@ -262,17 +306,8 @@ void skr_surface_destroy(skr_surface_t* ref_surface) {
 void skr_surface_resize(skr_surface_t* ref_surface) {
 	if (!ref_surface) return;
 
-	vkDeviceWaitIdle(_skr_vk.device);
-
-	// Destroy old image views and framebuffers
-	for (uint32_t i = 0; i < ref_surface->image_count; i++) {
-		skr_tex_t* tex = &ref_surface->images[i];
-		if (tex->framebuffer      ) { vkDestroyFramebuffer(_skr_vk.device, tex->framebuffer,       NULL); }
-		if (tex->framebuffer_depth) { vkDestroyFramebuffer(_skr_vk.device, tex->framebuffer_depth, NULL); }
-		if (tex->view             ) { vkDestroyImageView  (_skr_vk.device, tex->view,              NULL); }
-	}
-
-	// Recreate swapchain using helper (old swapchain will be destroyed by helper)
+	// No idle wait, the helper passes the old swapchain along and retires it
+	// with its views and semaphores until the GPU is done with them
 	_skr_surface_create_swapchain(_skr_vk.device, _skr_vk.physical_device, _skr_vk.graphics_queue_family, ref_surface, ref_surface->swapchain);
 }
 
@@ -301,6 +336,8 @@ skr_acquire_ skr_surface_next_tex(skr_surface_t* ref_surface, skr_tex_t** out_te
 		_skr_vk.cpu_frame_wait_ns[_skr_vk.flight_idx] += (wait_end - wait_start);
 	}
 
+	_skr_surface_collect_retired(false);
+
 	// Handle surface lost - cannot recover here, caller must recreate surface
 	if (result == VK_ERROR_SURFACE_LOST_KHR) {
 		skr_log(skr_log_critical, "Surface lost - full surface recreation needed");
@@ -311,26 +348,18 @@ skr_acquire_ skr_surface_next_tex(skr_surface_t* ref_surface, skr_tex_t** out_te
 
 	// Handle swapchain out-of-date or suboptimal
 	if (result == VK_ERROR_OUT_OF_DATE_KHR || result == VK_SUBOPTIMAL_KHR) {
-		// If VK_SUBOPTIMAL_KHR, the semaphore was signaled even though we won't use the image
-		// We need to consume the semaphore with a dummy submit to unsignal it
+		// If VK_SUBOPTIMAL_KHR, the semaphore will be signaled even though we
+		// won't use the image. This thread's next graphics submit waits on it
+		// so its signal is consumed, and destroys it once done. The slot gets
+		// a fresh one.
 		if (result == VK_SUBOPTIMAL_KHR) {
-			VkPipelineStageFlags wait_stage = VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT;
-
-			mtx_lock(_skr_vk.graphics_queue_mutex);
-			vkQueueSubmit(_skr_vk.graphics_queue, 1, &(VkSubmitInfo){
-				.sType                = VK_STRUCTURE_TYPE_SUBMIT_INFO,
-				.waitSemaphoreCount   = 1,
-				.pWaitSemaphores      = &ref_surface->semaphore_acquire[ref_surface->frame_idx],
-				.pWaitDstStageMask    = &wait_stage,
-				.commandBufferCount   = 0,  // No commands, just consume the semaphore
-			}, VK_NULL_HANDLE);
-
-			// Wait for the dummy submit to complete so semaphore is unsignaled
-			vkQueueWaitIdle(_skr_vk.graphics_queue);
-			mtx_unlock(_skr_vk.graphics_queue_mutex);
+			_skr_cmd_consume_semaphore(ref_surface->semaphore_acquire[ref_surface->frame_idx]);
+
+			VkSemaphoreCreateInfo semaphore_info = { .sType = VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO };
+			vkCreateSemaphore(_skr_vk.device, &semaphore_info, NULL, &ref_surface->semaphore_acquire[ref_surface->frame_idx]);
 		}
 
-		// Don't advance frame index - we can reuse the same (now unsignaled) semaphore
+		// Don't advance frame index - the slot's semaphore is unsignaled either way
 		return skr_acquire_needs_resize;
 	}
 
@@ -359,7 +388,9 @@ void skr_surface_present(skr_surface_t* ref_surface) {
 	});
 	mtx_unlock(_skr_vk.present_queue_mutex);
 
-	ref_surface->frame_idx = (ref_surface->frame_idx + 1) % SKR_MAX_FRAMES_IN_FLIGHT;
+	// Frame slots follow the runtime frames in flight, waiting on a slot's
+	// future in skr_surface_next_tex is what limits how far ahead we get
+	ref_surface->frame_idx = (ref_surface->frame_idx + 1) % _skr_vk.frames_in_flight;
 }
 
 skr_vec2i_t skr_surface_get_size(const skr_surface_t* surface) {
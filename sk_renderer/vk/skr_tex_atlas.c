@@ -0,0 +1,140 @@
+// SPDX-License-Identifier: MIT
+// The authors below grant copyright rights under the MIT license:
+// Copyright (c) 2025 Nick Klingensmith
+// Copyright (c) 2025 Qualcomm Technologies, Inc.
+
+#include "sk_renderer.h"
+#include "_sk_renderer.h"
+
+#include "skr_vulkan.h"
+
+#include <string.h>
+
+///////////////////////////////////////////////////////////////////////////////
+// Texture atlas
+//
+// Instanced draws need every item in the batch to bind the same resources,
+// so materials that only differ by their texture can't share one. Packing
+// those textures into the layers of a single array texture gives each of
+// the materials identical binds, and the render list merges their items by
+// content. The layer count is fixed at creation: growing would mean a new
+// VkImage, and every material bound to the old one would need rebinding.
+///////////////////////////////////////////////////////////////////////////////
+
+skr_err_ skr_tex_atlas_create(skr_tex_fmt_ format, skr_tex_sampler_t sampler, skr_vec3i_t size, int32_t mip_count, uint32_t layer_capacity, skr_tex_atlas_t* out_atlas) {
+	if (!out_atlas) return skr_err_invalid_parameter;
+	*out_atlas = (skr_tex_atlas_t){0};
+	if (layer_capacity == 0 || size.x <= 0 || size.y <= 0) return skr_err_invalid_parameter;
+
+	out_atlas->free = _skr_malloc(layer_capacity * sizeof(uint32_t));
+	out_atlas->used = _skr_calloc(layer_capacity, sizeof(uint8_t));
+	if (!out_atlas->free || !out_atlas->used) {
+		skr_log(skr_log_critical, "Failed to allocate texture atlas");
+		skr_tex_atlas_destroy(out_atlas);
+		return skr_err_out_of_memory;
+	}
+
+	// Readable so layers can be copied back out, dynamic so they can be uploaded to
+	skr_err_ err = skr_tex_create(format, skr_tex_flags_array | skr_tex_flags_dynamic | skr_tex_flags_readable, sampler,
+		(skr_vec3i_t){size.x, size.y, (int32_t)layer_capacity}, 1, mip_count, NULL, &out_atlas->tex);
+	if (err != skr_err_success) {
+		skr_tex_atlas_destroy(out_atlas);
+		return err;
+	}
+	out_atlas->capacity = layer_capacity;
+	return skr_err_success;
+}
+
+void skr_tex_atlas_destroy(skr_tex_atlas_t* ref_atlas) {
+	if (!ref_atlas) return;
+	skr_tex_destroy(&ref_atlas->tex);
+	_skr_free(ref_atlas->free);
+	_skr_free(ref_atlas->used);
+	*ref_atlas = (skr_tex_atlas_t){0};
+}
+
+bool skr_tex_atlas_accepts(const skr_tex_atlas_t* atlas, const skr_tex_t* tex) {
+	if (!atlas || !skr_tex_is_valid(&atlas->tex) || !skr_tex_is_valid(tex)) return false;
+	return tex->format     == atlas->tex.format
+	    && tex->size.x     == atlas->tex.size.x
+	    && tex->size.y     == atlas->tex.size.y
+	    && tex->mip_levels == atlas->tex.mip_levels
+	    && tex->samples    == VK_SAMPLE_COUNT_1_BIT;
+}
+
+static int32_t _skr_tex_atlas_alloc(skr_tex_atlas_t* ref_atlas) {
+	int32_t layer = -1;
+	if      (ref_atlas->free_count > 0)            layer = (int32_t)ref_atlas->free[--ref_atlas->free_count];
+	else if (ref_atlas->next < ref_atlas->capacity) layer = (int32_t)ref_atlas->next++;
+	if (layer < 0) {
+		skr_log(skr_log_warning, "Texture atlas is full (%u layers)", ref_atlas->capacity);
+		return -1;
+	}
+	ref_atlas->used[layer] = 1;
+	return layer;
+}
+
+static void _skr_tex_atlas_release(skr_tex_atlas_t* ref_atlas, uint32_t layer) {
+	ref_atlas->used[layer]                   = 0;
+	ref_atlas->free[ref_atlas->free_count++] = layer;
+}
+
+skr_err_ skr_tex_atlas_add(skr_tex_atlas_t* ref_atlas, const skr_tex_t* src, uint32_t* out_layer) {
+	if (!ref_atlas || !out_layer) return skr_err_invalid_parameter;
+	if (!skr_tex_atlas_accepts(ref_atlas, src)) {
+		skr_log(skr_log_warning, "skr_tex_atlas_add: texture format, size or mip count doesn't match the atlas");
+		return skr_err_invalid_parameter;
+	}
+	if (!(src->flags & (skr_tex_flags_readable | skr_tex_flags_gen_mips))) {
+		skr_log(skr_log_warning, "skr_tex_atlas_add: source texture must be created with skr_tex_flags_readable");
+		return skr_err_invalid_parameter;
+	}
+
+	int32_t layer = _skr_tex_atlas_alloc(ref_atlas);
+	if (layer < 0) return skr_err_out_of_memory;
+
+	for (uint32_t mip = 0; mip < ref_atlas->tex.mip_levels; mip++) {
+		skr_err_ err = skr_tex_copy(src, &ref_atlas->tex, mip, 0, mip, (uint32_t)layer, 1);
+		if (err != skr_err_success) {
+			_skr_tex_atlas_release(ref_atlas, (uint32_t)layer);
+			return err;
+		}
+	}
+	*out_layer = (uint32_t)layer;
+	return skr_err_success;
+}
+
+skr_err_ skr_tex_atlas_add_data(skr_tex_atlas_t* ref_atlas, const skr_tex_data_t* data, uint32_t* out_layer) {
+	if (!ref_atlas || !data || !data->data || !out_layer) return skr_err_invalid_parameter;
+	if (data->layer_count != 1) {
+		skr_log(skr_log_warning, "skr_tex_atlas_add_data: expected exactly one layer of data");
+		return skr_err_invalid_parameter;
+	}
+
+	int32_t layer = _skr_tex_atlas_alloc(ref_atlas);
+	if (layer < 0) return skr_err_out_of_memory;
+
+	skr_tex_data_t layer_data = *data;
+	layer_data.base_layer = (uint32_t)layer;
+	skr_err_ err = skr_tex_set_data(&ref_atlas->tex, &layer_data);
+	if (err != skr_err_success) {
+		_skr_tex_atlas_release(ref_atlas, (uint32_t)layer);
+		return err;
+	}
+	*out_layer = (uint32_t)layer;
+	return skr_err_success;
+}
+
+void skr_tex_atlas_remove(skr_tex_atlas_t* ref_atlas, uint32_t layer) {
+	if (!ref_atlas || layer >= ref_atlas->next || !ref_atlas->used[layer]) {
+		skr_log(skr_log_warning, "skr_tex_atlas_remove: layer %u isn't in use", layer);
+		return;
+	}
+	// Draws already recorded keep sampling the old contents, anything that
+	// reuses the layer is copied in on the same queue after them
+	_skr_tex_atlas_release(ref_atlas, layer);
+}
+
+skr_tex_t* skr_tex_atlas_get_tex(skr_tex_atlas_t* ref_atlas) {
+	return ref_atlas && skr_tex_is_valid(&ref_atlas->tex) ? &ref_atlas->tex : NULL;
+}
@@ -37,23 +37,28 @@ static uint32_t _skr_find_memory_type(VkPhysicalDevice phys_device, VkMemoryRequ
 	return UINT32_MAX;
 }
 
-// Allocate device memory for an image, trying lazily-allocated first for transient attachments
-static VkDeviceMemory _skr_allocate_image_memory(VkDevice device, VkPhysicalDevice phys_device, VkImage image, bool is_transient_attachment, VkDeviceMemory* out_memory) {
-	VkMemoryRequirements mem_requirements;
-	vkGetImageMemoryRequirements(device, image, &mem_requirements);
-
+// Memory type for an image, trying lazily-allocated first for transient attachments
+uint32_t _skr_tex_find_memory_type(VkMemoryRequirements mem_requirements, bool is_transient_attachment) {
 	uint32_t memory_type_index = UINT32_MAX;
 
 	// For transient MSAA attachments, prefer lazily allocated memory
 	if (is_transient_attachment) {
-		memory_type_index = _skr_find_memory_type(phys_device, mem_requirements, VK_MEMORY_PROPERTY_LAZILY_ALLOCATED_BIT);
+		memory_type_index = _skr_find_memory_type(_skr_vk.physical_device, mem_requirements, VK_MEMORY_PROPERTY_LAZILY_ALLOCATED_BIT);
 	}
 
 	// Fallback to device local memory
 	if (memory_type_index == UINT32_MAX) {
-		memory_type_index = _skr_find_memory_type(phys_device, mem_requirements, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT);
+		memory_type_index = _skr_find_memory_type(_skr_vk.physical_device, mem_requirements, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT);
 	}
+	return memory_type_index;
+}
+
+// Allocate device memory for an image
+static VkDeviceMemory _skr_allocate_image_memory(VkDevice device, VkImage image, bool is_transient_attachment, VkDeviceMemory* out_memory) {
+	VkMemoryRequirements mem_requirements;
+	vkGetImageMemoryRequirements(device, image, &mem_requirements);
 
+	uint32_t memory_type_index = _skr_tex_find_memory_type(mem_requirements, is_transient_attachment);
 	if (memory_type_index == UINT32_MAX) {
 		return VK_NULL_HANDLE;
 	}
@@ -192,31 +197,15 @@ static skr_err_ _skr_ycbcr_create(
 	return skr_err_success;
 }
 
-// Transition image layout with a pipeline barrier (low-level helper)
+// Transition image layout (low-level helper), batched into the command
+// buffer's pending barriers until the next dependent command.
 static void _skr_transition_image_layout(VkCommandBuffer cmd, VkImage image, VkImageAspectFlags aspect_mask,
                                           uint32_t base_mip, uint32_t mip_count, uint32_t layer_count,
                                           VkImageLayout old_layout, VkImageLayout new_layout,
                                           VkPipelineStageFlags src_stage, VkPipelineStageFlags dst_stage,
                                           VkAccessFlags src_access, VkAccessFlags dst_access) {
-	VkImageMemoryBarrier barrier = {
-		.sType               = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER,
-		.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED,
-		.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED,
-		.oldLayout           = old_layout,
-		.newLayout           = new_layout,
-		.srcAccessMask       = src_access,
-		.dstAccessMask       = dst_access,
-		.image               = image,
-		.subresourceRange    = {
-			.aspectMask     = aspect_mask,
-			.baseMipLevel   = base_mip,
-			.levelCount     = mip_count,
-			.baseArrayLayer = 0,
-			.layerCount     = layer_count,
-		},
-	};
-
-	vkCmdPipelineBarrier(cmd, src_stage, dst_stage, 0, 0, NULL, 0, NULL, 1, &barrier);
+	_skr_barrier_image(cmd, image, aspect_mask, base_mip, mip_count, layer_count,
+		old_layout, new_layout, src_stage, dst_stage, src_access, dst_access);
 }
 
 // Helper: Convert layout to typical source stage flags
@@ -345,6 +334,7 @@ void _skr_tex_transition(VkCommandBuffer cmd, skr_tex_t* ref_tex, VkImageLayout
 		ref_tex->current_layout = new_layout;
 	}
 	ref_tex->first_use = false;
+	ref_tex->hazard    = (skr_hazard_t){ .epoch = _skr_vk.hazard_epoch }; // The layout barrier covers any pending compute access
 }
 
 // Specialized: Transition for shader read (most common case)
@@ -410,6 +400,8 @@ void _skr_tex_transition_queue_family(VkCommandBuffer cmd, skr_tex_t* ref_tex,
 	VkPipelineStageFlags src_stage = _layout_to_src_stage(old_layout);
 	VkPipelineStageFlags dst_stage = _layout_to_src_stage(layout);
 
+	// Ownership transfers aren't batched, but must land after pending barriers
+	_skr_barrier_flush(cmd);
 	vkCmdPipelineBarrier(cmd, src_stage, dst_stage, 0, 0, NULL, 0, NULL, 1, &barrier);
 
 	// Update tracked state
@@ -530,6 +522,7 @@ static skr_err_ _skr_tex_upload_data(skr_tex_t* ref_tex, const skr_tex_data_t* d
 		VK_PIPELINE_STAGE_TRANSFER_BIT, VK_ACCESS_TRANSFER_WRITE_BIT);
 
 	// Copy all regions
+	_skr_barrier_flush(ctx.cmd);
 	vkCmdCopyBufferToImage(ctx.cmd, staging.buffer, ref_tex->image,
 		VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, data->mip_count, regions);
 
@@ -549,6 +542,107 @@ static skr_err_ _skr_tex_upload_data(skr_tex_t* ref_tex, const skr_tex_data_t* d
 	return skr_err_success;
 }
 
+#ifdef VK_EXT_HOST_IMAGE_COPY_EXTENSION_NAME
+// Checks if an image with this setup can be written from the CPU without
+// losing GPU access performance.
+static bool _skr_tex_can_host_copy(VkFormat format, VkImageType type, VkImageUsageFlags usage, VkImageCreateFlags create_flags) {
+	if (!_skr_vk.has_host_image_copy) return false;
+
+	VkHostImageCopyDevicePerformanceQueryEXT perf = {
+		.sType = VK_STRUCTURE_TYPE_HOST_IMAGE_COPY_DEVICE_PERFORMANCE_QUERY_EXT,
+	};
+	VkImageFormatProperties2 props = {
+		.sType = VK_STRUCTURE_TYPE_IMAGE_FORMAT_PROPERTIES_2,
+		.pNext = &perf,
+	};
+	VkResult vr = vkGetPhysicalDeviceImageFormatProperties2(_skr_vk.physical_device, &(VkPhysicalDeviceImageFormatInfo2){
+		.sType  = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_IMAGE_FORMAT_INFO_2,
+		.format = format,
+		.type   = type,
+		.tiling = VK_IMAGE_TILING_OPTIMAL,
+		.usage  = usage | VK_IMAGE_USAGE_HOST_TRANSFER_BIT_EXT,
+		.flags  = create_flags,
+	}, &props);
+	return vr == VK_SUCCESS && perf.optimalDeviceAccess;
+}
+
+// Writes initial texture data from the CPU via VK_EXT_host_image_copy, no
+// staging buffer or command buffer involved. Only valid on freshly created
+// images, since host copies aren't ordered against GPU work. Returns false
+// if the caller should fall back to _skr_tex_upload_data.
+static bool _skr_tex_upload_data_host(skr_tex_t* ref_tex, const skr_tex_data_t* data) {
+	if (data->mip_count == 0 || data->layer_count == 0) return false;
+	if (data->row_pitch != 0 && data->mip_count > 1)    return false;
+	if (data->base_mip   + data->mip_count   > ref_tex->mip_levels ) return false;
+	if (data->base_layer + data->layer_count > ref_tex->layer_count) return false;
+
+	VkResult vr = vkTransitionImageLayoutEXT(_skr_vk.device, 1, &(VkHostImageLayoutTransitionInfoEXT){
+		.sType            = VK_STRUCTURE_TYPE_HOST_IMAGE_LAYOUT_TRANSITION_INFO_EXT,
+		.image            = ref_tex->image,
+		.oldLayout        = VK_IMAGE_LAYOUT_UNDEFINED,
+		.newLayout        = _skr_vk.host_image_copy_layout,
+		.subresourceRange = { ref_tex->aspect_mask, 0, ref_tex->mip_levels, 0, ref_tex->layer_count },
+	});
+	if (vr != VK_SUCCESS) return false;
+	ref_tex->current_layout = _skr_vk.host_image_copy_layout;
+
+	VkMemoryToImageCopyEXT* regions = _skr_malloc(sizeof(VkMemoryToImageCopyEXT) * data->mip_count);
+	if (!regions) return false;
+
+	uint32_t block_w, block_h, block_bytes;
+	skr_tex_fmt_block_info(ref_tex->format, &block_w, &block_h, &block_bytes);
+
+	// Same mip-major layout as _skr_tex_upload_data, read in place
+	const uint8_t* src = (const uint8_t*)data->data;
+	for (uint32_t m = 0; m < data->mip_count; m++) {
+		uint32_t    mip        = data->base_mip + m;
+		skr_vec3i_t mip_size   = skr_tex_calc_mip_dimensions(ref_tex->size, mip);
+		uint64_t    layer_size = skr_tex_calc_mip_size(ref_tex->format, ref_tex->size, mip);
+
+		regions[m] = (VkMemoryToImageCopyEXT){
+			.sType             = VK_STRUCTURE_TYPE_MEMORY_TO_IMAGE_COPY_EXT,
+			.pHostPointer      = src,
+			.memoryRowLength   = data->row_pitch > 0 ? (data->row_pitch / block_bytes) * block_w : 0,
+			.memoryImageHeight = 0,
+			.imageSubresource  = {
+				.aspectMask     = ref_tex->aspect_mask,
+				.mipLevel       = mip,
+				.baseArrayLayer = data->base_layer,
+				.layerCount     = data->layer_count,
+			},
+			.imageOffset = {0, 0, 0},
+			.imageExtent = {mip_size.x, mip_size.y, mip_size.z},
+		};
+		src += layer_size * data->layer_count;
+	}
+
+	vr = vkCopyMemoryToImageEXT(_skr_vk.device, &(VkCopyMemoryToImageInfoEXT){
+		.sType          = VK_STRUCTURE_TYPE_COPY_MEMORY_TO_IMAGE_INFO_EXT,
+		.dstImage       = ref_tex->image,
+		.dstImageLayout = _skr_vk.host_image_copy_layout,
+		.regionCount    = data->mip_count,
+		.pRegions       = regions,
+	});
+	_skr_free(regions);
+	if (vr != VK_SUCCESS) return false;
+
+	if (_skr_vk.host_image_copy_layout != VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL) {
+		vr = vkTransitionImageLayoutEXT(_skr_vk.device, 1, &(VkHostImageLayoutTransitionInfoEXT){
+			.sType            = VK_STRUCTURE_TYPE_HOST_IMAGE_LAYOUT_TRANSITION_INFO_EXT,
+			.image            = ref_tex->image,
+			.oldLayout        = _skr_vk.host_image_copy_layout,
+			.newLayout        = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL,
+			.subresourceRange = { ref_tex->aspect_mask, 0, ref_tex->mip_levels, 0, ref_tex->layer_count },
+		});
+		// Data is in place either way, the layout tracker will sort it out
+		if (vr != VK_SUCCESS) return true;
+	}
+	ref_tex->current_layout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+	ref_tex->first_use      = false;
+	return true;
+}
+#endif
+
 ///////////////////////////////////////////////////////////////////////////////
 
 // Internal: create a YUV multi-plane texture with VkSamplerYcbcrConversion.
@@ -591,7 +685,7 @@ static skr_err_ _skr_tex_create_yuv(skr_tex_fmt_ format, skr_tex_sampler_t sampl
 	}
 
 	// Single allocation for all planes (non-disjoint)
-	if (_skr_allocate_image_memory(_skr_vk.device, _skr_vk.physical_device, out_tex->image, false, &out_tex->memory) == VK_NULL_HANDLE) {
+	if (_skr_allocate_image_memory(_skr_vk.device, out_tex->image, false, &out_tex->memory) == VK_NULL_HANDLE) {
 		skr_log(skr_log_critical, "_skr_tex_create_yuv: failed to allocate texture memory");
 		vkDestroyImage(_skr_vk.device, out_tex->image, NULL);
 		*out_tex = (skr_tex_t){0};
@@ -720,6 +814,7 @@ static skr_err_ _skr_tex_create_yuv(skr_tex_fmt_ format, skr_tex_sampler_t sampl
 				VK_IMAGE_LAYOUT_UNDEFINED, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
 				VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT,
 				0, VK_ACCESS_TRANSFER_WRITE_BIT);
+			_skr_barrier_flush(ctx.cmd);
 
 			// Per-plane copy regions
 			VkDeviceSize buffer_offset = 0;
@@ -762,16 +857,13 @@ static skr_err_ _skr_tex_create_yuv(skr_tex_fmt_ format, skr_tex_sampler_t sampl
 	return skr_err_success;
 }
 
-skr_err_ skr_tex_create(skr_tex_fmt_ format, skr_tex_flags_ flags, skr_tex_sampler_t sampler, skr_vec3i_t size, int32_t multisample, int32_t mip_count, const skr_tex_data_t* opt_data, skr_tex_t* out_tex) {
-	if (!out_tex) return skr_err_invalid_parameter;
-
-	// Zero out immediately
-	*out_tex = (skr_tex_t){0};
-
-	// YUV formats use a completely separate creation path
-	if (_skr_tex_fmt_is_yuv(format)) {
-		return _skr_tex_create_yuv(format, sampler, size, opt_data, out_tex);
-	}
+// Creates the VkImage and fills out everything but the memory for a new
+// texture. skr_tex_create allocates dedicated memory for it, the render graph
+// places several of these in one shared allocation.
+skr_err_ _skr_tex_create_unbound(skr_tex_fmt_ format, skr_tex_flags_ flags, skr_tex_sampler_t sampler, skr_vec3i_t size, int32_t multisample, int32_t mip_count, bool has_data, skr_tex_t* out_tex, bool* out_lazy_memory, bool* out_host_upload) {
+	*out_tex         = (skr_tex_t){0};
+	*out_lazy_memory = false;
+	*out_host_upload = false;
 
 	// Validate parameters
 	if (size.x <= 0 || size.y <= 0 || size.z <= 0) {
@@ -839,9 +931,14 @@ skr_err_ skr_tex_create(skr_tex_fmt_ format, skr_tex_flags_ flags, skr_tex_sampl
 	if (out_tex->aspect_mask == 0)          { out_tex->aspect_mask   = VK_IMAGE_ASPECT_COLOR_BIT;   }
 
 
-	// For MSAA attachments, add transient bit for in-tile resolve optimization
-	// But only if the texture is NOT readable (transient means no memory backing)
-	bool is_msaa_attachment = out_tex->samples > VK_SAMPLE_COUNT_1_BIT && (out_tex->flags & skr_tex_flags_writeable) && !(out_tex->flags & skr_tex_flags_readable);
+	// MSAA color and depth attachments that are never read back only live
+	// for the duration of a render pass, so they get the transient bit for
+	// in-tile rendering (transient means no memory backing). Anything that
+	// can be copied, uploaded to or written by compute needs real memory.
+	bool is_msaa_attachment      = out_tex->samples > VK_SAMPLE_COUNT_1_BIT && (out_tex->flags & skr_tex_flags_writeable) && !(out_tex->flags & skr_tex_flags_readable);
+	bool is_depth_attachment     = is_depth                                 && (out_tex->flags & skr_tex_flags_writeable) && !(out_tex->flags & skr_tex_flags_readable);
+	bool is_transient_attachment = (is_msaa_attachment || is_depth_attachment) && !has_data &&
+		!(out_tex->flags & (skr_tex_flags_compute | skr_tex_flags_dynamic | skr_tex_flags_gen_mips));
 
 	if (out_tex->flags & skr_tex_flags_writeable) {
 		if (is_depth) {
@@ -849,18 +946,18 @@ skr_err_ skr_tex_create(skr_tex_fmt_ format, skr_tex_flags_ flags, skr_tex_sampl
 		} else {
 			usage |= VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT;
 			// TRANSIENT_ATTACHMENT_BIT can't be combined with TRANSFER_DST_BIT
-			if (!is_msaa_attachment) {
+			if (!is_transient_attachment) {
 				usage |= VK_IMAGE_USAGE_TRANSFER_DST_BIT;
 			}
 		}
 	}
-	if (opt_data && opt_data->data) {
+	if (has_data) {
 		usage |= VK_IMAGE_USAGE_TRANSFER_DST_BIT; // Need to upload data
 	}
 
 	// Only use transient attachment if format+usage combination is supported
 	// AND lazily allocated memory is available (required for transient attachments)
-	if (is_msaa_attachment) {
+	if (is_transient_attachment) {
 		VkImageUsageFlags test_usage = usage | VK_IMAGE_USAGE_TRANSIENT_ATTACHMENT_BIT;
 		test_usage &= ~(VK_IMAGE_USAGE_SAMPLED_BIT | VK_IMAGE_USAGE_TRANSFER_DST_BIT);
 
@@ -894,10 +991,10 @@ skr_err_ skr_tex_create(skr_tex_fmt_ format, skr_tex_flags_ flags, skr_tex_sampl
 			usage |= VK_IMAGE_USAGE_TRANSIENT_ATTACHMENT_BIT;
 			// Remove SAMPLED_BIT and TRANSFER_DST_BIT for transient attachments
 			usage &= ~(VK_IMAGE_USAGE_SAMPLED_BIT | VK_IMAGE_USAGE_TRANSFER_DST_BIT);
-			// is_msaa_attachment stays true - request lazy memory allocation
+			// is_transient_attachment stays true - request lazy memory allocation
 		} else {
 			// Transient not supported, fall back to regular memory
-			is_msaa_attachment = false;
+			is_transient_attachment = false;
 		}
 	}
 
@@ -933,20 +1030,37 @@ skr_err_ skr_tex_create(skr_tex_fmt_ format, skr_tex_flags_ flags, skr_tex_sampl
 		}
 	}
 
+	// Sampled-only textures with initial data can be written directly from the
+	// CPU on unified memory devices, skipping the staging copy.
+#ifdef VK_EXT_HOST_IMAGE_COPY_EXTENSION_NAME
+	if (has_data && out_tex->samples == VK_SAMPLE_COUNT_1_BIT && !(out_tex->flags & (skr_tex_flags_writeable | skr_tex_flags_compute)) &&
+	    _skr_tex_can_host_copy(vk_format, image_type, usage, (out_tex->flags & skr_tex_flags_cubemap) ? VK_IMAGE_CREATE_CUBE_COMPATIBLE_BIT : 0)) {
+		usage           |= VK_IMAGE_USAGE_HOST_TRANSFER_BIT_EXT;
+		*out_host_upload = true;
+	}
+#endif
+
+	// Compute textures are shared with the async compute queue, concurrent
+	// sharing avoids ownership transfers. Other images stay exclusive, since
+	// concurrent can disable compression on render targets.
+	bool concurrent = _skr_vk.has_async_compute && (out_tex->flags & skr_tex_flags_compute);
+
 	// Create image (use normalized out_tex->size where z is always depth)
 	VkImageCreateInfo image_info = {
-		.sType         = VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO,
-		.imageType     = image_type,
-		.format        = vk_format,
-		.extent        = { .width = out_tex->size.x, .height = out_tex->size.y, .depth = out_tex->size.z },
-		.mipLevels     = out_tex->mip_levels,
-		.arrayLayers   = out_tex->layer_count,
-		.samples       = out_tex->samples,
-		.tiling        = VK_IMAGE_TILING_OPTIMAL,
-		.usage         = usage,
-		.sharingMode   = VK_SHARING_MODE_EXCLUSIVE,
-		.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED,
-		.flags         = (out_tex->flags & skr_tex_flags_cubemap) ? VK_IMAGE_CREATE_CUBE_COMPATIBLE_BIT : 0,
+		.sType                 = VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO,
+		.imageType             = image_type,
+		.format                = vk_format,
+		.extent                = { .width = out_tex->size.x, .height = out_tex->size.y, .depth = out_tex->size.z },
+		.mipLevels             = out_tex->mip_levels,
+		.arrayLayers           = out_tex->layer_count,
+		.samples               = out_tex->samples,
+		.tiling                = VK_IMAGE_TILING_OPTIMAL,
+		.usage                 = usage,
+		.sharingMode           = concurrent ? VK_SHARING_MODE_CONCURRENT : VK_SHARING_MODE_EXCLUSIVE,
+		.queueFamilyIndexCount = concurrent ? 2 : 0,
+		.pQueueFamilyIndices   = _skr_vk.async_queue_families,
+		.initialLayout         = VK_IMAGE_LAYOUT_UNDEFINED,
+		.flags                 = (out_tex->flags & skr_tex_flags_cubemap) ? VK_IMAGE_CREATE_CUBE_COMPATIBLE_BIT : 0,
 	};
 
 	VkResult vr = vkCreateImage(_skr_vk.device, &image_info, NULL, &out_tex->image);
@@ -955,78 +1069,115 @@ skr_err_ skr_tex_create(skr_tex_fmt_ format, skr_tex_flags_ flags, skr_tex_sampl
 		return skr_err_device_error;
 	}
 
-	// Allocate memory using helper
-	if (_skr_allocate_image_memory(_skr_vk.device, _skr_vk.physical_device, out_tex->image, is_msaa_attachment, &out_tex->memory) == VK_NULL_HANDLE) {
-		skr_log(skr_log_critical, "Failed to allocate texture memory - Format: %d, Size: %dx%dx%d, Mips: %d, Layers: %d, Samples: %d, Usage: 0x%x, Flags: 0x%x",
-			format, size.x, size.y, size.z, out_tex->mip_levels, out_tex->layer_count, out_tex->samples, usage, out_tex->flags);
-		vkDestroyImage(_skr_vk.device, out_tex->image, NULL);
-		*out_tex = (skr_tex_t){0};
-		return skr_err_out_of_memory;
-	}
+	*out_lazy_memory = is_transient_attachment;
+	// Transient discard optimization for non-readable depth/MSAA (tile GPU optimization)
+	out_tex->is_transient_discard = (is_msaa_attachment || (is_depth && !(flags & skr_tex_flags_readable)));
+	return skr_err_success;
+}
 
-	vkBindImageMemory(_skr_vk.device, out_tex->image, out_tex->memory, 0);
+// Binds memory to a texture from _skr_tex_create_unbound, then finishes it
+// with layout tracking, an image view and a sampler. On failure the caller
+// still owns the image and memory.
+skr_err_ _skr_tex_bind_memory(skr_tex_t* ref_tex, VkDeviceMemory memory, VkDeviceSize offset) {
+	VkResult vr = vkBindImageMemory(_skr_vk.device, ref_tex->image, memory, offset);
+	if (vr != VK_SUCCESS) {
+		skr_log(skr_log_critical, "vkBindImageMemory failed");
+		return skr_err_device_error;
+	}
 
 	// Initialize layout tracking BEFORE any transitions
 	// This must happen before _skr_tex_upload_data or _skr_tex_transition calls
 	// since those functions update current_layout
-	out_tex->current_layout       = VK_IMAGE_LAYOUT_UNDEFINED;
-	out_tex->current_queue_family = _skr_vk.graphics_queue_family;
-	out_tex->first_use            = true;
-	// Transient discard optimization for non-readable depth/MSAA (tile GPU optimization)
-	out_tex->is_transient_discard = (is_msaa_attachment || (is_depth && !(flags & skr_tex_flags_readable)));
-
-	// Upload texture data if provided (or just transition to shader read layout)
-	if (opt_data && opt_data->data) {
-		skr_err_ upload_err = _skr_tex_upload_data(out_tex, opt_data);
-		if (upload_err != skr_err_success) {
-			vkFreeMemory  (_skr_vk.device, out_tex->memory, NULL);
-			vkDestroyImage(_skr_vk.device, out_tex->image,  NULL);
-			*out_tex = (skr_tex_t){0};
-			return upload_err;
-		}
-	} else if (!is_msaa_attachment && !(out_tex->flags & skr_tex_flags_writeable)) {
-		// No data provided, transition to appropriate layout for read-only textures
-		// Skip for transient MSAA attachments - they don't need initial layout transition
-		// Skip for writeable textures - let the first render pass handle the transition
-
-		_skr_cmd_ctx_t ctx = _skr_cmd_acquire();
-		// Use automatic transition system - handles storage vs regular textures
-		if (out_tex->flags & skr_tex_flags_compute) { _skr_tex_transition_for_storage    (ctx.cmd, out_tex); }
-		else                                        { _skr_tex_transition_for_shader_read(ctx.cmd, out_tex, VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT); }
-		_skr_cmd_release(ctx.cmd);
-	}
+	ref_tex->current_layout       = VK_IMAGE_LAYOUT_UNDEFINED;
+	ref_tex->current_queue_family = _skr_vk.graphics_queue_family;
+	ref_tex->first_use            = true;
 
 	// Create image view
 	VkImageViewType view_type = VK_IMAGE_VIEW_TYPE_2D;
-	if      (out_tex->flags & skr_tex_flags_3d     ) view_type = VK_IMAGE_VIEW_TYPE_3D;
-	else if (out_tex->flags & skr_tex_flags_cubemap) view_type = VK_IMAGE_VIEW_TYPE_CUBE;
-	else if (out_tex->flags & skr_tex_flags_array  ) view_type = VK_IMAGE_VIEW_TYPE_2D_ARRAY;
+	if      (ref_tex->flags & skr_tex_flags_3d     ) view_type = VK_IMAGE_VIEW_TYPE_3D;
+	else if (ref_tex->flags & skr_tex_flags_cubemap) view_type = VK_IMAGE_VIEW_TYPE_CUBE;
+	else if (ref_tex->flags & skr_tex_flags_array  ) view_type = VK_IMAGE_VIEW_TYPE_2D_ARRAY;
 
 	VkImageViewCreateInfo view_info = {
 		.sType    = VK_STRUCTURE_TYPE_IMAGE_VIEW_CREATE_INFO,
-		.image    = out_tex->image,
+		.image    = ref_tex->image,
 		.viewType = view_type,
-		.format   = vk_format,
+		.format   = skr_tex_fmt_to_native(ref_tex->format),
 		.subresourceRange = {
-			.aspectMask     = out_tex->aspect_mask,
+			.aspectMask     = ref_tex->aspect_mask,
 			.baseMipLevel   = 0,
-			.levelCount     = image_info.mipLevels,
+			.levelCount     = ref_tex->mip_levels,
 			.baseArrayLayer = 0,
-			.layerCount     = image_info.arrayLayers,
+			.layerCount     = ref_tex->layer_count,
 		},
 	};
 
-	vr = vkCreateImageView(_skr_vk.device, &view_info, NULL, &out_tex->view);
+	vr = vkCreateImageView(_skr_vk.device, &view_info, NULL, &ref_tex->view);
 	if (vr != VK_SUCCESS) {
 		skr_log(skr_log_critical, "vkCreateImageView failed");
+		return skr_err_device_error;
+	}
+
+	// Store texture properties
+	ref_tex->sampler = _skr_sampler_cache_acquire(ref_tex->sampler_settings);
+	return skr_err_success;
+}
+
+skr_err_ skr_tex_create(skr_tex_fmt_ format, skr_tex_flags_ flags, skr_tex_sampler_t sampler, skr_vec3i_t size, int32_t multisample, int32_t mip_count, const skr_tex_data_t* opt_data, skr_tex_t* out_tex) {
+	if (!out_tex) return skr_err_invalid_parameter;
+
+	// Zero out immediately
+	*out_tex = (skr_tex_t){0};
+
+	// YUV formats use a completely separate creation path
+	if (_skr_tex_fmt_is_yuv(format)) {
+		return _skr_tex_create_yuv(format, sampler, size, opt_data, out_tex);
+	}
+
+	bool     lazy_memory = false;
+	bool     host_upload = false;
+	skr_err_ err         = _skr_tex_create_unbound(format, flags, sampler, size, multisample, mip_count, opt_data && opt_data->data, out_tex, &lazy_memory, &host_upload);
+	if (err != skr_err_success) return err;
+
+	// Allocate memory using helper
+	if (_skr_allocate_image_memory(_skr_vk.device, out_tex->image, lazy_memory, &out_tex->memory) == VK_NULL_HANDLE) {
+		skr_log(skr_log_critical, "Failed to allocate texture memory - Format: %d, Size: %dx%dx%d, Mips: %d, Layers: %d, Samples: %d, Flags: 0x%x",
+			format, size.x, size.y, size.z, out_tex->mip_levels, out_tex->layer_count, out_tex->samples, out_tex->flags);
+		vkDestroyImage(_skr_vk.device, out_tex->image, NULL);
+		*out_tex = (skr_tex_t){0};
+		return skr_err_out_of_memory;
+	}
+
+	err = _skr_tex_bind_memory(out_tex, out_tex->memory, 0);
+	if (err != skr_err_success) {
 		vkFreeMemory  (_skr_vk.device, out_tex->memory, NULL);
 		vkDestroyImage(_skr_vk.device, out_tex->image,  NULL);
 		*out_tex = (skr_tex_t){0};
-		return skr_err_device_error;
+		return err;
 	}
 
-	// Store texture properties
-	out_tex->sampler = _skr_sampler_cache_acquire(sampler);
+	// Upload texture data if provided (or just transition to shader read layout)
+	if (opt_data && opt_data->data) {
+		skr_err_ upload_err = skr_err_failure;
+#ifdef VK_EXT_HOST_IMAGE_COPY_EXTENSION_NAME
+		if (host_upload && _skr_tex_upload_data_host(out_tex, opt_data)) upload_err = skr_err_success;
+#endif
+		if (upload_err != skr_err_success) upload_err = _skr_tex_upload_data(out_tex, opt_data);
+		if (upload_err != skr_err_success) {
+			skr_tex_destroy(out_tex);
+			return upload_err;
+		}
+	} else if (!lazy_memory && !(out_tex->flags & skr_tex_flags_writeable)) {
+		// No data provided, transition to appropriate layout for read-only textures
+		// Skip for transient MSAA attachments - they don't need initial layout transition
+		// Skip for writeable textures - let the first render pass handle the transition
+
+		_skr_cmd_ctx_t ctx = _skr_cmd_acquire();
+		// Use automatic transition system - handles storage vs regular textures
+		if (out_tex->flags & skr_tex_flags_compute) { _skr_tex_transition_for_storage    (ctx.cmd, out_tex); }
+		else                                        { _skr_tex_transition_for_shader_read(ctx.cmd, out_tex, VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT); }
+		_skr_cmd_release(ctx.cmd);
+	}
 
 	return skr_err_success;
 }
@@ -1034,11 +1185,16 @@ skr_err_ skr_tex_create(skr_tex_fmt_ format, skr_tex_flags_ flags, skr_tex_sampl
 void skr_tex_destroy(skr_tex_t* ref_tex) {
 	if (!ref_tex) return;
 
+	// Drop out of the deferred transition queue
+	if (ref_tex->pending_transition != 0) {
+		_skr_vk.pending_transitions[ref_tex->pending_transition - 1] = NULL;
+	}
+
+	_skr_material_sets_invalidate(&(uint64_t){ (uint64_t)ref_tex->view }, 1);
 	_skr_cmd_destroy_framebuffer(NULL, ref_tex->framebuffer);
 	_skr_cmd_destroy_framebuffer(NULL, ref_tex->framebuffer_depth);
-	// Only release from sampler cache if we acquired from it (not YCbCr immutable samplers)
-	if (ref_tex->ycbcr_sampler == VK_NULL_HANDLE) {
-		_skr_sampler_cache_release(ref_tex->sampler_settings);
+	if (ref_tex->bindless_slot != 0) {
+		_skr_cmd_destroy_bindless_slot(NULL, false, ref_tex->bindless_slot - 1);
 	}
 	_skr_cmd_destroy_image_view (NULL, ref_tex->view);
 
@@ -1100,14 +1256,12 @@ void skr_tex_set_sampler(skr_tex_t* ref_tex, skr_tex_sampler_t sampler) {
 	// YCbCr textures use immutable samplers that can't be changed
 	if (ref_tex->ycbcr_sampler != VK_NULL_HANDLE) return;
 
-	// Release old sampler from cache
-	if (ref_tex->sampler != VK_NULL_HANDLE) {
-		_skr_sampler_cache_release(ref_tex->sampler_settings);
-	}
-
-	// Acquire new sampler from cache and update settings
+	// Acquire new sampler from cache and update settings, the old one stays
+	// cached for whoever uses it next
 	ref_tex->sampler          = _skr_sampler_cache_acquire(sampler);
 	ref_tex->sampler_settings = sampler;
+
+	_skr_bindless_tex_update(ref_tex);
 }
 
 skr_err_ skr_tex_set_data(skr_tex_t* ref_tex, const skr_tex_data_t* data) {
@@ -1213,6 +1367,7 @@ static void _skr_tex_generate_mips_blit(VkPhysicalDevice phys_device, skr_tex_t*
 			.dstOffsets[1] = {next_mip_width, next_mip_height, 1},
 		};
 
+		_skr_barrier_flush(ctx.cmd);
 		vkCmdBlitImage(ctx.cmd,
 			ref_tex->image, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL,
 			ref_tex->image, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
@@ -1272,6 +1427,7 @@ static void _skr_tex_generate_mips_render(VkDevice device, skr_tex_t* ref_tex, i
 		.samples        = VK_SAMPLE_COUNT_1_BIT,
 		.depth_store_op = VK_ATTACHMENT_STORE_OP_DONT_CARE,
 		.color_load_op  = VK_ATTACHMENT_LOAD_OP_DONT_CARE,  // Full blit
+		.depth_load_op  = VK_ATTACHMENT_LOAD_OP_DONT_CARE,
 	};
 	int32_t renderpass_idx = _skr_pipeline_register_renderpass_unlocked(&rp_key);
 	int32_t vert_idx       = _skr_pipeline_register_vertformat_unlocked((skr_vert_type_t){0});
@@ -1317,10 +1473,12 @@ static void _skr_tex_generate_mips_render(VkDevice device, skr_tex_t* ref_tex, i
 	uint8_t*     all_params     = NULL;
 	skr_buffer_t params_buffer  = {0};
 	uint32_t     aligned_stride = 0;
+	bool         push_params    = material.key.shader->push_range.size > 0;
 
 	if (material.param_buffer_size > 0) {
-		// Align stride to minUniformBufferOffsetAlignment for descriptor offsets
-		uint32_t align = _skr_vk.min_ubo_offset_align;
+		// Align stride to minUniformBufferOffsetAlignment for descriptor offsets,
+		// push constants are copied straight from the CPU array
+		uint32_t align = push_params ? 1 : _skr_vk.min_ubo_offset_align;
 		aligned_stride = (material.param_buffer_size + align - 1) & ~(align - 1);
 
 		all_params = _skr_calloc(num_mips, aligned_stride);
@@ -1345,8 +1503,11 @@ static void _skr_tex_generate_mips_render(VkDevice device, skr_tex_t* ref_tex, i
 		}
 
 		// Create GPU buffer with all mip parameters
-		skr_buffer_create(all_params, num_mips, aligned_stride, skr_buffer_type_constant, skr_use_static, &params_buffer);
-		_skr_free(all_params);
+		if (!push_params) {
+			skr_buffer_create(all_params, num_mips, aligned_stride, skr_buffer_type_constant, skr_use_static, &params_buffer);
+			_skr_free(all_params);
+			all_params = NULL;
+		}
 	}
 
 	// Generate each mip level by rendering from previous mip
@@ -1423,26 +1584,13 @@ static void _skr_tex_generate_mips_render(VkDevice device, skr_tex_t* ref_tex, i
 			_skr_cmd_destroy_image_view(ctx.destroy_list, src_view);
 		}
 
-		// Transition current mip to color attachment (automatic tracking handles UNDEFINED vs previous layout)
-		VkImageMemoryBarrier barrier = {
-			.sType               = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER,
-			.srcAccessMask       = 0,
-			.dstAccessMask       = VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT,
-			.oldLayout           = VK_IMAGE_LAYOUT_UNDEFINED,
-			.newLayout           = VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL,
-			.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED,
-			.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED,
-			.image               = ref_tex->image,
-			.subresourceRange    = {
-				.aspectMask     = VK_IMAGE_ASPECT_COLOR_BIT,
-				.baseMipLevel   = mip,
-				.levelCount     = 1,
-				.baseArrayLayer = 0,
-				.layerCount     = ref_tex->layer_count,
-			},
-		};
-		vkCmdPipelineBarrier(ctx.cmd, VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT,
-		                     0, 0, NULL, 0, NULL, 1, &barrier);
+		// Transition current mip to color attachment, batched with the previous
+		// mip's transition to shader read
+		_skr_transition_image_layout(ctx.cmd, ref_tex->image, VK_IMAGE_ASPECT_COLOR_BIT, mip, 1, ref_tex->layer_count,
+			VK_IMAGE_LAYOUT_UNDEFINED, VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL,
+			VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT,
+			0, VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT);
+		_skr_barrier_flush(ctx.cmd);
 
 		// Begin render pass
 		vkCmdBeginRenderPass(ctx.cmd, &(VkRenderPassBeginInfo){
@@ -1455,6 +1603,11 @@ static void _skr_tex_generate_mips_render(VkDevice device, skr_tex_t* ref_tex, i
 
 		// Bind pipeline
 		vkCmdBindPipeline(ctx.cmd, VK_PIPELINE_BIND_POINT_GRAPHICS, pipeline);
+		if (_skr_pipeline_is_bindless(material.pipeline_material_idx))
+			_skr_bindless_bind(ctx.cmd, VK_PIPELINE_BIND_POINT_GRAPHICS, _skr_pipeline_get_layout(material.pipeline_material_idx));
+		if (all_params)
+			vkCmdPushConstants(ctx.cmd, _skr_pipeline_get_layout(material.pipeline_material_idx), material.key.shader->push_range.stageFlags,
+				0, material.param_buffer_size, all_params + (mip - 1) * aligned_stride);
 
 		// Set viewport and scissor
 		VkViewport viewport = {0, 0, (float)mip_width, (float)mip_height, 0.0f, 1.0f};
@@ -1506,7 +1659,6 @@ static void _skr_tex_generate_mips_render(VkDevice device, skr_tex_t* ref_tex, i
 			bind_source.slot                                               // Source texture (per-mip, handled above)
 		};
 
-		_skr_bind_pool_lock();
 		int32_t fail_idx = _skr_material_add_writes(
 			_skr_bind_pool_get(material.bind_start), material.bind_count,
 			ignore_slots, sizeof(ignore_slots)/sizeof(ignore_slots[0]),
@@ -1515,7 +1667,6 @@ static void _skr_tex_generate_mips_render(VkDevice device, skr_tex_t* ref_tex, i
 			image_infos,  sizeof(image_infos )/sizeof(image_infos [0]),
 			&write_ct, &buffer_ct, &image_ct
 		);
-		_skr_bind_pool_unlock();
 
 		if (fail_idx >= 0) {
 			const sksc_shader_meta_t* meta = material.key.shader->meta;
@@ -1525,10 +1676,10 @@ static void _skr_tex_generate_mips_render(VkDevice device, skr_tex_t* ref_tex, i
 		}
 
 		// Push descriptors and draw
-		_skr_bind_descriptors(
+		// Source views are per-mip and short lived, so skip the set cache
+		_skr_bind_material_descriptors(
 			ctx.cmd, ctx.descriptor_pool, VK_PIPELINE_BIND_POINT_GRAPHICS,
-			_skr_pipeline_get_layout           (material.pipeline_material_idx),
-			_skr_pipeline_get_descriptor_layout(material.pipeline_material_idx),
+			material.pipeline_material_idx, -1,
 			writes, write_ct);
 
 		// Draw fullscreen triangle (with instances for each layer/face)
@@ -1538,17 +1689,17 @@ static void _skr_tex_generate_mips_render(VkDevice device, skr_tex_t* ref_tex, i
 		vkCmdEndRenderPass(ctx.cmd);
 
 		// Transition current mip to shader read for next iteration
-		barrier.srcAccessMask = VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT;
-		barrier.dstAccessMask = VK_ACCESS_SHADER_READ_BIT;
-		barrier.oldLayout     = VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL;
-		barrier.newLayout     = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
-		vkCmdPipelineBarrier( ctx.cmd, VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT, VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT, 0, 0, NULL, 0, NULL, 1, &barrier);
+		_skr_transition_image_layout(ctx.cmd, ref_tex->image, VK_IMAGE_ASPECT_COLOR_BIT, mip, 1, ref_tex->layer_count,
+			VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL,
+			VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT, VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT,
+			VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT, VK_ACCESS_SHADER_READ_BIT);
 	}
 
 	_skr_cmd_release(ctx.cmd);
 	_skr_pipeline_unlock();
 
 	// Destroy after unlocking - skr_material_destroy internally locks the pipeline mutex
+	if (all_params) _skr_free(all_params);
 	skr_buffer_destroy  (&params_buffer);
 	skr_material_destroy(&material);
 }
@@ -1610,8 +1761,6 @@ VkSampler _skr_sampler_create_vk(VkDevice device, skr_tex_sampler_t settings) {
 // Sampler cache implementation
 ///////////////////////////////////////////////////////////////////////////////
 
-#define SKR_SAMPLER_CACHE_INITIAL_CAPACITY 16
-
 static bool _skr_sampler_settings_equal(skr_tex_sampler_t a, skr_tex_sampler_t b) {
 	return a.sample         == b.sample &&
 	       a.address        == b.address &&
@@ -1619,21 +1768,59 @@ static bool _skr_sampler_settings_equal(skr_tex_sampler_t a, skr_tex_sampler_t b
 	       a.anisotropy     == b.anisotropy;
 }
 
+static uint32_t _skr_sampler_hash(skr_tex_sampler_t settings) {
+	uint32_t fields[] = { (uint32_t)settings.sample, (uint32_t)settings.address, (uint32_t)settings.sample_compare, (uint32_t)settings.anisotropy };
+	uint64_t hash     = 14695981039346656037ULL;
+	for (uint32_t i = 0; i < sizeof(fields)/sizeof(fields[0]); i++) {
+		hash ^= fields[i];
+		hash *= 1099511628211ULL;
+	}
+	return (uint32_t)(hash ^ (hash >> 32));
+}
+
+// Caller holds the lock. Returns the matching entry, or the empty slot it
+// would go in.
+static _skr_sampler_entry_t* _skr_sampler_cache_slot(_skr_sampler_entry_t* entries, uint32_t capacity, skr_tex_sampler_t settings) {
+	uint32_t at = _skr_sampler_hash(settings);
+	while (true) {
+		_skr_sampler_entry_t* entry = &entries[at & (capacity - 1)];
+		if (entry->sampler == VK_NULL_HANDLE || _skr_sampler_settings_equal(entry->settings, settings)) return entry;
+		at++;
+	}
+}
+
+// Caller holds the lock. Doubles the table and rehashes every entry into it.
+static bool _skr_sampler_cache_grow(_skr_sampler_cache_t* ref_cache) {
+	uint32_t              capacity = ref_cache->capacity ? ref_cache->capacity * 2 : SKR_SAMPLER_CACHE_MIN_SLOTS;
+	_skr_sampler_entry_t* entries  = _skr_calloc(capacity, sizeof(_skr_sampler_entry_t));
+	if (!entries) return false;
+
+	for (uint32_t i = 0; i < ref_cache->capacity; i++) {
+		if (ref_cache->entries[i].sampler != VK_NULL_HANDLE)
+			*_skr_sampler_cache_slot(entries, capacity, ref_cache->entries[i].settings) = ref_cache->entries[i];
+	}
+	_skr_free(ref_cache->entries);
+	ref_cache->entries  = entries;
+	ref_cache->capacity = capacity;
+	return true;
+}
+
 void _skr_sampler_cache_init(void) {
 	_skr_sampler_cache_t* cache = &_skr_vk.sampler_cache;
 
 	mtx_init(&cache->mutex, mtx_plain);
 
-	cache->capacity = SKR_SAMPLER_CACHE_INITIAL_CAPACITY;
+	cache->entries  = NULL;
+	cache->capacity = 0;
 	cache->count    = 0;
-	cache->entries  = _skr_calloc(cache->capacity, sizeof(_skr_sampler_entry_t));
+	_skr_sampler_cache_grow(cache);
 }
 
 void _skr_sampler_cache_shutdown(void) {
 	_skr_sampler_cache_t* cache = &_skr_vk.sampler_cache;
 
 	// Destroy all cached samplers
-	for (uint32_t i = 0; i < cache->count; i++) {
+	for (uint32_t i = 0; cache->entries && i < cache->capacity; i++) {
 		if (cache->entries[i].sampler != VK_NULL_HANDLE) {
 			vkDestroySampler(_skr_vk.device, cache->entries[i].sampler, NULL);
 		}
@@ -1651,13 +1838,16 @@ VkSampler _skr_sampler_cache_acquire(skr_tex_sampler_t settings) {
 
 	mtx_lock(&cache->mutex);
 
-	// Search for existing sampler with matching settings
-	for (uint32_t i = 0; i < cache->count; i++) {
-		if (_skr_sampler_settings_equal(cache->entries[i].settings, settings)) {
-			cache->entries[i].ref_count++;
-			result = cache->entries[i].sampler;
-			goto done;
-		}
+	// Keep the table at most 3/4 full so probes stay short and always end
+	if ((cache->count + 1) * 4 > cache->capacity * 3 && !_skr_sampler_cache_grow(cache)) {
+		skr_log(skr_log_critical, "Failed to grow sampler cache");
+		goto done;
+	}
+
+	_skr_sampler_entry_t* entry = _skr_sampler_cache_slot(cache->entries, cache->capacity, settings);
+	if (entry->sampler != VK_NULL_HANDLE) {
+		result = entry->sampler;
+		goto done;
 	}
 
 	// Not found, create new sampler (this can be slow, but happens rarely)
@@ -1666,53 +1856,15 @@ VkSampler _skr_sampler_cache_acquire(skr_tex_sampler_t settings) {
 		goto done;
 	}
 
-	// Grow cache if needed
-	if (cache->count >= cache->capacity) {
-		uint32_t new_capacity = cache->capacity * 2;
-		_skr_sampler_entry_t* new_entries = _skr_realloc(cache->entries, new_capacity * sizeof(_skr_sampler_entry_t));
-		if (!new_entries) {
-			skr_log(skr_log_warning, "Failed to grow sampler cache, sampler will not be cached");
-			// Return the sampler anyway - it just won't be cached for reuse
-			goto done;
-		}
-		cache->entries  = new_entries;
-		cache->capacity = new_capacity;
-	}
-
-	// Add new entry
-	cache->entries[cache->count++] = (_skr_sampler_entry_t){
-		.settings  = settings,
-		.sampler   = result,
-		.ref_count = 1,
-	};
+	entry->settings = settings;
+	entry->sampler  = result;
+	cache->count++;
 
 done:
 	mtx_unlock(&cache->mutex);
 	return result;
 }
 
-void _skr_sampler_cache_release(skr_tex_sampler_t settings) {
-	_skr_sampler_cache_t* cache = &_skr_vk.sampler_cache;
-
-	mtx_lock(&cache->mutex);
-
-	// Find the entry and decrement ref count
-	// We don't destroy samplers when ref hits zero because the GPU might still
-	// be using them. Samplers are tiny (~64 bytes) and reused, so keeping them
-	// until shutdown is fine. They'll be destroyed in _skr_sampler_cache_shutdown.
-	for (uint32_t i = 0; i < cache->count; i++) {
-		if (_skr_sampler_settings_equal(cache->entries[i].settings, settings)) {
-			if (cache->entries[i].ref_count > 0) {
-				cache->entries[i].ref_count--;
-			}
-			mtx_unlock(&cache->mutex);
-			return;
-		}
-	}
-
-	mtx_unlock(&cache->mutex);
-}
-
 ///////////////////////////////////////////////////////////////////////////////
 
 bool skr_tex_fmt_is_supported(skr_tex_fmt_ format, skr_tex_flags_ flags, int32_t multisample) {
@@ -1992,6 +2144,7 @@ skr_err_ skr_tex_update_external(skr_tex_t* ref_tex, skr_tex_external_update_t u
 	ref_tex->image = update.image;
 
 	if (old_view != VK_NULL_HANDLE) {
+		_skr_material_sets_invalidate(&(uint64_t){ (uint64_t)old_view }, 1);
 		_skr_cmd_destroy_image_view(NULL, old_view);
 	}
 
@@ -2749,6 +2902,7 @@ skr_err_ skr_tex_copy(const skr_tex_t* src, skr_tex_t* dst,
 			.extent    = {src_width, src_height, 1},
 		};
 
+		_skr_barrier_flush(ctx.cmd);
 		vkCmdResolveImage(ctx.cmd,
 			src->image, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL,
 			dst->image, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
@@ -2773,6 +2927,7 @@ skr_err_ skr_tex_copy(const skr_tex_t* src, skr_tex_t* dst,
 			.extent    = {src_width, src_height, 1},
 		};
 
+		_skr_barrier_flush(ctx.cmd);
 		vkCmdCopyImage(ctx.cmd,
 			src->image, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL,
 			dst->image, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
@@ -2842,6 +2997,7 @@ skr_err_ skr_tex_create_copy(const skr_tex_t* src, skr_tex_fmt_ format, skr_tex_
 					.extent    = {mip_size.x, mip_size.y, 1},
 				};
 
+				_skr_barrier_flush(ctx.cmd);
 				vkCmdResolveImage(ctx.cmd,
 					src->image, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL,
 					out_tex->image, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
@@ -2865,6 +3021,7 @@ skr_err_ skr_tex_create_copy(const skr_tex_t* src, skr_tex_fmt_ format, skr_tex_
 					.extent    = {mip_size.x, mip_size.y, 1},
 				};
 
+				_skr_barrier_flush(ctx.cmd);
 				vkCmdCopyImage(ctx.cmd,
 					src->image, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL,
 					out_tex->image, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
@@ -3002,6 +3159,7 @@ skr_err_ skr_tex_readback(const skr_tex_t* tex, uint32_t mip_level, uint32_t arr
 		.imageExtent = {mip_size.x, mip_size.y, mip_size.z},
 	};
 
+	_skr_barrier_flush(ctx.cmd);
 	vkCmdCopyImageToBuffer(ctx.cmd, tex->image, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL, staging_buffer, 1, &copy_region);
 
 	// Transition texture back to shader-readable
@@ -9,13 +9,23 @@
 
 #define SKR_MAX_FRAMES_IN_FLIGHT 3
 #define SKR_MAX_SURFACES 2  // Maximum surfaces for VR stereo rendering
+#define SKR_BUFFER_STALE_RANGES 4  // Per ring slot, nearby ranges merge past this
 
 // Future type for tracking command buffer completion (must be before skr_surface_t)
 typedef struct skr_future_t {
-	void*    slot;          // Pointer to _skr_cmd_ring_slot_t
-	uint64_t generation;    // Generation counter to detect fence reuse (must match slot's generation)
+	VkSemaphore timeline;   // Timeline semaphore of the submitting thread, VK_NULL_HANDLE = already done
+	uint64_t    value;      // Work is complete once the timeline reaches this value
 } skr_future_t;
 
+// Tracks unsynchronized GPU access to a resource written by compute, so a
+// barrier only goes out when a later command depends on it
+typedef struct skr_hazard_t {
+	uint32_t             epoch;        // Hazard epoch of the last access, older state is already visible
+	VkPipelineStageFlags write_stage;  // Stage of the pending write, 0 = none
+	VkAccessFlags        write_access;
+	VkPipelineStageFlags read_stage;   // Stages reading since the last barrier (write-after-read)
+} skr_hazard_t;
+
 // Texture readback handle for async GPU->CPU texture data transfer
 typedef struct skr_tex_readback_t {
 	void*        data;      // CPU-accessible data pointer (valid after future completes)
@@ -24,6 +34,14 @@ typedef struct skr_tex_readback_t {
 	void*        _internal; // Internal state (staging buffer/memory) - do not access directly
 } skr_tex_readback_t;
 
+// Buffer readback handle for async GPU->CPU buffer data transfer
+typedef struct skr_buffer_readback_t {
+	void*        data;      // CPU-accessible data pointer (valid after future completes)
+	uint32_t     size;      // Data size in bytes
+	skr_future_t future;    // Poll with skr_future_check(), block with skr_future_wait()
+	void*        _internal; // Internal state (pooled staging buffer) - do not access directly
+} skr_buffer_readback_t;
+
 typedef struct skr_buffer_t {
 	VkBuffer            buffer;  // Current buffer for binding (= _ring[_ring_index] if ring active)
 	VkDeviceMemory      memory;  // Current memory
@@ -38,9 +56,15 @@ typedef struct skr_buffer_t {
 		VkBuffer       buffer;
 		VkDeviceMemory memory;
 		void*          mapped;
+		uint32_t       stale_offset[SKR_BUFFER_STALE_RANGES]; // Bytes written to other slots since this one was current
+		uint32_t       stale_size  [SKR_BUFFER_STALE_RANGES];
+		uint8_t        stale_count;
 	}                   _ring[SKR_MAX_FRAMES_IN_FLIGHT];
 	uint8_t             _ring_count;  // Slots allocated so far (0 = no ring, use top-level fields)
 	uint8_t             _ring_index;  // Current active slot for reading
+	bool                _non_coherent; // Mapped memory needs explicit flush/invalidate
+	skr_hazard_t        _hazard;       // Pending compute access
+	uint32_t            bindless_slot; // Index + 1 in the bindless buffer table, 0 = not registered
 } skr_buffer_t;
 
 typedef struct skr_vert_type_t {
@@ -89,6 +113,9 @@ typedef struct skr_tex_t {
 	bool                   first_use;            // True until first transition (allows UNDEFINED optimization)
 	bool                   is_transient_discard; // True for non-readable depth/MSAA (always use UNDEFINED)
 	bool                   is_external;          // True if image/memory are externally owned (don't destroy)
+	uint32_t               pending_transition;   // Index + 1 in the deferred transition queue, 0 = not queued
+	skr_hazard_t           hazard;               // Pending compute access (storage images stay in GENERAL)
+	uint32_t               bindless_slot;        // Index + 1 in the bindless texture table, 0 = not registered
 
 	// YCbCr conversion (Vulkan 1.1) for opaque YUV textures (e.g. AHB video frames)
 	VkSamplerYcbcrConversion ycbcr_conversion;   // VK_NULL_HANDLE if unused
@@ -180,6 +207,9 @@ typedef struct skr_shader_t {
 	skr_shader_stage_t  vertex_stage;
 	skr_shader_stage_t  pixel_stage;
 	skr_shader_stage_t  compute_stage;
+	bool                bindless;      // Uses the global bindless tables at set SKSC_BINDLESS_SPACE
+	VkPushConstantRange push_range;    // Material params as push constants, size 0 when they're a UBO
+	uint32_t            reloads;       // Bumped by skr_shader_reload, computes rebuild their pipeline when it moves
 } skr_shader_t;
 
 typedef struct  {
@@ -204,8 +234,8 @@ typedef struct {
 	bool                 depth_clamp;
 	skr_stencil_state_t  stencil_front;
 	skr_stencil_state_t  stencil_back;
-#define SKR_MAX_IMMUTABLE_SAMPLERS 2
-	VkSampler            immutable_samplers[SKR_MAX_IMMUTABLE_SAMPLERS];      // Immutable samplers for YCbCr textures (VK_NULL_HANDLE = unused)
+#define SKR_MAX_IMMUTABLE_SAMPLERS 8
+	VkSampler            immutable_samplers[SKR_MAX_IMMUTABLE_SAMPLERS];      // Immutable samplers for YCbCr textures, or all textures with skr_material_info_t::immutable_samplers (VK_NULL_HANDLE = unused)
 	int32_t              immutable_sampler_slots[SKR_MAX_IMMUTABLE_SAMPLERS];  // Descriptor binding slots (sorted by slot for deterministic memcmp)
 	int32_t              immutable_sampler_count;                              // Number of active immutable samplers
 } _skr_pipeline_material_key_t;
@@ -214,15 +244,19 @@ typedef struct skr_material_t {
 	int32_t                      pipeline_material_idx; // Index into pipeline cache
 	_skr_pipeline_material_key_t key;                   // Pipeline-affecting state
 	int32_t                      queue_offset;          // Render queue offset (not pipeline-affecting)
+	bool                         immutable_samplers;    // Bake every texture's sampler into the key, not just YCbCr ones
+	sksc_shader_meta_t*          meta;                  // The shader's meta this material holds a reference to
 
 	int32_t                bind_start;            // Index into global bind pool (-1 if none)
 	uint32_t               bind_count;
 	// Material parameters
 	void*                  param_buffer;          // CPU-side parameter data
 	uint32_t               param_buffer_size;     // Size of parameter buffer in bytes
+	uint64_t               param_generation;      // Material serial in the high bits, bumped on every param write
 
 	bool                   has_system_buffer;
 	uint32_t               instance_buffer_stride; // Element size of instance buffer (0 = no instance buffer)
+	int32_t                atlas_layer_offset;     // Offset of a uint atlas_layer param (-1 if none)
 } skr_material_t;
 
 // Pooled GPU buffer with future for tracking completion
@@ -237,6 +271,7 @@ typedef struct skr_compute_t {
 	VkPipelineLayout       layout;
 	VkDescriptorSetLayout  descriptor_layout;
 	VkPipeline             pipeline;
+	uint32_t               shader_reloads; // shader->reloads the pipeline was built from
 
 	skr_material_bind_t*   binds;
 	uint32_t               bind_count;
@@ -265,6 +300,7 @@ typedef struct skr_render_item_t {
 	int32_t     index_count;          // Number of indices (0 = use mesh ind_count)
 	int32_t     vertex_offset;        // Base vertex offset
 	int32_t     bind_start;           // Index into bind pool (bind pool uses deferred destruction)
+	uint32_t    batch_hash;           // Bind contents and params, matching items can share a draw across materials
 
 	// 2-byte aligned (max 65535 is plenty for these)
 	uint16_t    pipeline_vert_idx;      // From mesh->vert_type->pipeline_idx
@@ -272,14 +308,27 @@ typedef struct skr_render_item_t {
 	uint16_t    param_buffer_size;      // From material->param_buffer_size
 	uint16_t    instance_buffer_stride; // From material->instance_buffer_stride
 	uint16_t    instance_data_size;     // Size per instance (bytes)
+	uint16_t    atlas_layer_offset;     // Param moved into instance data, left out of merge compares (SKR_NO_ATLAS_LAYER if none)
 
 	// 1-byte aligned (small values)
 	uint8_t     vertex_buffer_count;  // From mesh->vertex_buffer_count (max SKR_MAX_VERTEX_BUFFERS=2)
 	uint8_t     bind_count;           // From material->bind_count (textures+buffers, rarely >32)
 	uint8_t     index_format;         // From mesh->ind_format_vk (VkIndexType: 0=uint16, 1=uint32)
 	uint8_t     has_system_buffer;    // From material->has_system_buffer (bool)
+	uint8_t     push_params;          // Params go out as push constants instead of a UBO (bool)
 } skr_render_item_t;
 
+#define SKR_NO_ATLAS_LAYER 0xFFFF
+
+// A material param block already copied into a render list's material_data
+#define SKR_PARAM_DEDUP_SLOTS 64
+typedef struct _skr_param_dedup_t {
+	const void* params;      // Material param_buffer the block came from, NULL when empty
+	uint64_t    generation;  // Material param_generation at copy time
+	uint32_t    offset;      // Offset of the copy in material_data
+	uint32_t    hash;        // Hash of the copied bytes
+} _skr_param_dedup_t;
+
 typedef struct skr_render_list_t {
 	skr_render_item_t* items;
 	uint32_t           count;
@@ -292,5 +341,47 @@ typedef struct skr_render_list_t {
 	uint8_t*           material_data;
 	uint32_t           material_data_used;
 	uint32_t           material_data_capacity;
+	bool               material_data_ubo;  // Some item reads its params from a UBO, so material_data needs uploading
+	_skr_param_dedup_t param_dedup[SKR_PARAM_DEDUP_SLOTS]; // Param blocks already in material_data, direct mapped
 	bool               needs_sort;  // Dirty flag for sorting
 } skr_render_list_t;
+
+// Render graph, the internal types live in skr_graph.c
+typedef struct _skr_graph_res_t   _skr_graph_res_t;
+typedef struct _skr_graph_pass_t  _skr_graph_pass_t;
+typedef struct _skr_graph_use_t   _skr_graph_use_t;
+typedef struct _skr_graph_phys_t  _skr_graph_phys_t;
+typedef struct _skr_graph_heap_t  _skr_graph_heap_t;
+
+typedef struct skr_graph_t {
+	// Description of the current frame, reset by skr_graph_clear
+	_skr_graph_res_t*  resources;          // skr_graph_res_t is index + 1
+	uint32_t           resource_count;
+	uint32_t           resource_capacity;
+	_skr_graph_pass_t* passes;
+	uint32_t           pass_count;
+	uint32_t           pass_capacity;
+	_skr_graph_use_t*  uses;               // Linked per pass through _skr_graph_use_t::next
+	uint32_t           use_count;
+	uint32_t           use_capacity;
+	uint32_t*          order;              // Compiled pass order, culled passes left out
+	uint32_t           order_count;
+
+	// Transient textures and the memory they alias, kept across frames
+	_skr_graph_phys_t* physical;
+	uint32_t           physical_count;
+	_skr_graph_heap_t* heaps;
+	uint32_t           heap_count;
+	uint64_t           layout_hash;        // Transient descriptions and lifetimes the memory was placed for
+} skr_graph_t;
+
+// Texture array that same-format, same-size textures are packed into, so
+// materials using them bind identical resources and can share a draw
+typedef struct skr_tex_atlas_t {
+	skr_tex_t    tex;          // The array texture materials bind
+	uint32_t     capacity;     // Layer count, fixed at creation so the texture handle stays stable
+	uint32_t     next;         // Layers handed out so far, freed ones are reused first
+	uint32_t*    free;         // Released layers
+	uint32_t     free_count;
+	uint8_t*     used;         // Per layer, catches double removes
+} skr_tex_atlas_t;
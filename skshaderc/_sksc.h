@@ -26,13 +26,14 @@ struct sksc_ast_default_t {
 
 void                        sksc_glslang_init          ();
 void                        sksc_glslang_shutdown      ();
-compile_result_             sksc_hlsl_to_spirv         (const char *filename, const char *hlsl, const sksc_settings_t *settings, skr_stage_ type, const char** defines, int32_t define_count, sksc_shader_file_stage_t *out_stage);
+compile_result_             sksc_hlsl_to_spirv         (const char *filename, const char *hlsl, const sksc_settings_t *settings, skr_stage_ type, const char** defines, int32_t define_count, bool bindless, sksc_shader_file_stage_t *out_stage);
 
 array_t<sksc_ast_default_t> sksc_hlsl_find_initializers(const char *hlsl_text);
 bool                        sksc_hlsl_to_bytecode      (const char *filename, const char *hlsl_text, const sksc_settings_t *settings, skr_stage_ type, sksc_shader_file_stage_t *out_stage);
 
 array_t<sksc_meta_item_t>   sksc_meta_find_defaults    (const char *hlsl_text);
 void                        sksc_meta_assign_defaults  (array_t<sksc_ast_default_t> ast_defaults, array_t<sksc_meta_item_t> comment_overrides, sksc_shader_meta_t *ref_meta);
+bool                        sksc_meta_assign_push_constants(sksc_shader_meta_t *ref_meta);
 bool                        sksc_meta_check_dup_buffers  (const sksc_shader_meta_t *ref_meta);
 bool                        sksc_meta_check_dup_resources(const sksc_shader_meta_t *ref_meta, const char **out_name1, const char **out_name2, uint32_t *out_slot);
 bool                        sksc_spirv_to_meta           (const sksc_shader_file_stage_t *spirv_stage, sksc_shader_meta_t *meta);
@@ -44,6 +44,14 @@ bool sksc_compile(const char *filename, const char *hlsl_text, sksc_settings_t *
 	array_t<sksc_meta_item_t>         var_meta     = sksc_meta_find_defaults(hlsl_text);
 	array_t<sksc_ast_default_t>       ast_defaults = sksc_hlsl_find_initializers(hlsl_text);
 
+	// `//--bindless = true` opts the shader in to the renderer's bindless tables
+	bool bindless = false;
+	for (size_t i = 0; i < var_meta.count; i++) {
+		if (strcmp(var_meta[i].name, "bindless") == 0)
+			bindless = strcmp(var_meta[i].value, "true") == 0 || strcmp(var_meta[i].value, "1") == 0;
+	}
+	out_file->meta->bindless = bindless;
+
 	skr_stage_ compile_stages[3] = { skr_stage_vertex, skr_stage_pixel, skr_stage_compute };
 	char*      entrypoints   [3] = { settings->vs_entrypoint, settings->ps_entrypoint, settings->cs_entrypoint };
 	for (size_t i = 0; i < sizeof(compile_stages)/sizeof(compile_stages[0]); i++) {
@@ -52,7 +60,7 @@ bool sksc_compile(const char *filename, const char *hlsl_text, sksc_settings_t *
 
 		// Build SPIRV
 		sksc_shader_file_stage_t spirv_stage  = {};
-		compile_result_          spirv_result = sksc_hlsl_to_spirv(filename, hlsl_text, settings, compile_stages[i], NULL, 0, &spirv_stage);
+		compile_result_          spirv_result = sksc_hlsl_to_spirv(filename, hlsl_text, settings, compile_stages[i], NULL, 0, bindless, &spirv_stage);
 		if (spirv_result == compile_result_fail) {
 			sksc_log(sksc_log_level_err, "SPIRV compile failed");
 			return false;
@@ -71,6 +79,11 @@ bool sksc_compile(const char *filename, const char *hlsl_text, sksc_settings_t *
 			free(spirv_stage.code);
 	}
 
+	if (!sksc_meta_assign_push_constants(out_file->meta)) {
+		var_meta.free();
+		ast_defaults.free();
+		return false;
+	}
 	sksc_meta_assign_defaults(ast_defaults, var_meta, out_file->meta);
 	var_meta.free();
 	ast_defaults.free();
@@ -255,7 +268,8 @@ char* sksc_shader_file_info(const sksc_shader_file_t *file) {
 			sksc_shader_buffer_t *buff = &meta->buffers[i];
 			if (buff->bind.stage_bits & stage->stage) {
 				char reg[16];
-				snprintf(reg, sizeof(reg), "b%u/s%d", buff->bind.slot, buff->space);
+				if (buff->bind.register_type == skr_register_push_constant) snprintf(reg, sizeof(reg), "push");
+				else                                                        snprintf(reg, sizeof(reg), "b%u/s%d", buff->bind.slot, buff->space);
 				info.append("|  %-7s: %s", reg, buff->name);
 			}
 		}
@@ -324,7 +338,7 @@ void sksc_build_file(const sksc_shader_file_t *file, void **out_data, uint32_t *
 	file_data_t data = {};
 
 	const char tag[8] = {'S','K','S','H','A','D','E','R'};
-	uint16_t version = 5;
+	uint16_t version = 6;
 	data.write(tag);
 	data.write(version);
 
@@ -340,6 +354,7 @@ void sksc_build_file(const sksc_shader_file_t *file, void **out_data, uint32_t *
 	data.write(file->meta->ops_pixel.total);
 	data.write(file->meta->ops_pixel.tex_read);
 	data.write(file->meta->ops_pixel.dynamic_flow);
+	data.write(file->meta->bindless);
 
 	for (uint32_t i = 0; i < file->meta->buffer_count; i++) {
 		sksc_shader_buffer_t *buff = &file->meta->buffers[i];
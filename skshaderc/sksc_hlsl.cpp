@@ -110,7 +110,24 @@ void log_shader_msgs(glslang::TShader *shader) {
 
 ///////////////////////////////////////////
 
-compile_result_ sksc_hlsl_to_spirv(const char *filename, const char *hlsl, const sksc_settings_t *settings, skr_stage_ type, const char** defines, int32_t define_count, sksc_shader_file_stage_t *out_stage) {
+// Declarations for `//--bindless = true` shaders. The renderer binds its
+// global tables at space SKSC_BINDLESS_SPACE, t0 is the texture table and t1
+// the storage buffer table. Textures become combined image samplers, so the
+// sampler here is only there to satisfy HLSL's Sample syntax.
+#define SKSC_STR_(x) #x
+#define SKSC_STR(x) SKSC_STR_(x)
+static const char *sksc_bindless_header =
+	"Texture2D         skr_bindless_tex    [] : register(t0, space" SKSC_STR(SKSC_BINDLESS_SPACE) ");\n"
+	"ByteAddressBuffer skr_bindless_buffer [] : register(t1, space" SKSC_STR(SKSC_BINDLESS_SPACE) ");\n"
+	"SamplerState      skr_bindless_sampler   : register(s0, space" SKSC_STR(SKSC_BINDLESS_SPACE) ");\n"
+	"#define skr_bindless_sample(index, uv)           skr_bindless_tex[NonUniformResourceIndex(index)].Sample     (skr_bindless_sampler, uv)\n"
+	"#define skr_bindless_sample_level(index, uv, lod) skr_bindless_tex[NonUniformResourceIndex(index)].SampleLevel(skr_bindless_sampler, uv, lod)\n"
+	"#define skr_bindless_load(index, byte_offset)    skr_bindless_buffer[NonUniformResourceIndex(index)].Load(byte_offset)\n"
+	"#line 1\n";
+
+///////////////////////////////////////////
+
+compile_result_ sksc_hlsl_to_spirv(const char *filename, const char *hlsl, const sksc_settings_t *settings, skr_stage_ type, const char** defines, int32_t define_count, bool bindless, sksc_shader_file_stage_t *out_stage) {
 	TBuiltInResource default_resource = {};
 	EShMessages      messages         = EShMsgDefault;
 	EShMessages      messages_link    = (EShMessages)(EShMsgSpvRules | EShMsgVulkanRules | EShMsgDebugInfo);
@@ -144,13 +161,22 @@ compile_result_ sksc_hlsl_to_spirv(const char *filename, const char *hlsl, const
 	shader.setShiftBinding    (glslang::EResSampler, 100); // s registers (samplers)
 	shader.setShiftBinding    (glslang::EResUav,     200); // u registers (UAVs)
 
+	// Bindless declarations go in front of the source rather than in the
+	// preamble, since the preamble is applied again after preprocessing
+	std::string bindless_source;
+	if (bindless) {
+		bindless_source  = sksc_bindless_header;
+		bindless_source += hlsl;
+		shader_strings[0] = bindless_source.c_str();
+	}
 	shader.setStrings         (shader_strings, 1);
 
 	std::string preamble;
-	if (define_count > 0) {
+	if (define_count > 0 || bindless) {
 		for (int32_t i = 0; i < define_count; i++) {
 			preamble += "#define " + std::string(defines[i]) + "\n";
 		}
+		if (bindless) preamble += "#define SKR_BINDLESS 1\n";
 		shader.setPreamble(preamble.c_str());
 	}
 
@@ -294,6 +294,96 @@ array_t<sksc_ast_default_t> sksc_hlsl_find_initializers(const char *hlsl_text) {
 
 ///////////////////////////////////////////
 
+// Fills out a buffer's variable list from a reflected uniform or push
+// constant block.
+static void sksc_meta_block_vars(const SpvReflectBlockVariable *block, uint32_t count, sksc_shader_buffer_t *buff) {
+	buff->var_count = count;
+	buff->vars      = (sksc_shader_var_t*)malloc(count * sizeof(sksc_shader_var_t));
+	memset(buff->vars, 0, count * sizeof(sksc_shader_var_t));
+
+	for (uint32_t m = 0; m < count; m++) {
+		SpvReflectBlockVariable* member = &block->members[m];
+		
+		uint32_t dimensions = member->array.dims_count;
+		int32_t  dim_size   = 1;
+		for (uint32_t d = 0; d < dimensions; d++) {
+			dim_size = dim_size * member->array.dims[d];
+		}
+		
+		const char* member_name = member->name ? member->name : "";
+		strncpy(buff->vars[m].name, member_name, sizeof(buff->vars[m].name));
+		buff->vars[m].offset     = member->offset;
+		buff->vars[m].size       = member->size;
+
+		uint32_t vec_size = member->type_description->traits.numeric.vector.component_count;
+		uint32_t columns  = member->type_description->traits.numeric.matrix.column_count;
+		if (vec_size == 0) vec_size = 1;
+		if (columns  == 0) columns  = 1;
+
+		buff->vars[m].type_count = dim_size * vec_size * columns;
+
+		if (buff->vars[m].type_count == 0)
+			buff->vars[m].type_count = 1;
+
+		// Build type name - use SPIRV type_name for structs, construct for primitives
+		const char* type_name = member->type_description->type_name;
+		if (type_name) {
+			strncpy(buff->vars[m].type_name, type_name, sizeof(buff->vars[m].type_name));
+		} else {
+			// Construct type name for primitive types
+			const char* base_type = "unknown";
+			switch (member->type_description->type_flags & 0xFF) {
+				case SPV_REFLECT_TYPE_FLAG_INT:
+					if (member->type_description->traits.numeric.scalar.signedness) {
+						base_type = "int";
+					} else {
+						base_type = member->type_description->traits.numeric.scalar.width == 8 ? "uint8" : "uint";
+					}
+					break;
+				case SPV_REFLECT_TYPE_FLAG_FLOAT:
+					base_type = member->type_description->traits.numeric.scalar.width == 64 ? "double" : "float";
+					break;
+				case SPV_REFLECT_TYPE_FLAG_BOOL:
+					base_type = "bool";
+					break;
+			}
+
+			// Build: base, base2, base3, base4, or base4x4 for matrices
+			if (columns > 1) {
+				snprintf(buff->vars[m].type_name, sizeof(buff->vars[m].type_name), "%s%ux%u", base_type, vec_size, columns);
+			} else if (vec_size > 1) {
+				snprintf(buff->vars[m].type_name, sizeof(buff->vars[m].type_name), "%s%u", base_type, vec_size);
+			} else {
+				strncpy(buff->vars[m].type_name, base_type, sizeof(buff->vars[m].type_name));
+			}
+		}
+
+		switch (member->type_description->type_flags & 0xFF) {
+			case SPV_REFLECT_TYPE_FLAG_INT:
+				if (member->type_description->traits.numeric.scalar.signedness) {
+					buff->vars[m].type = sksc_shader_var_int;
+				} else {
+					if (member->type_description->traits.numeric.scalar.width == 8)
+						buff->vars[m].type = sksc_shader_var_uint8;
+					else
+						buff->vars[m].type = sksc_shader_var_uint;
+				}
+				break;
+			case SPV_REFLECT_TYPE_FLAG_FLOAT:
+				if (member->type_description->traits.numeric.scalar.width == 64)
+					buff->vars[m].type = sksc_shader_var_double;
+				else
+					buff->vars[m].type = sksc_shader_var_float;
+				break;
+			default:
+				buff->vars[m].type = sksc_shader_var_none;
+				break;
+		}
+	}
+}
+
+///////////////////////////////////////////
+
 bool sksc_spirv_to_meta(const sksc_shader_file_stage_t *spirv_stage, sksc_shader_meta_t *ref_meta) {
 	// Create reflection data
 	SpvReflectShaderModule module;
@@ -328,6 +418,15 @@ bool sksc_spirv_to_meta(const sksc_shader_file_stage_t *spirv_stage, sksc_shader
 		return false;
 	}
 
+	// The bindless tables are bound by the renderer itself, so they aren't
+	// material resources
+	uint32_t kept = 0;
+	for (uint32_t i = 0; i < binding_count; i++) {
+		if (bindings[i]->set != SKSC_BINDLESS_SPACE)
+			bindings[kept++] = bindings[i];
+	}
+	binding_count = kept;
+
 	// Process uniform buffers
 	for (uint32_t i = 0; i < binding_count; i++) {
 		SpvReflectDescriptorBinding* binding = bindings[i];
@@ -359,95 +458,50 @@ bool sksc_spirv_to_meta(const sksc_shader_file_stage_t *spirv_stage, sksc_shader
 			buff->bind.slot          = binding->binding;
 			buff->bind.stage_bits    = spirv_stage->stage;
 			buff->bind.register_type = skr_register_constant;
-			buff->var_count          = count;
-			buff->vars               = (sksc_shader_var_t*)malloc(count * sizeof(sksc_shader_var_t));
-			memset(buff->vars, 0, count * sizeof(sksc_shader_var_t));
 			strncpy(buff->name, buffer_name, sizeof(buff->name));
 
-			for (uint32_t m = 0; m < count; m++) {
-				SpvReflectBlockVariable* member = &binding->block.members[m];
-				
-				uint32_t dimensions = member->array.dims_count;
-				int32_t  dim_size   = 1;
-				for (uint32_t d = 0; d < dimensions; d++) {
-					dim_size = dim_size * member->array.dims[d];
-				}
-				
-				const char* member_name = member->name ? member->name : "";
-				strncpy(buff->vars[m].name, member_name, sizeof(buff->vars[m].name));
-				buff->vars[m].offset     = member->offset;
-				buff->vars[m].size       = member->size;
-
-				uint32_t vec_size = member->type_description->traits.numeric.vector.component_count;
-				uint32_t columns  = member->type_description->traits.numeric.matrix.column_count;
-				if (vec_size == 0) vec_size = 1;
-				if (columns  == 0) columns  = 1;
+			sksc_meta_block_vars(&binding->block, count, buff);
 
-				buff->vars[m].type_count = dim_size * vec_size * columns;
+			if (strcmp(buff->name, "$Global") == 0) {
+				ref_meta->global_buffer_id = (int32_t)id;
+			}
+		}
+	}
 
-				if (buff->vars[m].type_count == 0)
-					buff->vars[m].type_count = 1;
+	// Push constant blocks (`[[vk::push_constant]] cbuffer`) stand in for
+	// $Global as the material's parameters, and have no descriptor binding.
+	uint32_t push_count = 0;
+	result = spvReflectEnumeratePushConstantBlocks(&module, &push_count, nullptr);
+	if (result == SPV_REFLECT_RESULT_SUCCESS && push_count > 0) {
+		SpvReflectBlockVariable** push_blocks = (SpvReflectBlockVariable**)malloc(sizeof(SpvReflectBlockVariable*) * push_count);
+		spvReflectEnumeratePushConstantBlocks(&module, &push_count, push_blocks);
+		for (uint32_t i = 0; i < push_count; i++) {
+			SpvReflectBlockVariable* block = push_blocks[i];
+			const char* buffer_name = block->type_description && block->type_description->type_name
+				? block->type_description->type_name
+				: (block->name ? block->name : "");
+
+			int64_t id = buffer_list.index_where([](const sksc_shader_buffer_t &buff, void *data) {
+				return buff.bind.register_type == skr_register_push_constant && strcmp(buff.name, (char*)data) == 0;
+			}, (void*)buffer_name);
+			bool is_new = id == -1;
+			if (is_new) id = buffer_list.add({});
 
-				// Build type name - use SPIRV type_name for structs, construct for primitives
-				const char* type_name = member->type_description->type_name;
-				if (type_name) {
-					strncpy(buff->vars[m].type_name, type_name, sizeof(buff->vars[m].type_name));
-				} else {
-					// Construct type name for primitive types
-					const char* base_type = "unknown";
-					switch (member->type_description->type_flags & 0xFF) {
-						case SPV_REFLECT_TYPE_FLAG_INT:
-							if (member->type_description->traits.numeric.scalar.signedness) {
-								base_type = "int";
-							} else {
-								base_type = member->type_description->traits.numeric.scalar.width == 8 ? "uint8" : "uint";
-							}
-							break;
-						case SPV_REFLECT_TYPE_FLAG_FLOAT:
-							base_type = member->type_description->traits.numeric.scalar.width == 64 ? "double" : "float";
-							break;
-						case SPV_REFLECT_TYPE_FLAG_BOOL:
-							base_type = "bool";
-							break;
-					}
+			sksc_shader_buffer_t *buff = &buffer_list[id];
+			buff->bind.stage_bits |= spirv_stage->stage;
+			if (!is_new) continue;
 
-					// Build: base, base2, base3, base4, or base4x4 for matrices
-					if (columns > 1) {
-						snprintf(buff->vars[m].type_name, sizeof(buff->vars[m].type_name), "%s%ux%u", base_type, vec_size, columns);
-					} else if (vec_size > 1) {
-						snprintf(buff->vars[m].type_name, sizeof(buff->vars[m].type_name), "%s%u", base_type, vec_size);
-					} else {
-						strncpy(buff->vars[m].type_name, base_type, sizeof(buff->vars[m].type_name));
-					}
-				}
+			// Push constant ranges only need 4 byte granularity
+			buff->size               = (block->size + 3) & ~3u;
+			buff->space              = 0;
+			buff->bind.slot          = 0;
+			buff->bind.stage_bits    = spirv_stage->stage;
+			buff->bind.register_type = skr_register_push_constant;
+			strncpy(buff->name, buffer_name, sizeof(buff->name));
 
-				switch (member->type_description->type_flags & 0xFF) {
-					case SPV_REFLECT_TYPE_FLAG_INT:
-						if (member->type_description->traits.numeric.scalar.signedness) {
-							buff->vars[m].type = sksc_shader_var_int;
-						} else {
-							if (member->type_description->traits.numeric.scalar.width == 8)
-								buff->vars[m].type = sksc_shader_var_uint8;
-							else
-								buff->vars[m].type = sksc_shader_var_uint;
-						}
-						break;
-					case SPV_REFLECT_TYPE_FLAG_FLOAT:
-						if (member->type_description->traits.numeric.scalar.width == 64)
-							buff->vars[m].type = sksc_shader_var_double;
-						else
-							buff->vars[m].type = sksc_shader_var_float;
-						break;
-					default:
-						buff->vars[m].type = sksc_shader_var_none;
-						break;
-				}
-			}
-			
-			if (strcmp(buff->name, "$Global") == 0) {
-				ref_meta->global_buffer_id = (int32_t)id;
-			}
+			sksc_meta_block_vars(block, block->member_count, buff);
 		}
+		free(push_blocks);
 	}
 
 	// Find textures (sampled images)
@@ -952,6 +1006,9 @@ void sksc_meta_assign_defaults(array_t<sksc_ast_default_t> ast_defaults, array_t
 			found += 1;
 			strncpy(ref_meta->name, item->value, sizeof(ref_meta->name));
 		}
+		if (strcmp(item->name, "bindless") == 0) {
+			found += 1;
+		}
 
 		if (found != 1) {
 			sksc_log_at(sksc_log_level_warn, item->row, item->col, "Can't find shader var named '%s'", item->name);
@@ -961,10 +1018,40 @@ void sksc_meta_assign_defaults(array_t<sksc_ast_default_t> ast_defaults, array_t
 
 ///////////////////////////////////////////
 
+bool sksc_meta_assign_push_constants(sksc_shader_meta_t *ref_meta) {
+	int32_t push_id = -1;
+	for (uint32_t i = 0; i < ref_meta->buffer_count; i++) {
+		if (ref_meta->buffers[i].bind.register_type != skr_register_push_constant) continue;
+		if (push_id != -1) {
+			sksc_log(sksc_log_level_err, "Push constant blocks '%s' and '%s' differ, all stages must share one", ref_meta->buffers[push_id].name, ref_meta->buffers[i].name);
+			return false;
+		}
+		push_id = (int32_t)i;
+	}
+	if (push_id == -1) return true;
+
+	// The push constant block *is* the material's parameter block, so it
+	// can't coexist with loose globals.
+	if (ref_meta->global_buffer_id != -1) {
+		sksc_log(sksc_log_level_err, "Push constant block '%s' can't be combined with global shader variables, move them into it", ref_meta->buffers[push_id].name);
+		return false;
+	}
+	// 128 bytes is the minimum maxPushConstantsSize Vulkan guarantees, the
+	// renderer checks the real device limit when loading the shader.
+	if (ref_meta->buffers[push_id].size > 128) {
+		sksc_log(sksc_log_level_warn, "Push constant block '%s' is %u bytes, some devices only support 128", ref_meta->buffers[push_id].name, ref_meta->buffers[push_id].size);
+	}
+	ref_meta->global_buffer_id = push_id;
+	return true;
+}
+
+///////////////////////////////////////////
+
 bool sksc_meta_check_dup_buffers(const sksc_shader_meta_t *ref_meta) {
 	for (size_t i = 0; i < ref_meta->buffer_count; i++) {
+		if (ref_meta->buffers[i].bind.register_type == skr_register_push_constant) continue;
 		for (size_t t = 0; t < ref_meta->buffer_count; t++) {
-			if (i == t) continue;
+			if (i == t || ref_meta->buffers[t].bind.register_type == skr_register_push_constant) continue;
 			if (ref_meta->buffers[i].bind.slot == ref_meta->buffers[t].bind.slot &&
 			    ref_meta->buffers[i].space     == ref_meta->buffers[t].space) {
 				return false;
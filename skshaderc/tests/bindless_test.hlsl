@@ -0,0 +1,35 @@
+//--name = bindless_test
+//--bindless = true
+// Test shader for the bindless tables
+// Expected skshaderc output:
+//   - compiles without declaring skr_bindless_tex/buffer/sampler, the
+//     bindless header provides them in space SKSC_BINDLESS_SPACE
+//   - -i lists only the $Global buffer, the bindless tables are not
+//     reported as material resources
+//   - the .sks is written as version 6 with the bindless flag set, the
+//     same file without '//--bindless = true' fails to compile
+
+uint albedo_index;
+uint data_index;
+
+struct vsIn {
+	float3 pos : SV_POSITION;
+	float2 uv  : TEXCOORD0;
+};
+
+struct psIn {
+	float4 pos : SV_POSITION;
+	float2 uv  : TEXCOORD0;
+};
+
+psIn vs(vsIn input) {
+	psIn output;
+	float3 shift = asfloat(skr_bindless_load(data_index, 0).xxx);
+	output.pos = float4(input.pos + shift, 1);
+	output.uv  = input.uv;
+	return output;
+}
+
+float4 ps(psIn input) : SV_TARGET {
+	return skr_bindless_sample(albedo_index, input.uv);
+}
@@ -0,0 +1,30 @@
+//--name = push_constant_globals_test
+// Test shader combining a push constant block with loose global variables
+// This should fail with: "Push constant block 'PushParams' can't be combined
+// with global shader variables, move them into it"
+
+[[vk::push_constant]]
+cbuffer PushParams {
+	float4 color;
+};
+
+// Loose global, lands in $Global and competes for the parameter block
+float scale;
+
+struct vsIn {
+	float3 pos : SV_POSITION;
+};
+
+struct psIn {
+	float4 pos : SV_POSITION;
+};
+
+psIn vs(vsIn input) {
+	psIn output;
+	output.pos = float4(input.pos * scale, 1);
+	return output;
+}
+
+float4 ps(psIn input) : SV_TARGET {
+	return color;
+}
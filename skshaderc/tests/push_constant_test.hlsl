@@ -0,0 +1,36 @@
+//--name = push_constant_test
+// Test shader for a [[vk::push_constant]] parameter block shared by both stages
+// Expected skshaderc -i output:
+//   - one buffer, 'PushParams', 28 bytes, listed as 'push : PushParams' under
+//     both the Vertex and Pixel shader sections (stage bits vertex|pixel)
+//   - no b#/s# slot, and no duplicate slot error against other buffers
+//   - it becomes the material's parameter block (global_buffer_id), with
+//     'color', 'offset' and 'scale' as its vars, no warnings
+
+[[vk::push_constant]]
+cbuffer PushParams {
+	float4 color;   // +0  16 bytes
+	float2 offset;  // +16  8 bytes
+	float  scale;   // +24  4 bytes
+};
+
+struct vsIn {
+	float3 pos : SV_POSITION;
+	float2 uv  : TEXCOORD0;
+};
+
+struct psIn {
+	float4 pos : SV_POSITION;
+	float2 uv  : TEXCOORD0;
+};
+
+psIn vs(vsIn input) {
+	psIn output;
+	output.pos = float4(input.pos.xy * scale + offset, input.pos.z, 1);
+	output.uv  = input.uv;
+	return output;
+}
+
+float4 ps(psIn input) : SV_TARGET {
+	return color * float4(input.uv, 1, 1);
+}